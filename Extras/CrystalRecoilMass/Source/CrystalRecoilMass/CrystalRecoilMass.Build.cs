@@ -0,0 +1,25 @@
+﻿using UnrealBuildTool;
+
+public class CrystalRecoilMass : ModuleRules
+{
+	public CrystalRecoilMass(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange([
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"MassEntity",
+			"MassSpawner",
+			"CrystalRecoil",
+			"CrystalRecoilCore"
+		]);
+
+		// Shared automation test helpers, only built for editor targets
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("CrystalRecoilTests");
+		}
+	}
+}
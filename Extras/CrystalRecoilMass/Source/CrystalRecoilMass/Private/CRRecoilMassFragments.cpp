@@ -0,0 +1,41 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilMassFragments.h"
+#include "Data/CRRecoilPattern.h"
+#include "CrystalRecoil.h"
+#include "CRRecoilCoreConversions.h"
+
+void FCRRecoilPatternSharedFragment::CachePatternData()
+{
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+
+	ShotDeltas.Reset();
+	ShotPositions.Reset();
+	bHasHeat = ShotToHeatCurve.GetRichCurveConst() && HeatToSpreadAngleCurve.GetRichCurveConst() && HeatToCooldownPerSecondCurve.GetRichCurveConst();
+
+	if (!RecoilPattern)
+	{
+		MotionSettings = FCRRecoilMotionSettings();
+		ShotSequenceSettings = FCRShotSequenceSettings();
+		return;
+	}
+
+	MotionSettings = RecoilPattern->GetMotionSettings();
+	ShotSequenceSettings = RecoilPattern->GetShotSequenceSettings();
+
+	const int32 ShotCount = RecoilPattern->GetMaxShotIndex() + 1;
+	ShotDeltas.Reserve(ShotCount);
+	for (int32 ShotIndex = 0; ShotIndex < ShotCount; ++ShotIndex)
+	{
+		ShotDeltas.Add(CrystalRecoil::ToCore(RecoilPattern->GetShotDelta(ShotIndex)));
+	}
+
+	if (RecoilPattern->IsTimeIndexed())
+	{
+		ShotPositions.Reserve(ShotCount + 1);
+		for (int32 ShotIndex = 0; ShotIndex <= ShotCount; ++ShotIndex)
+		{
+			ShotPositions.Add(CrystalRecoil::ToCore(RecoilPattern->GetShotPosition(ShotIndex)));
+		}
+	}
+}
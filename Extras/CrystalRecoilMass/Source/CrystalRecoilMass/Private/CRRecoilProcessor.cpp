@@ -0,0 +1,116 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilProcessor.h"
+#include "CRRecoilMassFragments.h"
+#include "MassExecutionContext.h"
+#include "CrystalRecoil.h"
+#include "CRRecoilCoreConversions.h"
+
+DECLARE_CYCLE_STAT(TEXT("Mass Recoil Processor"), STAT_CRMassRecoilProcessor, STATGROUP_CrystalRecoil);
+
+UCRRecoilProcessor::UCRRecoilProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+}
+
+void UCRRecoilProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FCRRecoilStateFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FCRRecoilAimFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FCRRecoilPatternSharedFragment>();
+}
+
+void UCRRecoilProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	SCOPE_CYCLE_COUNTER(STAT_CRMassRecoilProcessor);
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+
+	const UWorld* World = Context.GetWorld();
+	const double WorldTime = World ? World->GetTimeSeconds() : 0.0;
+	const float DeltaTime = Context.GetDeltaTimeSeconds();
+
+	EntityQuery.ParallelForEachEntityChunk(EntityManager, Context, [DeltaTime, WorldTime](FMassExecutionContext& ChunkContext)
+	{
+		const FCRRecoilPatternSharedFragment& Pattern = ChunkContext.GetConstSharedFragment<FCRRecoilPatternSharedFragment>();
+		const TArrayView<FCRRecoilStateFragment> States = ChunkContext.GetMutableFragmentView<FCRRecoilStateFragment>();
+		const TArrayView<FCRRecoilAimFragment> Aims = ChunkContext.GetMutableFragmentView<FCRRecoilAimFragment>();
+
+		for (int32 EntityIndex = 0; EntityIndex < ChunkContext.GetNumEntities(); ++EntityIndex)
+		{
+			SimulateEntity(States[EntityIndex], Aims[EntityIndex], Pattern, DeltaTime, WorldTime);
+		}
+	});
+}
+
+void UCRRecoilProcessor::SimulateEntity(FCRRecoilStateFragment& State, FCRRecoilAimFragment& Aim, const FCRRecoilPatternSharedFragment& Pattern, const float DeltaTime, const double WorldTime)
+{
+	// Idle shooters are the common case in large battles, skip them before touching any curve
+	if (!State.bStartShooting && State.PendingShots == 0 && !CrystalRecoilCore::HasPendingMotion(State.Motion) && FMath::IsNearlyZero(State.RecoilHeat))
+	{
+		return;
+	}
+
+	if (State.bStartShooting)
+	{
+		State.bStartShooting = false;
+		State.CurrentShotIndex = 0;
+		State.CurrentShotPosition = 0.f;
+		CrystalRecoilCore::BeginBurst(State.Motion, Pattern.MotionSettings);
+	}
+
+	// Shots queued within one execution share its time stamp, so time indexed patterns spread the elapsed time across them
+	const int32 QueuedShots = State.PendingShots;
+	const double LastFireTime = State.Motion.LastFireTime;
+
+	for (; State.PendingShots > 0; --State.PendingShots)
+	{
+		FCRRecoilVector ShotDelta;
+		double ShotTime = WorldTime;
+		if (Pattern.ShotPositions.Num() > 0)
+		{
+			ShotTime = FMath::Lerp(LastFireTime, WorldTime, static_cast<double>(QueuedShots - State.PendingShots + 1) / QueuedShots);
+			const float ShotAdvance = CrystalRecoilCore::GetTimeIndexedShotAdvance(Pattern.ShotSequenceSettings, State.CurrentShotPosition, State.Motion.LastFireTime, ShotTime);
+			ShotDelta = CrystalRecoilCore::ConsumeShotAdvance(State.CurrentShotPosition, ShotAdvance, Pattern.ShotPositions.GetData(), Pattern.ShotPositions.Num(), Pattern.ShotSequenceSettings, State.RandomStream) * Pattern.RecoilStrength;
+		}
+		else
+		{
+			ShotDelta = CrystalRecoilCore::ConsumeShot(State.CurrentShotIndex, Pattern.ShotDeltas.GetData(), Pattern.ShotDeltas.Num(), Pattern.ShotSequenceSettings, State.RandomStream) * Pattern.RecoilStrength;
+		}
+
+		CrystalRecoilCore::BeginShot(State.Motion, Pattern.MotionSettings, ShotDelta, ShotTime);
+
+		if (Pattern.bHasHeat)
+		{
+			const float HeatToAdd = Pattern.ShotToHeatCurve.GetRichCurveConst()->Eval(State.RecoilHeat);
+			State.RecoilHeat = FMath::Clamp(State.RecoilHeat + HeatToAdd, 0.f, Pattern.MaxRecoilHeat);
+		}
+	}
+
+	FCRRecoilRotation DeltaRecoilRotation;
+	if (CrystalRecoilCore::SimulateUplift(State.Motion, Pattern.MotionSettings, DeltaTime, DeltaRecoilRotation))
+	{
+		Aim.AimOffset = CrystalRecoil::ApplyToControlRotation(Aim.AimOffset, CrystalRecoil::ToRotator(DeltaRecoilRotation));
+		CrystalRecoilCore::CommitUplift(State.Motion, DeltaRecoilRotation);
+	}
+
+	FCRRecoilRotation DeltaRecoveryRotation;
+	if (CrystalRecoilCore::SimulateRecovery(State.Motion, Pattern.MotionSettings, FCRRecoilRotation(), DeltaTime, WorldTime, DeltaRecoveryRotation) == ECRRecoilRecoveryStep::Recover)
+	{
+		Aim.AimOffset = CrystalRecoil::ApplyToControlRotation(Aim.AimOffset, CrystalRecoil::ToRotator(DeltaRecoveryRotation));
+		CrystalRecoilCore::CommitRecovery(State.Motion, DeltaRecoveryRotation);
+		CrystalRecoilCore::SettleRecovery(State.Motion);
+	}
+
+	if (Pattern.bHasHeat)
+	{
+		if (State.Motion.LastFireTime + Pattern.RecoilHeatCooldownDelay < WorldTime)
+		{
+			const float DeltaCooldown = Pattern.HeatToCooldownPerSecondCurve.GetRichCurveConst()->Eval(State.RecoilHeat) * DeltaTime;
+			State.RecoilHeat = FMath::Clamp(State.RecoilHeat - DeltaCooldown, 0.f, Pattern.MaxRecoilHeat);
+		}
+
+		Aim.SpreadAngle = Pattern.HeatToSpreadAngleCurve.GetRichCurveConst()->Eval(State.RecoilHeat);
+	}
+}
@@ -0,0 +1,18 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilTrait.h"
+#include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
+
+void UCRRecoilTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	BuildContext.AddFragment<FCRRecoilStateFragment>();
+	BuildContext.AddFragment<FCRRecoilAimFragment>();
+
+	FCRRecoilPatternSharedFragment PatternFragment = Recoil;
+	PatternFragment.CachePatternData();
+
+	FMassEntityManager& EntityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+	const FConstSharedStruct SharedFragment = EntityManager.GetOrCreateConstSharedFragment(PatternFragment);
+	BuildContext.AddConstSharedFragment(SharedFragment);
+}
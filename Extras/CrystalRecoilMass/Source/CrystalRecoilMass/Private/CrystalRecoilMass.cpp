@@ -0,0 +1,5 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, CrystalRecoilMass)
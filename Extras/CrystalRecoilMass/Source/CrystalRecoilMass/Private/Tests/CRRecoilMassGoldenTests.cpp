@@ -0,0 +1,172 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "CRRecoilTestUtils.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Components/CRRecoilSpreadComponent.h"
+#include "CRRecoilMassFragments.h"
+#include "CRRecoilProcessor.h"
+
+namespace CrystalRecoil::Tests
+{
+	constexpr float GoldenTestFrameTime = 1.f / 60.f;
+	constexpr int32 GoldenTestBurstFrames = 90;
+	constexpr int32 GoldenTestIdleFrames = 120;
+	constexpr int32 GoldenTestBurstCount = 2;
+
+	// Aim offsets are in degrees, the two paths run the same float math so they only differ by rounding
+	constexpr double GoldenTestAimTolerance = 1e-3;
+
+	struct FCRGoldenTestCase
+	{
+		const TCHAR* Name;
+		TFunction<void(UCRRecoilPattern&)> ConfigurePattern;
+	};
+
+	static FRuntimeFloatCurve MakeLinearCurve(const float Value0, const float Value100)
+	{
+		FRuntimeFloatCurve Curve;
+		Curve.GetRichCurve()->AddKey(0.f, Value0);
+		Curve.GetRichCurve()->AddKey(100.f, Value100);
+		return Curve;
+	}
+
+	/**
+	* Number of shots fired in each frame of the script, the same for every test case
+	* Bursts fire 0-3 shots per frame, so time indexed patterns also get several shots within one frame
+	*/
+	static TArray<int32> MakeShotScript()
+	{
+		FRandomStream RandomStream(4242);
+		TArray<int32> ShotsPerFrame;
+		for (int32 BurstIndex = 0; BurstIndex < GoldenTestBurstCount; ++BurstIndex)
+		{
+			for (int32 FrameIndex = 0; FrameIndex < GoldenTestBurstFrames; ++FrameIndex)
+			{
+				ShotsPerFrame.Add(FrameIndex == 0 ? 1 : RandomStream.RandRange(0, 3) == 0 ? RandomStream.RandRange(0, 3) : 0);
+			}
+			ShotsPerFrame.AddZeroed(GoldenTestIdleFrames);
+		}
+		return ShotsPerFrame;
+	}
+
+	static bool IsBurstStart(const int32 Frame)
+	{
+		return Frame % (GoldenTestBurstFrames + GoldenTestIdleFrames) == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilMassGoldenTest, "CrystalRecoil.Mass.MatchesComponent", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilMassGoldenTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	const FCRGoldenTestCase TestCases[] = {
+		{ TEXT("ShotCount RepeatLast"), [](UCRRecoilPattern&) {} },
+		{ TEXT("ShotCount RestartFromCustomIndex"), [](UCRRecoilPattern& Pattern)
+		{
+			Pattern.PatternEndBehavior = ERecoilPatternEndBehavior::RestartFromCustomIndex;
+			Pattern.CustomRecoilRestartIndex = 4;
+		} },
+		{ TEXT("FiringTime"), [](UCRRecoilPattern& Pattern)
+		{
+			Pattern.PatternIndexing = ERecoilPatternIndexing::FiringTime;
+			Pattern.ReferenceFireInterval = 0.1f;
+		} },
+		{ TEXT("Spring"), [](UCRRecoilPattern& Pattern)
+		{
+			Pattern.MotionModel = ERecoilMotionModel::Spring;
+			Pattern.SpringDampingRatio = 0.6f;
+		} }
+	};
+
+	const TArray<int32> ShotsPerFrame = MakeShotScript();
+	const FRuntimeFloatCurve ShotToHeatCurve = MakeLinearCurve(8.f, 2.f);
+	const FRuntimeFloatCurve HeatToSpreadAngleCurve = MakeLinearCurve(0.5f, 4.f);
+	const FRuntimeFloatCurve HeatToCooldownPerSecondCurve = MakeLinearCurve(20.f, 60.f);
+
+	FCRRecoilTestWorld TestWorld;
+	APlayerController* PlayerController = TestWorld.GetPlayerController();
+
+	for (const FCRGoldenTestCase& TestCase : TestCases)
+	{
+		UCRRecoilPattern* Pattern = MakeTestPattern(12);
+		TestCase.ConfigurePattern(*Pattern);
+		Pattern->BakeRuntimeData();
+
+		// Component path, aiming the test player controller from a zero control rotation like the Mass aim offset
+		PlayerController->SetControlRotation(FRotator::ZeroRotator);
+		UCRRecoilSpreadComponent* SpreadComponent = TestWorld.SpawnRecoilComponent<UCRRecoilSpreadComponent>(Pattern, [&](UCRRecoilSpreadComponent& Component)
+		{
+			SetPropertyValue(&Component, TEXT("ShotToHeatCurve"), ShotToHeatCurve);
+			SetPropertyValue(&Component, TEXT("HeatToSpreadAngleCurve"), HeatToSpreadAngleCurve);
+			SetPropertyValue(&Component, TEXT("HeatToCooldownPerSecondCurve"), HeatToCooldownPerSecondCurve);
+		});
+		UCRRecoilComponent* Component = SpreadComponent;
+
+		// Mass path, driven through the processor's per entity step
+		FCRRecoilPatternSharedFragment SharedFragment;
+		SharedFragment.RecoilPattern = Pattern;
+		SharedFragment.MaxRecoilHeat = 100.f;
+		SharedFragment.RecoilHeatCooldownDelay = 0.5f;
+		SharedFragment.ShotToHeatCurve = ShotToHeatCurve;
+		SharedFragment.HeatToSpreadAngleCurve = HeatToSpreadAngleCurve;
+		SharedFragment.HeatToCooldownPerSecondCurve = HeatToCooldownPerSecondCurve;
+		SharedFragment.CachePatternData();
+
+		FCRRecoilStateFragment State;
+		FCRRecoilAimFragment Aim;
+
+		double PeakPitch = 0.0;
+		for (int32 Frame = 0; Frame < ShotsPerFrame.Num(); ++Frame)
+		{
+			// Both paths fire at the time stamp of the frame that consumes the shots
+			TestWorld.AdvanceTime(GoldenTestFrameTime);
+			const double WorldTime = TestWorld.GetWorld()->GetTimeSeconds();
+
+			if (IsBurstStart(Frame))
+			{
+				Component->StartShooting();
+				State.StartShooting();
+			}
+			for (int32 ShotIndex = 0; ShotIndex < ShotsPerFrame[Frame]; ++ShotIndex)
+			{
+				Component->ApplyShot();
+				State.QueueShot();
+			}
+
+			FCRRecoilTestWorld::TickAtCurrentTime(*Component, GoldenTestFrameTime);
+			UCRRecoilProcessor::SimulateEntity(State, Aim, SharedFragment, GoldenTestFrameTime, WorldTime);
+
+			const FRotator ComponentAim = PlayerController->GetControlRotation();
+			PeakPitch = FMath::Max(PeakPitch, FMath::Abs(FRotator::NormalizeAxis(ComponentAim.Pitch)));
+
+			const bool bAimMatches = FMath::IsNearlyEqual(FRotator::NormalizeAxis(ComponentAim.Pitch), FRotator::NormalizeAxis(Aim.AimOffset.Pitch), GoldenTestAimTolerance)
+				&& FMath::IsNearlyEqual(FRotator::NormalizeAxis(ComponentAim.Yaw), FRotator::NormalizeAxis(Aim.AimOffset.Yaw), GoldenTestAimTolerance);
+			if (!bAimMatches)
+			{
+				AddError(FString::Printf(TEXT("%s: aim differs at frame %d, component %s, Mass %s"), TestCase.Name, Frame, *ComponentAim.ToCompactString(), *Aim.AimOffset.ToCompactString()));
+				break;
+			}
+
+			if (!FMath::IsNearlyEqual(SpreadComponent->GetRecoilHeat(), State.RecoilHeat, 1e-3f))
+			{
+				AddError(FString::Printf(TEXT("%s: heat differs at frame %d, component %f, Mass %f"), TestCase.Name, Frame, SpreadComponent->GetRecoilHeat(), State.RecoilHeat));
+				break;
+			}
+		}
+
+		// A script that never moved the aim would match trivially
+		TestTrue(FString::Printf(TEXT("%s: the script kicked the aim"), TestCase.Name), PeakPitch > 1.0);
+
+		Component->GetOwner()->Destroy();
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,118 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "Curves/CurveFloat.h"
+#include "CRRecoilMotion.h"
+#include "CRRecoilShotSequence.h"
+#include "CRRecoilMassFragments.generated.h"
+
+class UCRRecoilPattern;
+
+/**
+* Per shooter recoil state of a Mass entity, the Mass counterpart of the transient state of UCRRecoilSpreadComponent.
+* AI processors fire by calling StartShooting / QueueShot, UCRRecoilProcessor consumes the requests on its next execution.
+*/
+USTRUCT()
+struct CRYSTALRECOILMASS_API FCRRecoilStateFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	// Same as UCRRecoilComponent::StartShooting, restarts the pattern from the first shot
+	void StartShooting()
+	{
+		bStartShooting = true;
+		PendingShots = 0;
+	}
+
+	// Same as UCRRecoilComponent::ApplyShot
+	void QueueShot()
+	{
+		++PendingShots;
+	}
+
+	FCRRecoilMotionState Motion;
+
+	int32 CurrentShotIndex = 0;
+
+	// Fractional pattern position, only advanced for time indexed patterns
+	float CurrentShotPosition = 0.f;
+
+	// Drawn from by the Random pattern end behavior, seed it per entity on spawn to decorrelate shooters
+	FCRRecoilRandomStream RandomStream;
+
+	float RecoilHeat = 0.f;
+
+	int32 PendingShots = 0;
+
+	bool bStartShooting = false;
+};
+
+/**
+* Recoil output of a Mass entity, consumed by AI targeting.
+* AimOffset is the accumulated camera kick (Pitch/Yaw in degrees) to add to the entity's aim direction,
+* applied with the same sign convention and pitch clamp UCRRecoilComponent uses for control rotations.
+*/
+USTRUCT()
+struct CRYSTALRECOILMASS_API FCRRecoilAimFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FRotator AimOffset = FRotator::ZeroRotator;
+
+	// Current heat based spread cone angle, 0 if the heat curves are not set
+	float SpreadAngle = 0.f;
+};
+
+/**
+* Recoil pattern and heat parameters shared by all entities of an archetype, the Mass counterpart of the
+* UCRRecoilSpreadComponent properties. Only the UPROPERTY fields are hashed when Mass dedupes shared fragments,
+* the cached fields below are derived from them by CachePatternData.
+*/
+USTRUCT()
+struct CRYSTALRECOILMASS_API FCRRecoilPatternSharedFragment : public FMassConstSharedFragment
+{
+	GENERATED_BODY()
+
+	/**
+	* Copies the pattern parameters and per shot deltas the processor reads, so it never touches the pattern object on worker threads
+	* Call on the game thread before registering the fragment with the entity manager
+	*/
+	void CachePatternData();
+
+	UPROPERTY(EditAnywhere, Category = "Recoil")
+	TObjectPtr<const UCRRecoilPattern> RecoilPattern;
+
+	// 1.0 = full strength, 0.5 = half, 0.0 = no recoil
+	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.f), Category = "Recoil")
+	float RecoilStrength = 1.f;
+
+	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.f), Category = "Recoil Spread|Heat")
+	float MaxRecoilHeat = 100.f;
+
+	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.f, ForceUnits = "s"), Category = "Recoil Spread|Heat")
+	float RecoilHeatCooldownDelay = 0.5f;
+
+	UPROPERTY(EditAnywhere, Category = "Recoil Spread|Curves")
+	FRuntimeFloatCurve ShotToHeatCurve;
+
+	UPROPERTY(EditAnywhere, Category = "Recoil Spread|Curves")
+	FRuntimeFloatCurve HeatToSpreadAngleCurve;
+
+	UPROPERTY(EditAnywhere, Category = "Recoil Spread|Curves")
+	FRuntimeFloatCurve HeatToCooldownPerSecondCurve;
+
+	FCRRecoilMotionSettings MotionSettings;
+
+	FCRShotSequenceSettings ShotSequenceSettings;
+
+	TArray<FCRRecoilVector> ShotDeltas;
+
+	// Cumulative recoil after each number of shots, ShotPositions[0] being the origin. Only filled for time indexed patterns
+	TArray<FCRRecoilVector> ShotPositions;
+
+	// Heat and spread only run when all three curves are set, like UCRRecoilSpreadComponent::ReadyToCalculateRecoil
+	bool bHasHeat = false;
+};
@@ -0,0 +1,39 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "CRRecoilProcessor.generated.h"
+
+struct FCRRecoilStateFragment;
+struct FCRRecoilAimFragment;
+struct FCRRecoilPatternSharedFragment;
+
+/**
+* Runs the recoil uplift, recovery and heat model of UCRRecoilSpreadComponent for all Mass entities with recoil fragments.
+* Chunks are processed in parallel; the math is the shared CrystalRecoilCore code the components use.
+* Entities have no player input, so compensation and recovery cancellation never trigger.
+*/
+UCLASS()
+class CRYSTALRECOILMASS_API UCRRecoilProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UCRRecoilProcessor();
+
+	/**
+	* Advances one entity by DeltaTime: consumes its shot requests, then runs uplift, recovery and heat cooldown
+	* Same order of operations as ApplyShot followed by a recoil tick on UCRRecoilSpreadComponent
+	*/
+	static void SimulateEntity(FCRRecoilStateFragment& State, FCRRecoilAimFragment& Aim, const FCRRecoilPatternSharedFragment& Pattern, const float DeltaTime, const double WorldTime);
+
+protected:
+	virtual void ConfigureQueries() override;
+
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery EntityQuery;
+};
@@ -0,0 +1,24 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTraitBase.h"
+#include "CRRecoilMassFragments.h"
+#include "CRRecoilTrait.generated.h"
+
+/**
+* Adds recoil simulation to a Mass entity config.
+* Entities sharing the same pattern and heat settings share one FCRRecoilPatternSharedFragment.
+*/
+UCLASS(Meta = (DisplayName = "Crystal Recoil"))
+class CRYSTALRECOILMASS_API UCRRecoilTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+
+	UPROPERTY(EditAnywhere, Category = "Recoil")
+	FCRRecoilPatternSharedFragment Recoil;
+};
@@ -9,7 +9,9 @@ public class CrystalRecoil : ModuleRules
 		PublicDependencyModuleNames.AddRange([
 			"Core",
 			"CoreUObject",
-			"Engine"
+			"Engine",
+			"AnimGraphRuntime",
+			"CrystalRecoilCore"
 		]);
 	}
 }
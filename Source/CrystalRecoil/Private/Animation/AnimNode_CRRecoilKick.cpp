@@ -0,0 +1,71 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Animation/AnimNode_CRRecoilKick.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/CRRecoilPoseBuffer.h"
+#include "AnimationRuntime.h"
+#include "Components/CRRecoilComponent.h"
+
+void FAnimNode_CRRecoilKick::PreUpdate(const UAnimInstance* InAnimInstance)
+{
+	Super::PreUpdate(InAnimInstance);
+
+	// Game thread: the only place the node touches UObjects
+	const AActor* OwningActor = InAnimInstance ? InAnimInstance->GetOwningActor() : nullptr;
+	const UCRRecoilComponent* CachedComponent = RecoilComponent.Get();
+	if (CachedComponent && CachedComponent->GetOwner() == OwningActor)
+	{
+		return;
+	}
+
+	const UCRRecoilComponent* NewComponent = OwningActor ? OwningActor->FindComponentByClass<UCRRecoilComponent>() : nullptr;
+	RecoilComponent = NewComponent;
+	if (NewComponent)
+	{
+		PoseBuffer = NewComponent->GetPoseBuffer();
+	}
+	else
+	{
+		PoseBuffer.Reset();
+	}
+}
+
+void FAnimNode_CRRecoilKick::EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms)
+{
+	if (!PoseBuffer.IsValid())
+	{
+		return;
+	}
+
+	const FCRRecoilPoseOutput RecoilPose = PoseBuffer->Read();
+	if (RecoilPose.Kick.IsNearlyZero())
+	{
+		return;
+	}
+
+	const FVector2f Kick = RecoilPose.Kick.GetClampedToMaxSize(MaxKickDegrees);
+
+	const FBoneContainer& BoneContainer = Output.Pose.GetPose().GetBoneContainer();
+	const FCompactPoseBoneIndex BoneIndex = KickBone.GetCompactPoseIndex(BoneContainer);
+	const FTransform& ComponentTransform = Output.AnimInstanceProxy->GetComponentTransform();
+
+	FTransform BoneTransform = Output.Pose.GetComponentSpaceTransform(BoneIndex);
+	FAnimationRuntime::ConvertCSTransformToBoneSpace(ComponentTransform, Output.Pose, BoneTransform, BoneIndex, BCS_BoneSpace);
+
+	const FQuat KickRotation = FRotator(Kick.Y * PitchPerDegree, Kick.X * YawPerDegree, 0.0).Quaternion();
+	BoneTransform.SetRotation(KickRotation * BoneTransform.GetRotation());
+	BoneTransform.AddToTranslation(TranslationPerDegree * Kick.Size());
+
+	FAnimationRuntime::ConvertBoneSpaceTransformToCS(ComponentTransform, Output.Pose, BoneTransform, BoneIndex, BCS_BoneSpace);
+	OutBoneTransforms.Add(FBoneTransform(BoneIndex, BoneTransform));
+}
+
+bool FAnimNode_CRRecoilKick::IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones)
+{
+	return KickBone.IsValidToEvaluate(RequiredBones);
+}
+
+void FAnimNode_CRRecoilKick::InitializeBoneReferences(const FBoneContainer& RequiredBones)
+{
+	KickBone.Initialize(RequiredBones);
+}
@@ -0,0 +1,28 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Animation/CRRecoilPoseBuffer.h"
+
+void FCRRecoilPoseBuffer::Publish(const FCRRecoilPoseOutput& Output)
+{
+	check(IsInGameThread());
+
+	const uint32 NextCount = PublishCount.load(std::memory_order_relaxed) + 1;
+	Slots[NextCount & 1] = Output;
+	PublishCount.store(NextCount, std::memory_order_release);
+}
+
+FCRRecoilPoseOutput FCRRecoilPoseBuffer::Read() const
+{
+	for (;;)
+	{
+		const uint32 Count = PublishCount.load(std::memory_order_acquire);
+		const FCRRecoilPoseOutput Output = Slots[Count & 1];
+
+		// The slot is only rewritten two publishes later, and publishing happens once per frame, so this practically never loops
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (PublishCount.load(std::memory_order_relaxed) == Count)
+		{
+			return Output;
+		}
+	}
+}
@@ -1,7 +1,10 @@
 ﻿// Copyright CrystalVapor 2026, All rights reserved.
 
 #include "Components/CRRecoilComponent.h"
+#include "CrystalRecoil.h"
+#include "CRRecoilCoreConversions.h"
 #include "Data/CRRecoilPattern.h"
+#include "Subsystems/CRRecoilTickSubsystem.h"
 
 UCRRecoilComponent::UCRRecoilComponent()
 {
@@ -10,167 +13,534 @@ UCRRecoilComponent::UCRRecoilComponent()
 	PrimaryComponentTick.TickGroup = TG_PrePhysics;
 }
 
+void UCRRecoilComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+
+	// Allocate the rollback history up front so recording snapshots never allocates, and restoring the blends neither
+	StateHistory.SetNum(StateHistorySize);
+	PatternBlendEntries.Reserve(FCRRecoilStateSnapshot::MaxPatternBlends);
+
+	RandomStream = FCRRecoilRandomStream(static_cast<uint32>(FMath::Rand()));
+
+	if (bUseBatchedTick)
+	{
+		if (UCRRecoilTickSubsystem* TickSubsystem = UWorld::GetSubsystem<UCRRecoilTickSubsystem>(GetWorld()))
+		{
+			TickSubsystem->RegisterComponent(this);
+		}
+	}
+}
+
+void UCRRecoilComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCRRecoilTickSubsystem* TickSubsystem = UWorld::GetSubsystem<UCRRecoilTickSubsystem>(GetWorld()))
+	{
+		TickSubsystem->UnregisterComponent(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UCRRecoilComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+
+	if (ConsumeRecoilDeltaTime(DeltaTime))
+	{
+		UpdateRecoil(DeltaTime);
+	}
+}
+
+void UCRRecoilComponent::UpdateRecoil(const float DeltaTime)
+{
+	// Same phases UCRRecoilTickSubsystem runs for batched components, just back to back on the game thread
+	BeginRecoilTick(DeltaTime);
+	SimulateRecoilUplift();
+	CommitRecoilUplift();
+	SimulateRecoilRecovery();
+	CommitRecoilRecovery();
+	PublishPoseOutput();
+}
+
+void UCRRecoilComponent::PublishPoseOutput()
+{
+	FCRRecoilPoseOutput Output;
+	Output.Kick = FVector2f(Motion.RecoilToRecover.Yaw, -Motion.RecoilToRecover.Pitch);
+	Output.ShotCount = ShotCount;
+	PoseBuffer->Publish(Output);
+}
+
+TSharedRef<const FCRRecoilPoseBuffer, ESPMode::ThreadSafe> UCRRecoilComponent::GetPoseBuffer() const
+{
+	return PoseBuffer;
+}
+
+bool UCRRecoilComponent::ConsumeRecoilDeltaTime(float& InOutDeltaTime)
+{
+	PendingRecoilDeltaTime += InOutDeltaTime;
+
+	// The own tick function already only runs every LowSignificanceUpdateInterval and receives the whole elapsed time
+	if (bRegisteredWithTickSubsystem && RecoilSignificance == ECRRecoilSignificance::Low && PendingRecoilDeltaTime < LowSignificanceUpdateInterval)
+	{
+		return false;
+	}
+
+	// Time FlushPendingRecoil simulated between two sparse ticks is credited as negative pending time
+	if (PendingRecoilDeltaTime <= 0.f)
+	{
+		return false;
+	}
+
+	InOutDeltaTime = PendingRecoilDeltaTime;
+	PendingRecoilDeltaTime = 0.f;
+	return true;
+}
+
+void UCRRecoilComponent::FlushPendingRecoil()
+{
+	if (!IsRecoilTickEnabled())
+	{
+		return;
+	}
+
+	if (!bRegisteredWithTickSubsystem && GetComponentTickInterval() > 0.f)
+	{
+		// The deferred time is held by the throttled tick function, which will still deliver it on its next run
+		const AActor* Owner = GetOwner();
+		const float DeltaTime = static_cast<float>(GetWorld()->GetTimeSeconds() - LastRecoilUpdateTime) * (Owner ? Owner->CustomTimeDilation : 1.f);
+		if (DeltaTime > 0.f)
+		{
+			PendingRecoilDeltaTime -= DeltaTime;
+			UpdateRecoil(DeltaTime);
+		}
+		return;
+	}
+
+	if (PendingRecoilDeltaTime > 0.f)
+	{
+		const float DeltaTime = PendingRecoilDeltaTime;
+		PendingRecoilDeltaTime = 0.f;
+		UpdateRecoil(DeltaTime);
+	}
+}
+
+void UCRRecoilComponent::SetRecoilSignificance(const ECRRecoilSignificance InSignificance)
+{
+	// Catch up at the old update rate first, so the state is current the moment the significance is raised
+	if (InSignificance == ECRRecoilSignificance::High)
+	{
+		FlushPendingRecoil();
+	}
+
+	RecoilSignificance = InSignificance;
+
+	// Low significance shooters only run their tick function every LowSignificanceUpdateInterval, batched ones are skipped by the subsystem instead
+	SetComponentTickInterval(RecoilSignificance == ECRRecoilSignificance::Low ? LowSignificanceUpdateInterval : 0.f);
+}
+
+ECRRecoilSignificance UCRRecoilComponent::GetRecoilSignificance() const
+{
+	return RecoilSignificance;
+}
+
+bool UCRRecoilComponent::BeginRecoilTick(const float DeltaTime)
+{
+	TickContext = FCRRecoilTickContext();
+	TickContext.DeltaTime = DeltaTime;
 
 	const UWorld* World = GetWorld();
-	AController* Controller = GetTargetController();
+	AController* Controller = World ? GetTargetController() : nullptr;
+	TickContext.WorldTime = World ? World->GetTimeSeconds() : 0.0;
+	LastRecoilUpdateTime = TickContext.WorldTime;
 
 	if (!World || !Controller || !RecoilPattern)
 	{
-		SetComponentTickEnabled(false);
-		return;
+		PendingTimeIndexedShots = 0;
+		SetRecoilTickEnabled(false);
+		return false;
 	}
 
-	FRotator DeltaRecoilRotation = FRotator::ZeroRotator;
-	FRotator DeltaRecoveryRotation = FRotator::ZeroRotator;
+	TickContext.bValid = true;
+	TickContext.Controller = Controller;
+
+	// Still on the game thread, so the patterns and blend weights can be read here
+	ConsumePendingShots(TickContext.WorldTime);
+
+	// Cache pattern parameters so the simulate phases never touch the pattern object
+	TickContext.MotionSettings = GetMotionSettings();
+
 	const FRotator CurrentRotation = Controller->GetControlRotation();
+	TickContext.InputLastFrame = CrystalRecoil::ToRotator(CrystalRecoilCore::GetPlayerInput(CrystalRecoil::ToCore(CurrentRotation), CrystalRecoil::ToCore(CachedControllerRotation), CrystalRecoil::ToCore(RecoilInputGeneratedLastFrame)));
 
-	const FRotator RotationDelta = (CurrentRotation - CachedControllerRotation).GetNormalized();
-	FRotator InputLastFrame = RotationDelta - RecoilInputGeneratedLastFrame;
-	InputLastFrame.Normalize();
+	CachedControllerRotation = CurrentRotation;
+	return true;
+}
 
-	CachedControllerRotation = Controller->GetControlRotation();
+void UCRRecoilComponent::SimulateRecoilUplift()
+{
+	if (TickContext.bValid)
+	{
+		FCRRecoilRotation DeltaRecoilRotation;
+		TickContext.bHasUplift = CrystalRecoilCore::SimulateUplift(Motion, TickContext.MotionSettings, TickContext.DeltaTime, DeltaRecoilRotation);
+		TickContext.DeltaRecoilRotation = CrystalRecoil::ToRotator(DeltaRecoilRotation);
+	}
+}
 
+void UCRRecoilComponent::CommitRecoilUplift()
+{
 	// Apply recoil uplift
-	if (!RecoilToApply.IsNearlyZero())
+	if (TickContext.bHasUplift && ProcessDeltaRecoilRotation(TickContext.DeltaRecoilRotation))
+	{
+		ApplyInputToController(TickContext.Controller, TickContext.DeltaRecoilRotation);
+		CrystalRecoilCore::CommitUplift(Motion, CrystalRecoil::ToCore(TickContext.DeltaRecoilRotation));
+	}
+}
+
+void UCRRecoilComponent::SimulateRecoilRecovery()
+{
+	if (TickContext.bValid)
 	{
-		CurrentRecoilSpeed = FMath::Max(0.f, CurrentRecoilSpeed - CurrentUpliftDeceleration * DeltaTime);
+		FCRRecoilRotation DeltaRecoveryRotation;
+		TickContext.RecoveryStep = CrystalRecoilCore::SimulateRecovery(Motion, TickContext.MotionSettings, CrystalRecoil::ToCore(TickContext.InputLastFrame), TickContext.DeltaTime, TickContext.WorldTime, DeltaRecoveryRotation);
+		TickContext.DeltaRecoveryRotation = CrystalRecoil::ToRotator(DeltaRecoveryRotation);
+	}
+}
 
-		const float DeltaMove = CurrentRecoilSpeed * DeltaTime;
-		const float RemainingMagnitude = FMath::Sqrt(RecoilToApply.Pitch * RecoilToApply.Pitch + RecoilToApply.Yaw * RecoilToApply.Yaw);
+void UCRRecoilComponent::CommitRecoilRecovery()
+{
+	if (!TickContext.bValid)
+	{
+		return;
+	}
 
-		if (DeltaMove >= RemainingMagnitude || FMath::IsNearlyZero(CurrentRecoilSpeed))
+	switch (TickContext.RecoveryStep)
+	{
+		case ECRRecoilRecoveryStep::Cancel:
 		{
-			DeltaRecoilRotation = RecoilToApply;
+			SetRecoilTickEnabled(false);
+			return;
 		}
-		else
+		case ECRRecoilRecoveryStep::Recover:
 		{
-			const float Alpha = DeltaMove / RemainingMagnitude;
-			DeltaRecoilRotation = FRotator(RecoilToApply.Pitch * Alpha, RecoilToApply.Yaw * Alpha, 0.f);
-		}
+			if (ProcessDeltaRecoveryRotation(TickContext.DeltaRecoveryRotation))
+			{
+				ApplyInputToController(TickContext.Controller, TickContext.DeltaRecoveryRotation);
+				CrystalRecoilCore::CommitRecovery(Motion, CrystalRecoil::ToCore(TickContext.DeltaRecoveryRotation));
+			}
 
-		if (ProcessDeltaRecoilRotation(DeltaRecoilRotation))
+			if (CrystalRecoilCore::SettleRecovery(Motion))
+			{
+				SetRecoilTickEnabled(false);
+			}
+			break;
+		}
+		case ECRRecoilRecoveryStep::Settle:
+		{
+			SetRecoilTickEnabled(false);
+			break;
+		}
+		default:
 		{
-			ApplyInputToController(Controller, DeltaRecoilRotation);
-			RecoilToApply -= DeltaRecoilRotation;
-			RecoilToRecover += DeltaRecoilRotation;
+			break;
 		}
 	}
 
-	// Always try to compensate if player is pulling against accumulated recoil
-	if (!RecoilToRecover.IsNearlyZero(0.001))
+	RecoilInputGeneratedLastFrame = CrystalRecoil::ToRotator(CrystalRecoilCore::GetGeneratedInput(CrystalRecoil::ToCore(TickContext.DeltaRecoilRotation), CrystalRecoil::ToCore(TickContext.DeltaRecoveryRotation)));
+}
+
+void UCRRecoilComponent::SetRecoilTickEnabled(const bool bEnabled)
+{
+	// Deferred time only matters while there is recoil work left to simulate
+	if (!bEnabled)
 	{
-		ReduceRecoveryByPlayerInput(InputLastFrame);
+		PendingRecoilDeltaTime = 0.f;
+	}
+	else if (!IsRecoilTickEnabled())
+	{
+		LastRecoilUpdateTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
 	}
 
-	// Accumulate player input during RecoveryDelay wait, but not during uplift
-	if (bTrackingInputDuringFire && RecoilToApply.IsNearlyZero() && LastFireTime + RecoilPattern->RecoveryDelay >= World->GetTimeSeconds())
+	if (bRegisteredWithTickSubsystem)
 	{
-		AccumulatedInputDuringFire.Pitch += InputLastFrame.Pitch;
-		AccumulatedInputDuringFire.Yaw += InputLastFrame.Yaw;
+		bRecoilTickActive = bEnabled;
 	}
+	else
+	{
+		SetComponentTickEnabled(bEnabled);
+	}
+}
 
-	// Apply recoil recovery - only after uplift is fully complete
-	if (RecoilPattern->RecoveryDelay >= 0.f && RecoilToApply.IsNearlyZero() && !RecoilToRecover.IsNearlyZero(0.001))
+bool UCRRecoilComponent::IsRecoilTickEnabled() const
+{
+	return bRegisteredWithTickSubsystem ? bRecoilTickActive : IsComponentTickEnabled();
+}
+
+bool UCRRecoilComponent::CanApplyShot() const
+{
+	const AController* Controller = GetTargetController();
+	return Controller && Controller->IsLocalPlayerController() && RecoilPattern;
+}
+
+void UCRRecoilComponent::BeginShot(const FVector2f& PatternDelta, const double ShotTime)
+{
+	const FVector2f ShotDelta = GetCompiledRecoilModifiers().ApplyToShotDelta(PatternDelta) * RecoilStrength;
+	CrystalRecoilCore::BeginShot(Motion, GetMotionSettings(), CrystalRecoil::ToCore(ShotDelta), ShotTime);
+	++ShotCount;
+}
+
+void UCRRecoilComponent::ConsumePatternShot(const double ShotTime)
+{
+	if (RecoilPattern->IsTimeIndexed())
 	{
-		if (LastFireTime + RecoilPattern->RecoveryDelay < World->GetTimeSeconds())
+		const float ShotAdvance = CrystalRecoilCore::GetTimeIndexedShotAdvance(RecoilPattern->GetShotSequenceSettings(), CurrentShotPosition, Motion.LastFireTime, ShotTime);
+		const float ShotPosition = CurrentShotPosition;
+		const FVector2f BaseDelta = RecoilPattern->ConsumeShotAdvance(CurrentShotPosition, ShotAdvance, RandomStream);
+		BeginShot(BlendPatternDeltas(BaseDelta, [this, ShotPosition, ShotAdvance](const UCRRecoilPattern& Pattern)
 		{
-			// Cancel recovery if player made large aiming movements during burst
-			if (bTrackingInputDuringFire && RecoilPattern->RecoveryCancelThreshold > 0.f)
-			{
-				bTrackingInputDuringFire = false; // Stop tracking once we check
-				const bool bPlayerAimedAway = FMath::Abs(AccumulatedInputDuringFire.Pitch) > RecoilPattern->RecoveryCancelThreshold || FMath::Abs(AccumulatedInputDuringFire.Yaw) > RecoilPattern->RecoveryCancelThreshold;
-
-				if (bPlayerAimedAway)
-				{
-					// Player took manual control - cancel and reset recovery
-					RecoilToRecover = FRotator::ZeroRotator;
-					SetComponentTickEnabled(false);
-					return;
-				}
-			}
+			float BlendedShotPosition = ShotPosition;
+			return Pattern.ConsumeShotAdvance(BlendedShotPosition, ShotAdvance, RandomStream);
+		}), ShotTime);
 
-			CurrentRecoverySpeed = FMath::FInterpConstantTo(CurrentRecoverySpeed, RecoilPattern->MaxRecoverySpeed, DeltaTime, RecoilPattern->RecoveryAcceleration);
-			DeltaRecoveryRotation = FMath::RInterpTo(FRotator::ZeroRotator, RecoilToRecover, DeltaTime, CurrentRecoverySpeed);
-			DeltaRecoveryRotation = FRotator(-DeltaRecoveryRotation.Pitch, -DeltaRecoveryRotation.Yaw, 0.f);
+		// Keeps ApplyShot continuing from the unit this shot ended in if the pattern switches to shot indexing
+		CurrentShotIndex = FMath::FloorToInt32(CurrentShotPosition);
+		return;
+	}
 
-			if (ProcessDeltaRecoveryRotation(DeltaRecoveryRotation))
-			{
-				ApplyInputToController(Controller, DeltaRecoveryRotation);
-				RecoilToRecover += DeltaRecoveryRotation;
-			}
+	const int32 ShotIndex = CurrentShotIndex;
+	const FVector2f BaseDelta = RecoilPattern->ConsumeShot(CurrentShotIndex, RandomStream);
+	BeginShot(BlendPatternDeltas(BaseDelta, [this, ShotIndex](const UCRRecoilPattern& Pattern)
+	{
+		int32 BlendedShotIndex = ShotIndex;
+		return Pattern.ConsumeShot(BlendedShotIndex, RandomStream);
+	}), ShotTime);
+	CurrentShotPosition = static_cast<float>(CurrentShotIndex);
+}
 
-			if (RecoilToRecover.IsNearlyZero(0.001))
-			{
-				RecoilToRecover = FRotator::ZeroRotator;
-				SetComponentTickEnabled(false);
-			}
-		}
+void UCRRecoilComponent::ConsumePendingShots(const double WorldTime)
+{
+	const int32 QueuedShots = PendingTimeIndexedShots;
+	const double LastFireTime = Motion.LastFireTime;
+
+	for (; PendingTimeIndexedShots > 0; --PendingTimeIndexedShots)
+	{
+		const double ShotTime = FMath::Lerp(LastFireTime, WorldTime, static_cast<double>(QueuedShots - PendingTimeIndexedShots + 1) / QueuedShots);
+		ConsumePatternShot(ShotTime);
 	}
-	else if (RecoilToApply.IsNearlyZero() && RecoilToRecover.IsNearlyZero())
+}
+
+void UCRRecoilComponent::ApplyShot()
+{
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+
+	if (!CanApplyShot())
 	{
-		// Nothing to process - disable tick only if we're past the recovery delay window
-		if (World->GetTimeSeconds() > LastFireTime + RecoilPattern->RecoveryDelay)
-		{
-			SetComponentTickEnabled(false);
-		}
+		return;
 	}
 
-	// Negate pitch because ApplyInputToController does Pitch -= Input.Pitch (inverted), but Yaw is additive (Yaw += Input.Yaw), so it keeps its sign.
-	// Without this, the sign mismatch causes InputLastFrame to see double the recoil as phantom player input, which incorrectly triggers compensation
-	RecoilInputGeneratedLastFrame = FRotator(-DeltaRecoilRotation.Pitch - DeltaRecoveryRotation.Pitch, DeltaRecoilRotation.Yaw + DeltaRecoveryRotation.Yaw, 0.f);
+	// Bring a low significance shooter up to date first, so deferred time isn't simulated as if it came after this shot
+	FlushPendingRecoil();
+
+	if (RecoilPattern->IsTimeIndexed())
+	{
+		++PendingTimeIndexedShots;
+		SetRecoilTickEnabled(true);
+		return;
+	}
+
+	ConsumePatternShot(GetWorld()->GetTimeSeconds());
 }
 
-void UCRRecoilComponent::ApplyShot()
+void UCRRecoilComponent::ApplyShotAdvance(const float ShotAdvance)
 {
-	const AController* Controller = GetTargetController();
-	if (!Controller || !Controller->IsLocalPlayerController() || !RecoilPattern)
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+
+	if (!CanApplyShot())
 	{
 		return;
 	}
 
-	const FVector2f RecoilPositionDelta = RecoilPattern->ConsumeShot(CurrentShotIndex) * RecoilStrength;
-	const float RecoilDeltaLength = RecoilPositionDelta.Size();
+	FlushPendingRecoil();
 
-	// Map UpliftSpeed (0-1) to duration: high sharpness = short = snappy
-	// Lerp in speed space (1/T) instead of time space so sharpness feels linear
-	// At 0.0: 1/2 = 0.5s (floaty)
-	// At 0.75: ~20ms (fast)
-	// At 1.0: 1/66 = 0.015s (instant)
-	constexpr float MinRate = 1.f / 0.5f;
-	constexpr float MaxRate = 1.f / 0.025f;
-	const float UpliftDuration = 1.f / FMath::Lerp(MinRate, MaxRate, RecoilPattern->UpliftSpeed);
+	// Shots queued before this advance are applied first, so the pattern is consumed in firing order
+	ConsumePendingShots(GetWorld()->GetTimeSeconds());
 
-	// Kinematics: v0 = 2d/T, a = 2d/T^2
-	// Guarantees camera travels exactly DeltaRecoilLength in exactly UpliftDuration
-	CurrentUpliftDeceleration = (2.f * RecoilDeltaLength) / (UpliftDuration * UpliftDuration);
-	CurrentRecoilSpeed = 2.f * RecoilDeltaLength / UpliftDuration;
+	const float ShotPosition = CurrentShotPosition;
+	const FVector2f BaseDelta = RecoilPattern->ConsumeShotAdvance(CurrentShotPosition, ShotAdvance, RandomStream);
+	BeginShot(BlendPatternDeltas(BaseDelta, [this, ShotPosition, ShotAdvance](const UCRRecoilPattern& Pattern)
+	{
+		float BlendedShotPosition = ShotPosition;
+		return Pattern.ConsumeShotAdvance(BlendedShotPosition, ShotAdvance, RandomStream);
+	}), GetWorld()->GetTimeSeconds());
 
-	RecoilToApply = FRotator(-RecoilPositionDelta.Y, RecoilPositionDelta.X, 0.0);
-	CurrentRecoverySpeed = RecoilPattern->InitialRecoverySpeed;
-	LastFireTime = GetWorld()->GetTimeSeconds();
+	// Keeps ApplyShot on shot indexed patterns continuing from the unit this advance ended in
+	CurrentShotIndex = FMath::FloorToInt32(CurrentShotPosition);
 }
 
-void UCRRecoilComponent::ReduceRecoveryByPlayerInput(const FRotator& LastFrameInput)
+FVector2f UCRRecoilComponent::BlendPatternDeltas(const FVector2f& BaseDelta, TFunctionRef<FVector2f(const UCRRecoilPattern&)> ConsumeBlendedShot)
 {
-	// Only compensate if Player is actively countering recoil (threshold to avoid noise and normal aiming)
-	constexpr double InputThreshold = 0.01;
+	if (PatternBlendEntries.IsEmpty())
+	{
+		return BaseDelta;
+	}
 
-	// Reduce recovery by player input amount when opposing, but don't go past zero
-	auto CompensateAxis = [InputThreshold](double& RecoverAxis, const double InputAxis)
+	UpdatePatternBlendWeights();
+
+	float TotalWeight = 0.f;
+	for (const FCRRecoilPatternBlendEntry& Entry : PatternBlendEntries)
+	{
+		TotalWeight += Entry.Weight;
+	}
+
+	// The recoil pattern fills up the weight the blended patterns leave, anything above a total of 1 is normalized
+	const float BaseWeight = FMath::Max(0.f, 1.f - TotalWeight);
+	const float WeightScale = TotalWeight > 1.f ? 1.f / TotalWeight : 1.f;
+
+	FVector2f Delta = BaseDelta * BaseWeight;
+	for (const FCRRecoilPatternBlendEntry& Entry : PatternBlendEntries)
 	{
-		// Player is pulling in the same direction as recovery needs to go
-		if (FMath::Abs(InputAxis) > InputThreshold && FMath::Sign(InputAxis) == FMath::Sign(RecoverAxis))
+		if (Entry.Pattern && Entry.Weight > 0.f)
 		{
-			const double NewRecovery = RecoverAxis - InputAxis;
-			RecoverAxis = FMath::Sign(NewRecovery) == FMath::Sign(RecoverAxis) ? NewRecovery : 0.0;
+			Delta += ConsumeBlendedShot(*Entry.Pattern) * (Entry.Weight * WeightScale);
 		}
-	};
+	}
+	return Delta;
+}
+
+void UCRRecoilComponent::UpdatePatternBlendWeights()
+{
+	const double WorldTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	const float MaxWeightStep = PatternBlendSpeed > 0.f ? static_cast<float>(WorldTime - LastPatternBlendUpdateTime) * PatternBlendSpeed : UE_BIG_NUMBER;
+	LastPatternBlendUpdateTime = WorldTime;
 
-	CompensateAxis(RecoilToRecover.Pitch, LastFrameInput.Pitch); // Vertical
-	CompensateAxis(RecoilToRecover.Yaw, LastFrameInput.Yaw);     // Horizontal
+	// Weights are only read when a shot is fired, so they are smoothed lazily here instead of on every tick
+	for (int32 Index = PatternBlendEntries.Num() - 1; Index >= 0; --Index)
+	{
+		FCRRecoilPatternBlendEntry& Entry = PatternBlendEntries[Index];
+		Entry.Weight += FMath::Clamp(Entry.TargetWeight - Entry.Weight, -MaxWeightStep, MaxWeightStep);
+
+		if (!Entry.Pattern || (Entry.TargetWeight <= 0.f && Entry.Weight <= 0.f))
+		{
+			PatternBlendEntries.RemoveAtSwap(Index);
+		}
+	}
+}
+
+void UCRRecoilComponent::SetPatternBlendWeight(UCRRecoilPattern* InPattern, const float InWeight, const bool bInstant)
+{
+	if (!InPattern)
+	{
+		return;
+	}
+
+	// Blends share the component's shot position, which only advances one way per shot
+	if (RecoilPattern && InPattern->IsTimeIndexed() != RecoilPattern->IsTimeIndexed())
+	{
+		UE_LOG(LogCrystalRecoil, Warning, TEXT("%s: can't blend %s into %s, shot and time indexed patterns don't mix"), *GetPathName(), *InPattern->GetName(), *RecoilPattern->GetName());
+		return;
+	}
+
+	// Bring the other weights up to now first, so the new target only applies from this point on
+	UpdatePatternBlendWeights();
+
+	const float TargetWeight = FMath::Max(0.f, InWeight);
+	FCRRecoilPatternBlendEntry* Entry = PatternBlendEntries.FindByPredicate([InPattern](const FCRRecoilPatternBlendEntry& Other) { return Other.Pattern == InPattern; });
+	if (!Entry)
+	{
+		if (TargetWeight <= 0.f)
+		{
+			return;
+		}
+
+		if (PatternBlendEntries.Num() >= FCRRecoilStateSnapshot::MaxPatternBlends)
+		{
+			UE_LOG(LogCrystalRecoil, Warning, TEXT("%s: can't blend %s, already blending the maximum of %d patterns"), *GetPathName(), *InPattern->GetName(), FCRRecoilStateSnapshot::MaxPatternBlends);
+			return;
+		}
+
+		Entry = &PatternBlendEntries.AddDefaulted_GetRef();
+		Entry->Pattern = InPattern;
+	}
+
+	Entry->TargetWeight = TargetWeight;
+	if (bInstant)
+	{
+		Entry->Weight = TargetWeight;
+	}
+}
+
+float UCRRecoilComponent::GetPatternBlendWeight(const UCRRecoilPattern* InPattern) const
+{
+	const FCRRecoilPatternBlendEntry* Entry = PatternBlendEntries.FindByPredicate([InPattern](const FCRRecoilPatternBlendEntry& Other) { return Other.Pattern == InPattern; });
+	if (!Entry)
+	{
+		return 0.f;
+	}
+
+	// Same step UpdatePatternBlendWeights would take now, without applying it
+	const double WorldTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	const float MaxWeightStep = PatternBlendSpeed > 0.f ? static_cast<float>(WorldTime - LastPatternBlendUpdateTime) * PatternBlendSpeed : UE_BIG_NUMBER;
+	return Entry->Weight + FMath::Clamp(Entry->TargetWeight - Entry->Weight, -MaxWeightStep, MaxWeightStep);
+}
+
+void UCRRecoilComponent::ClearPatternBlend()
+{
+	PatternBlendEntries.Reset();
+}
+
+int32 UCRRecoilComponent::AddRecoilModifier(const FCRRecoilModifier& InModifier)
+{
+	const int32 ModifierHandle = NextRecoilModifierHandle++;
+	RecoilModifiers.Add(InModifier);
+	RecoilModifierHandles.Add(ModifierHandle);
+	bRecoilModifiersDirty = true;
+	return ModifierHandle;
+}
+
+bool UCRRecoilComponent::RemoveRecoilModifier(const int32 ModifierHandle)
+{
+	const int32 Index = RecoilModifierHandles.IndexOfByKey(ModifierHandle);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Keeps the stack order, rotations and scales don't commute
+	RecoilModifiers.RemoveAt(Index);
+	RecoilModifierHandles.RemoveAt(Index);
+	bRecoilModifiersDirty = true;
+	return true;
+}
+
+void UCRRecoilComponent::ClearRecoilModifiers()
+{
+	RecoilModifiers.Reset();
+	RecoilModifierHandles.Reset();
+	bRecoilModifiersDirty = true;
+}
+
+const FCRCompiledRecoilModifiers& UCRRecoilComponent::GetCompiledRecoilModifiers() const
+{
+	if (bRecoilModifiersDirty)
+	{
+		CompiledRecoilModifiers.Compile(RecoilModifiers);
+		bRecoilModifiersDirty = false;
+	}
+	return CompiledRecoilModifiers;
+}
+
+FCRRecoilMotionSettings UCRRecoilComponent::GetMotionSettings() const
+{
+	FCRRecoilMotionSettings Settings = RecoilPattern->GetMotionSettings();
+	GetCompiledRecoilModifiers().ApplyToMotionSettings(Settings);
+	return Settings;
+}
+
+void UCRRecoilComponent::ReduceRecoveryByPlayerInput(const FRotator& LastFrameInput)
+{
+	CrystalRecoilCore::CompensateRecovery(Motion.RecoilToRecover, CrystalRecoil::ToCore(LastFrameInput));
 }
 
 void UCRRecoilComponent::SetTargetController(AController* InController)
@@ -185,19 +555,7 @@ void UCRRecoilComponent::ApplyInputToController(AController* InTargetController,
 		return;
 	}
 
-	FRotator CurrentRotation = InTargetController->GetControlRotation();
-
-	// Apply the recoil delta
-	CurrentRotation.Pitch -= Input.Pitch;
-	CurrentRotation.Yaw += Input.Yaw;
-
-	// Clamp pitch before normalizing to prevent gimbal lock
-	CurrentRotation.Pitch = FMath::ClampAngle(CurrentRotation.Pitch, -89.9f, 89.9f);
-
-	// Normalize yaw to keep it in -180 to 180 range
-	CurrentRotation.Normalize();
-
-	InTargetController->SetControlRotation(CurrentRotation);
+	InTargetController->SetControlRotation(CrystalRecoil::ApplyToControlRotation(InTargetController->GetControlRotation(), Input));
 }
 
 void UCRRecoilComponent::StartShooting()
@@ -209,21 +567,33 @@ void UCRRecoilComponent::StartShooting()
 	}
 
 	CurrentShotIndex = 0;
-	AccumulatedInputDuringFire = FRotator::ZeroRotator;
+	CurrentShotPosition = 0.f;
+	Motion.AccumulatedInputDuringFire = FCRRecoilRotation();
 
 	if (RecoilPattern)
 	{
-		bTrackingInputDuringFire = RecoilPattern->RecoveryDelay > 0.f && RecoilPattern->RecoveryCancelThreshold > 0.f;
-		SetComponentTickEnabled(true);
+		CrystalRecoilCore::BeginBurst(Motion, GetMotionSettings());
+		SetRecoilTickEnabled(true);
 	}
 }
 
 void UCRRecoilComponent::SetRecoilPattern(UCRRecoilPattern* InRecoilPattern)
 {
-	if (InRecoilPattern)
+	if (!InRecoilPattern)
 	{
-		RecoilPattern = InRecoilPattern;
+		return;
 	}
+
+	RecoilPattern = InRecoilPattern;
+	PatternBlendEntries.RemoveAll([this](const FCRRecoilPatternBlendEntry& Entry)
+	{
+		if (Entry.Pattern && Entry.Pattern->IsTimeIndexed() != RecoilPattern->IsTimeIndexed())
+		{
+			UE_LOG(LogCrystalRecoil, Warning, TEXT("%s: dropping the blend of %s, its indexing doesn't match the new recoil pattern %s"), *GetPathName(), *Entry.Pattern->GetName(), *RecoilPattern->GetName());
+			return true;
+		}
+		return false;
+	});
 }
 
 void UCRRecoilComponent::SetRecoilStrength(const float InRecoilStrength)
@@ -236,6 +606,124 @@ float UCRRecoilComponent::GetRecoilStrength() const
 	return RecoilStrength;
 }
 
+void UCRRecoilComponent::SetRandomSeed(const int32 InSeed)
+{
+	RandomStream = FCRRecoilRandomStream(static_cast<uint32>(InSeed));
+}
+
+void UCRRecoilComponent::SaveState(FCRRecoilStateSnapshot& OutSnapshot) const
+{
+	OutSnapshot.CurrentShotIndex = CurrentShotIndex;
+	OutSnapshot.CurrentShotPosition = CurrentShotPosition;
+	OutSnapshot.PendingTimeIndexedShots = PendingTimeIndexedShots;
+	OutSnapshot.RandomStream = RandomStream;
+
+	OutSnapshot.NumPatternBlends = FMath::Min(PatternBlendEntries.Num(), FCRRecoilStateSnapshot::MaxPatternBlends);
+	for (int32 Index = 0; Index < OutSnapshot.NumPatternBlends; ++Index)
+	{
+		const FCRRecoilPatternBlendEntry& Entry = PatternBlendEntries[Index];
+		OutSnapshot.PatternBlends[Index] = { Entry.Pattern.Get(), Entry.TargetWeight, Entry.Weight };
+	}
+	OutSnapshot.LastPatternBlendUpdateTime = LastPatternBlendUpdateTime;
+	OutSnapshot.RecoilModifiers = GetCompiledRecoilModifiers();
+
+	OutSnapshot.RecoilToApply = Motion.RecoilToApply;
+	OutSnapshot.CurrentRecoilSpeed = Motion.CurrentRecoilSpeed;
+	OutSnapshot.CurrentUpliftDeceleration = Motion.CurrentUpliftDeceleration;
+	OutSnapshot.RecoilToRecover = Motion.RecoilToRecover;
+	OutSnapshot.CurrentRecoverySpeed = Motion.CurrentRecoverySpeed;
+	OutSnapshot.LastFireTime = Motion.LastFireTime;
+	OutSnapshot.bTrackingInputDuringFire = Motion.bTrackingInputDuringFire;
+	OutSnapshot.AccumulatedInputDuringFire = Motion.AccumulatedInputDuringFire;
+	OutSnapshot.SpringOffset = Motion.SpringOffset;
+	OutSnapshot.SpringVelocity = Motion.SpringVelocity;
+	OutSnapshot.SpringTime = Motion.SpringTime;
+	OutSnapshot.RecoilInputGeneratedLastFrame = RecoilInputGeneratedLastFrame;
+	OutSnapshot.CachedControllerRotation = CachedControllerRotation;
+	OutSnapshot.PendingRecoilDeltaTime = PendingRecoilDeltaTime;
+	OutSnapshot.bTickEnabled = IsRecoilTickEnabled();
+}
+
+void UCRRecoilComponent::RestoreState(const FCRRecoilStateSnapshot& Snapshot)
+{
+	CurrentShotIndex = Snapshot.CurrentShotIndex;
+	CurrentShotPosition = Snapshot.CurrentShotPosition;
+	PendingTimeIndexedShots = Snapshot.PendingTimeIndexedShots;
+	RandomStream = Snapshot.RandomStream;
+
+	// Reset keeps the allocation BeginPlay reserved for every blend a snapshot can hold
+	PatternBlendEntries.Reset();
+	for (int32 Index = 0; Index < Snapshot.NumPatternBlends; ++Index)
+	{
+		const FCRRecoilStateSnapshot::FPatternBlend& Blend = Snapshot.PatternBlends[Index];
+		if (UCRRecoilPattern* Pattern = Blend.Pattern.ResolveObjectPtr())
+		{
+			FCRRecoilPatternBlendEntry& Entry = PatternBlendEntries.AddDefaulted_GetRef();
+			Entry.Pattern = Pattern;
+			Entry.TargetWeight = Blend.TargetWeight;
+			Entry.Weight = Blend.Weight;
+		}
+	}
+	LastPatternBlendUpdateTime = Snapshot.LastPatternBlendUpdateTime;
+
+	// The next change to the modifier stack recompiles it from the stack
+	CompiledRecoilModifiers = Snapshot.RecoilModifiers;
+	bRecoilModifiersDirty = false;
+
+	Motion.RecoilToApply = Snapshot.RecoilToApply;
+	Motion.CurrentRecoilSpeed = Snapshot.CurrentRecoilSpeed;
+	Motion.CurrentUpliftDeceleration = Snapshot.CurrentUpliftDeceleration;
+	Motion.RecoilToRecover = Snapshot.RecoilToRecover;
+	Motion.CurrentRecoverySpeed = Snapshot.CurrentRecoverySpeed;
+	Motion.LastFireTime = Snapshot.LastFireTime;
+	Motion.bTrackingInputDuringFire = Snapshot.bTrackingInputDuringFire;
+	Motion.AccumulatedInputDuringFire = Snapshot.AccumulatedInputDuringFire;
+	Motion.SpringOffset = Snapshot.SpringOffset;
+	Motion.SpringVelocity = Snapshot.SpringVelocity;
+	Motion.SpringTime = Snapshot.SpringTime;
+	RecoilInputGeneratedLastFrame = Snapshot.RecoilInputGeneratedLastFrame;
+	CachedControllerRotation = Snapshot.CachedControllerRotation;
+	SetRecoilTickEnabled(Snapshot.bTickEnabled);
+	PendingRecoilDeltaTime = Snapshot.PendingRecoilDeltaTime;
+	PublishPoseOutput();
+}
+
+void UCRRecoilComponent::RecordStateSnapshot(const int32 Frame)
+{
+	if (StateHistory.IsEmpty() || Frame < 0)
+	{
+		return;
+	}
+
+	FCRRecoilStateSnapshot& Slot = StateHistory[Frame % StateHistory.Num()];
+	SaveState(Slot);
+	Slot.Frame = Frame;
+}
+
+bool UCRRecoilComponent::RestoreStateSnapshot(const int32 Frame)
+{
+	const FCRRecoilStateSnapshot* Snapshot = FindStateSnapshot(Frame);
+	if (!Snapshot)
+	{
+		return false;
+	}
+
+	RestoreState(*Snapshot);
+	return true;
+}
+
+const FCRRecoilStateSnapshot* UCRRecoilComponent::FindStateSnapshot(const int32 Frame) const
+{
+	if (StateHistory.IsEmpty() || Frame < 0)
+	{
+		return nullptr;
+	}
+
+	// The slot may have been overwritten by a newer frame that maps to the same index
+	const FCRRecoilStateSnapshot& Slot = StateHistory[Frame % StateHistory.Num()];
+	return Slot.Frame == Frame ? &Slot : nullptr;
+}
+
 AController* UCRRecoilComponent::GetTargetController() const
 {
 	if (!TargetController.IsValid())
@@ -1,35 +1,52 @@
 ﻿// Copyright CrystalVapor 2026, All rights reserved.
 
 #include "Components/CRRecoilSpreadComponent.h"
+#include "CrystalRecoil.h"
 
-void UCRRecoilSpreadComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UCRRecoilSpreadComponent::CommitRecoilRecovery()
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    Super::CommitRecoilRecovery();
+    LLM_SCOPE_BYTAG(CrystalRecoil);
 
-    if (ReadyToCalculateRecoil() && LastFireTime + RecoilHeatCooldownDelay < GetWorld()->GetTimeSeconds())
+    // Cooled down here rather than in SimulateRecoilRecovery, the curves may point at external curve assets which must only be read on the game thread
+    // WorldTime is set even when the base recoil has no controller, so heat keeps cooling down regardless
+    if (ReadyToCalculateRecoil() && Motion.LastFireTime + RecoilHeatCooldownDelay < TickContext.WorldTime)
     {
-        DoHeatCooldown(DeltaTime);
+        DoHeatCooldown(TickContext.DeltaTime);
     }
 
     // Keeps ticking if heat still needs cooldown or base recoil is still active
-    const bool bHasPendingRecoilWork = !FMath::IsNearlyZero(CurrentRecoilHeat) || !RecoilToApply.IsNearlyZero() || !RecoilToRecover.IsNearlyZero(0.001);
-    SetComponentTickEnabled(bHasPendingRecoilWork);
+    const bool bHasPendingRecoilWork = !FMath::IsNearlyZero(CurrentRecoilHeat) || CrystalRecoilCore::HasPendingMotion(Motion);
+    SetRecoilTickEnabled(bHasPendingRecoilWork);
 }
 
 void UCRRecoilSpreadComponent::ApplyShot()
 {
     Super::ApplyShot();
+    LLM_SCOPE_BYTAG(CrystalRecoil);
 
     if (ReadyToCalculateRecoil())
     {
-        AddRecoilHeat(ShotToHeatCurve.GetRichCurveConst()->Eval(CurrentRecoilHeat));
+        AddRecoilHeat(ShotToHeatCurve.GetRichCurveConst()->Eval(CurrentRecoilHeat) * GetCompiledRecoilModifiers().HeatMultiplier);
+    }
+}
+
+void UCRRecoilSpreadComponent::ApplyShotAdvance(const float ShotAdvance)
+{
+    Super::ApplyShotAdvance(ShotAdvance);
+    LLM_SCOPE_BYTAG(CrystalRecoil);
+
+    // Partial shots heat the weapon by the same fraction of a full shot
+    if (ReadyToCalculateRecoil() && ShotAdvance > 0.f)
+    {
+        AddRecoilHeat(ShotToHeatCurve.GetRichCurveConst()->Eval(CurrentRecoilHeat) * GetCompiledRecoilModifiers().HeatMultiplier * ShotAdvance);
     }
 }
 
 void UCRRecoilSpreadComponent::AddRecoilHeat(const float InHeat)
 {
     // It's not redundant for external Blueprint calls - if someone calls AddRecoilHeat outside of ApplyShot
-    SetComponentTickEnabled(true);
+    SetRecoilTickEnabled(true);
     SetRecoilHeat(GetRecoilHeat() + InHeat);
 }
 
@@ -45,6 +62,20 @@ float UCRRecoilSpreadComponent::GetRecoilHeat() const
     return CurrentRecoilHeat;
 }
 
+void UCRRecoilSpreadComponent::SaveState(FCRRecoilStateSnapshot& OutSnapshot) const
+{
+    Super::SaveState(OutSnapshot);
+    OutSnapshot.RecoilHeat = CurrentRecoilHeat;
+}
+
+void UCRRecoilSpreadComponent::RestoreState(const FCRRecoilStateSnapshot& Snapshot)
+{
+    Super::RestoreState(Snapshot);
+
+    // Goes through SetRecoilHeat so listeners (e.g. crosshair) follow the rolled back heat
+    SetRecoilHeat(Snapshot.RecoilHeat);
+}
+
 void UCRRecoilSpreadComponent::SetMaxRecoilHeat(const float InMaxHeat)
 {
     MaxRecoilHeat = FMath::Max(0.f, InMaxHeat);
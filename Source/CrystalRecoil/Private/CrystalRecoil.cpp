@@ -2,6 +2,10 @@
 
 #define LOCTEXT_NAMESPACE "FCrystalRecoilModule"
 
+LLM_DEFINE_TAG(CrystalRecoil);
+
+DEFINE_LOG_CATEGORY(LogCrystalRecoil);
+
 void FCrystalRecoilModule::StartupModule()
 {
 }
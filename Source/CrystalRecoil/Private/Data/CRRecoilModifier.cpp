@@ -0,0 +1,57 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Data/CRRecoilModifier.h"
+#include "CRRecoilMotion.h"
+
+void FCRCompiledRecoilModifiers::Compile(TConstArrayView<FCRRecoilModifier> Modifiers)
+{
+	*this = FCRCompiledRecoilModifiers();
+
+	for (const FCRRecoilModifier& Modifier : Modifiers)
+	{
+		float Sin = 0.f;
+		float Cos = 1.f;
+		FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(Modifier.Rotation));
+
+		// Row vector convention (v' = v * M), scale first then rotate
+		const float ScaleX = static_cast<float>(Modifier.AxisScale.X);
+		const float ScaleY = static_cast<float>(Modifier.AxisScale.Y);
+		const FMatrix2x2f ModifierTransform(ScaleX * Cos, ScaleX * Sin, -ScaleY * Sin, ScaleY * Cos);
+		ShotTransform = ShotTransform.Concatenate(ModifierTransform);
+
+		if (Modifier.MaxShotRecoil > 0.f)
+		{
+			MaxShotRecoil = MaxShotRecoil > 0.f ? FMath::Min(MaxShotRecoil, Modifier.MaxShotRecoil) : Modifier.MaxShotRecoil;
+		}
+
+		UpliftSpeedMultiplier *= Modifier.UpliftSpeedMultiplier;
+		RecoveryMultiplier *= Modifier.RecoveryMultiplier;
+		HeatMultiplier *= Modifier.HeatMultiplier;
+	}
+
+	bIdentity = ShotTransform.IsNearlyIdentity() && MaxShotRecoil == 0.f && UpliftSpeedMultiplier == 1.f && RecoveryMultiplier == 1.f && HeatMultiplier == 1.f;
+}
+
+FVector2f FCRCompiledRecoilModifiers::ApplyToShotDelta(const FVector2f& ShotDelta) const
+{
+	if (bIdentity)
+	{
+		return ShotDelta;
+	}
+
+	const FVector2f TransformedDelta = ShotTransform.TransformVector(ShotDelta);
+	return MaxShotRecoil > 0.f ? TransformedDelta.GetClampedToMaxSize(MaxShotRecoil) : TransformedDelta;
+}
+
+void FCRCompiledRecoilModifiers::ApplyToMotionSettings(FCRRecoilMotionSettings& Settings) const
+{
+	if (bIdentity)
+	{
+		return;
+	}
+
+	Settings.UpliftSpeedMultiplier *= UpliftSpeedMultiplier;
+	Settings.InitialRecoverySpeed *= RecoveryMultiplier;
+	Settings.MaxRecoverySpeed *= RecoveryMultiplier;
+	Settings.RecoveryAcceleration *= RecoveryMultiplier;
+}
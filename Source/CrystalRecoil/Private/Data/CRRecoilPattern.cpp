@@ -2,64 +2,317 @@
 
 #include "Data/CRRecoilPattern.h"
 #include "Data/CRRecoilUnitGraph.h"
+#include "CrystalRecoil.h"
+#include "CRRecoilCoreConversions.h"
+#include "Hash/xxhash.h"
+#include "CoreGlobals.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
 
 UCRRecoilPattern::UCRRecoilPattern()
 {
+	LLM_SCOPE_BYTAG(CrystalRecoil);
 	RecoilUnitGraph = NewObject<UCRRecoilUnitGraph>(this, "RecoilUnitGraph", RF_Transactional | RF_Public);
 }
 
+void UCRRecoilPattern::Serialize(FArchive& Ar)
+{
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+	Super::Serialize(Ar);
+}
+
+void UCRRecoilPattern::PostLoad()
+{
+	Super::PostLoad();
+
+	// Covers assets saved before baking existed
+	if (RecoilUnitGraph && BakedShotDeltas.Num() != RecoilUnitGraph->GetUnitCount())
+	{
+		LLM_SCOPE_BYTAG(CrystalRecoil);
+		BakeRuntimeData();
+	}
+
+	#if !WITH_EDITOR
+	// Cooked data is final, so the baked deltas can be handed to the shared copy of all patterns with the same units
+	ShareBakedData();
+	#endif
+}
+
+void UCRRecoilPattern::BeginDestroy()
+{
+	// The exit purge can run after the registry's static was destroyed, and nothing reads the sharing stats anymore
+	if (GExitPurge)
+	{
+		SharedBakedData.Reset();
+	}
+	else
+	{
+		FCRRecoilPatternBakedDataRegistry::Get().Release(SharedBakedData);
+	}
+	Super::BeginDestroy();
+}
+
+void UCRRecoilPattern::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+	BakeRuntimeData();
+}
+
+#if WITH_EDITOR
+EDataValidationResult UCRRecoilPattern::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+
+	TArray<FString> Errors;
+	if (!ValidatePattern(Errors))
+	{
+		for (const FString& Error : Errors)
+		{
+			Context.AddError(FText::FromString(Error));
+		}
+		Result = EDataValidationResult::Invalid;
+	}
+
+	return Result;
+}
+#endif
+
 UCRRecoilUnitGraph* UCRRecoilPattern::GetUnitGraph() const
 {
 	return RecoilUnitGraph;
 }
 
-FVector2f UCRRecoilPattern::ConsumeShot(int32& ShotIndex) const
+bool UCRRecoilPattern::ValidatePattern(TArray<FString>& OutErrors) const
 {
-	if (RecoilUnitGraph->GetUnitCount() == 0)
+	const int32 InitialErrorCount = OutErrors.Num();
+
+	if (!RecoilUnitGraph)
+	{
+		OutErrors.Add(TEXT("Pattern has no unit graph"));
+		return false;
+	}
+
+	const int32 UnitCount = RecoilUnitGraph->GetUnitCount();
+	if (UnitCount == 0)
 	{
-		return FVector2f::ZeroVector;
+		OutErrors.Add(TEXT("Pattern has no recoil units"));
 	}
 
-	if (ShotIndex >= GetMaxShotIndex())
+	if (PatternEndBehavior == ERecoilPatternEndBehavior::RestartFromCustomIndex && UnitCount > 0 && (CustomRecoilRestartIndex < 0 || CustomRecoilRestartIndex > GetMaxShotIndex()))
+	{
+		OutErrors.Add(FString::Printf(TEXT("CustomRecoilRestartIndex %d is outside the pattern [0, %d]"), CustomRecoilRestartIndex, GetMaxShotIndex()));
+	}
+
+	TSet<uint32> SeenIDs;
+	SeenIDs.Reserve(UnitCount);
+
+	for (int32 Index = 0; Index < UnitCount; ++Index)
 	{
-		switch (PatternEndBehavior)
+		const FCRRecoilUnit& Unit = RecoilUnitGraph->GetUnitAt(Index);
+
+		bool bAlreadySeen = false;
+		SeenIDs.Add(Unit.ID, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			OutErrors.Add(FString::Printf(TEXT("Unit %d has duplicate ID %u"), Index, Unit.ID));
+		}
+
+		if (!FMath::IsFinite(Unit.Position.X) || !FMath::IsFinite(Unit.Position.Y))
 		{
-			case ERecoilPatternEndBehavior::Stop:
-			{
-				return FVector2f::ZeroVector;
-			}
-			case ERecoilPatternEndBehavior::RepeatLast:
-			{
-				const int32 MaxIndex = GetMaxShotIndex();
-				const FVector2f CurrentPosition = RecoilUnitGraph->GetUnitAt(MaxIndex).Position;
-				const FVector2f PreviousPosition = MaxIndex > 0 ? RecoilUnitGraph->GetUnitAt(MaxIndex - 1).Position : FVector2f::ZeroVector;
-				return CurrentPosition - PreviousPosition;
-			}
-			case ERecoilPatternEndBehavior::RestartFromCustomIndex:
-			{
-				ShotIndex = FMath::Clamp<int32>(CustomRecoilRestartIndex, 0, GetMaxShotIndex());
-				break;
-			}
-			case ERecoilPatternEndBehavior::Random:
-			{
-				return FVector2f
-				(
-					// Non-deterministic: recoil is a local visual-only effect and does not need to match across server/clients
-					FMath::RandRange(RandomizedRecoil.RandomXRange.X, RandomizedRecoil.RandomXRange.Y),
-					FMath::RandRange(RandomizedRecoil.RandomYRange.X, RandomizedRecoil.RandomYRange.Y)
-				);
-			}
+			OutErrors.Add(FString::Printf(TEXT("Unit %d has a non-finite position"), Index));
 		}
 	}
 
-	// Normal path (and RestartFromCustomIndex after reset): consume this shot and advance the index
+	if (IsTimeIndexed() && !(ReferenceFireInterval > 0.f))
+	{
+		OutErrors.Add(FString::Printf(TEXT("ReferenceFireInterval %g must be positive for time indexed patterns"), ReferenceFireInterval));
+	}
+
+	if (RandomizedRecoil.RandomXRange.X > RandomizedRecoil.RandomXRange.Y)
+	{
+		OutErrors.Add(FString::Printf(TEXT("RandomXRange min %g is greater than max %g"), RandomizedRecoil.RandomXRange.X, RandomizedRecoil.RandomXRange.Y));
+	}
+
+	if (RandomizedRecoil.RandomYRange.X > RandomizedRecoil.RandomYRange.Y)
+	{
+		OutErrors.Add(FString::Printf(TEXT("RandomYRange min %g is greater than max %g"), RandomizedRecoil.RandomYRange.X, RandomizedRecoil.RandomYRange.Y));
+	}
+
+	return OutErrors.Num() == InitialErrorCount;
+}
+
+bool UCRRecoilPattern::BakeRuntimeData()
+{
+	const int32 UnitCount = RecoilUnitGraph ? RecoilUnitGraph->GetUnitCount() : 0;
+	const uint64 UnitsHash = ComputeUnitsHash();
+
+	// Same units bake to the same deltas, so unchanged patterns skip the rebuild on every save and cook
+	if (UnitsHash == BakedUnitsHash && BakedShotDeltas.Num() == UnitCount)
+	{
+		return false;
+	}
+
+	TArray<FVector2f> ShotDeltas;
+	ShotDeltas.SetNumUninitialized(UnitCount);
+
+	FVector2f PreviousPosition = FVector2f::ZeroVector;
+	for (int32 Index = 0; Index < UnitCount; ++Index)
+	{
+		const FVector2f CurrentPosition = RecoilUnitGraph->GetUnitAt(Index).Position;
+		ShotDeltas[Index] = CurrentPosition - PreviousPosition;
+		PreviousPosition = CurrentPosition;
+	}
+
+	const bool bChanged = UnitsHash != BakedUnitsHash || ShotDeltas != BakedShotDeltas;
+	BakedShotDeltas = MoveTemp(ShotDeltas);
+	BakedUnitsHash = UnitsHash;
+	return bChanged;
+}
+
+void UCRRecoilPattern::ShareBakedData()
+{
+	if (BakedUnitsHash != 0 && !BakedShotDeltas.IsEmpty())
+	{
+		FCRRecoilPatternBakedDataRegistry::Get().Release(SharedBakedData);
+		SharedBakedData = FCRRecoilPatternBakedDataRegistry::Get().Intern(BakedUnitsHash, MoveTemp(BakedShotDeltas));
+		BakedShotDeltas.Empty();
+	}
+}
+
+bool UCRRecoilPattern::SharesBakedDataWith(const UCRRecoilPattern& Other) const
+{
+	return SharedBakedData.IsValid() && SharedBakedData == Other.SharedBakedData;
+}
+
+uint64 UCRRecoilPattern::ComputeUnitsHash() const
+{
+	// Bump when the baked data layout changes, so existing bakes are rebuilt
+	constexpr uint32 BakedDataVersion = 1;
+
+	FXxHash64Builder Builder;
+	Builder.Update(&BakedDataVersion, sizeof(BakedDataVersion));
+
+	const int32 UnitCount = RecoilUnitGraph ? RecoilUnitGraph->GetUnitCount() : 0;
+	Builder.Update(&UnitCount, sizeof(UnitCount));
+
+	for (int32 Index = 0; Index < UnitCount; ++Index)
+	{
+		const FVector2f& Position = RecoilUnitGraph->GetUnitAt(Index).Position;
+		Builder.Update(&Position, sizeof(Position));
+	}
+
+	return Builder.Finalize().Hash;
+}
+
+uint64 UCRRecoilPattern::ComputeContentHash() const
+{
+	FXxHash64Builder Builder;
+	auto AppendValue = [&Builder](const auto& Value)
+	{
+		Builder.Update(&Value, sizeof(Value));
+	};
+
+	AppendValue(ComputeUnitsHash());
+	AppendValue(MotionModel);
+	AppendValue(SpringFrequency);
+	AppendValue(SpringDampingRatio);
+	AppendValue(UpliftSpeed);
+	AppendValue(RecoveryDelay);
+	AppendValue(InitialRecoverySpeed);
+	AppendValue(MaxRecoverySpeed);
+	AppendValue(RecoveryAcceleration);
+	AppendValue(RecoveryCancelThreshold);
+	AppendValue(PatternIndexing);
+	AppendValue(ReferenceFireInterval);
+	AppendValue(PatternEndBehavior);
+	AppendValue(CustomRecoilRestartIndex);
+	AppendValue(RandomizedRecoil.RandomXRange);
+	AppendValue(RandomizedRecoil.RandomYRange);
+
+	return Builder.Finalize().Hash;
+}
+
+SIZE_T UCRRecoilPattern::GetBakedDataSize() const
+{
+	return BakedShotDeltas.GetAllocatedSize() + (SharedBakedData ? SharedBakedData->ShotDeltas.GetAllocatedSize() : 0);
+}
+
+FVector2f UCRRecoilPattern::GetShotDelta(const int32 ShotIndex) const
+{
+	#if !WITH_EDITOR
+	if (SharedBakedData && SharedBakedData->ShotDeltas.IsValidIndex(ShotIndex))
+	{
+		return SharedBakedData->ShotDeltas[ShotIndex];
+	}
+
+	if (BakedShotDeltas.IsValidIndex(ShotIndex))
+	{
+		return BakedShotDeltas[ShotIndex];
+	}
+	#endif
+
 	const FVector2f CurrentPosition = RecoilUnitGraph->GetUnitAt(ShotIndex).Position;
 	const FVector2f PreviousPosition = ShotIndex > 0 ? RecoilUnitGraph->GetUnitAt(ShotIndex - 1).Position : FVector2f::ZeroVector;
-	++ShotIndex;
 	return CurrentPosition - PreviousPosition;
 }
 
+FVector2f UCRRecoilPattern::ConsumeShot(int32& ShotIndex, FCRRecoilRandomStream& RandomStream) const
+{
+	return CrystalRecoil::ToVector2f(CrystalRecoilCore::ConsumeShot(ShotIndex, RecoilUnitGraph->GetUnitCount(), GetShotSequenceSettings(), RandomStream, [this](const int32 Index) { return CrystalRecoil::ToCore(GetShotDelta(Index)); }));
+}
+
+FVector2f UCRRecoilPattern::GetShotPosition(const int32 ShotCount) const
+{
+	return ShotCount > 0 ? RecoilUnitGraph->GetUnitAt(ShotCount - 1).Position : FVector2f::ZeroVector;
+}
+
+FVector2f UCRRecoilPattern::ConsumeShotAdvance(float& ShotPosition, const float ShotAdvance, FCRRecoilRandomStream& RandomStream) const
+{
+	return CrystalRecoil::ToVector2f(CrystalRecoilCore::ConsumeShotAdvance(ShotPosition, ShotAdvance, RecoilUnitGraph->GetUnitCount(), GetShotSequenceSettings(), RandomStream, [this](const int32 Index) { return CrystalRecoil::ToCore(GetShotPosition(Index)); }));
+}
+
+bool UCRRecoilPattern::IsTimeIndexed() const
+{
+	return PatternIndexing == ERecoilPatternIndexing::FiringTime;
+}
+
 int32 UCRRecoilPattern::GetMaxShotIndex() const
 {
 	return RecoilUnitGraph->GetUnitCount() - 1;
 }
+
+FCRRecoilMotionSettings UCRRecoilPattern::GetMotionSettings() const
+{
+	static_assert(static_cast<uint8>(ECRRecoilMotionModel::Kinematic) == static_cast<uint8>(ERecoilMotionModel::Kinematic));
+	static_assert(static_cast<uint8>(ECRRecoilMotionModel::Spring) == static_cast<uint8>(ERecoilMotionModel::Spring));
+
+	FCRRecoilMotionSettings Settings;
+	Settings.Model = static_cast<ECRRecoilMotionModel>(MotionModel);
+	Settings.UpliftSpeed = UpliftSpeed;
+	Settings.RecoveryDelay = RecoveryDelay;
+	Settings.InitialRecoverySpeed = InitialRecoverySpeed;
+	Settings.MaxRecoverySpeed = MaxRecoverySpeed;
+	Settings.RecoveryAcceleration = RecoveryAcceleration;
+	Settings.RecoveryCancelThreshold = RecoveryCancelThreshold;
+	Settings.SpringFrequency = SpringFrequency;
+	Settings.SpringDampingRatio = SpringDampingRatio;
+	return Settings;
+}
+
+FCRShotSequenceSettings UCRRecoilPattern::GetShotSequenceSettings() const
+{
+	static_assert(static_cast<uint8>(ECRShotSequenceEndBehavior::RepeatLast) == static_cast<uint8>(ERecoilPatternEndBehavior::RepeatLast));
+	static_assert(static_cast<uint8>(ECRShotSequenceEndBehavior::Stop) == static_cast<uint8>(ERecoilPatternEndBehavior::Stop));
+	static_assert(static_cast<uint8>(ECRShotSequenceEndBehavior::RestartFromCustomIndex) == static_cast<uint8>(ERecoilPatternEndBehavior::RestartFromCustomIndex));
+	static_assert(static_cast<uint8>(ECRShotSequenceEndBehavior::Random) == static_cast<uint8>(ERecoilPatternEndBehavior::Random));
+
+	FCRShotSequenceSettings Settings;
+	Settings.EndBehavior = static_cast<ECRShotSequenceEndBehavior>(PatternEndBehavior);
+	Settings.CustomRestartIndex = CustomRecoilRestartIndex;
+	Settings.RandomXRange = CrystalRecoil::ToCoreRange(RandomizedRecoil.RandomXRange);
+	Settings.RandomYRange = CrystalRecoil::ToCoreRange(RandomizedRecoil.RandomYRange);
+	Settings.ReferenceFireInterval = IsTimeIndexed() ? ReferenceFireInterval : 0.f;
+	return Settings;
+}
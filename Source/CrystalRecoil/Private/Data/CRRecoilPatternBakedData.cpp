@@ -0,0 +1,74 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Data/CRRecoilPatternBakedData.h"
+#include "CrystalRecoil.h"
+#include "Misc/ScopeLock.h"
+
+DECLARE_MEMORY_STAT(TEXT("Shared Baked Pattern Memory Saved"), STAT_CRSharedBakedPatternMemorySaved, STATGROUP_CrystalRecoil);
+
+FCRRecoilPatternBakedDataRegistry& FCRRecoilPatternBakedDataRegistry::Get()
+{
+	static FCRRecoilPatternBakedDataRegistry Registry;
+	return Registry;
+}
+
+TSharedRef<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe> FCRRecoilPatternBakedDataRegistry::Intern(const uint64 UnitsHash, TArray<FVector2f>&& ShotDeltas)
+{
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+	FScopeLock Lock(&Mutex);
+
+	TWeakPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe>& Entry = Entries.FindOrAdd(UnitsHash);
+	if (const TSharedPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe> Existing = Entry.Pin())
+	{
+		if (Existing->ShotDeltas == ShotDeltas)
+		{
+			MemorySaved += Existing->ShotDeltas.GetAllocatedSize();
+			INC_MEMORY_STAT_BY(STAT_CRSharedBakedPatternMemorySaved, Existing->ShotDeltas.GetAllocatedSize());
+			return Existing.ToSharedRef();
+		}
+
+		// Hash collision, keep the existing entry and give this pattern its own copy
+		TSharedRef<FCRRecoilPatternBakedData, ESPMode::ThreadSafe> Unshared = MakeShared<FCRRecoilPatternBakedData, ESPMode::ThreadSafe>();
+		Unshared->UnitsHash = UnitsHash;
+		Unshared->ShotDeltas = MoveTemp(ShotDeltas);
+		return Unshared;
+	}
+
+	TSharedRef<FCRRecoilPatternBakedData, ESPMode::ThreadSafe> Data = MakeShared<FCRRecoilPatternBakedData, ESPMode::ThreadSafe>();
+	Data->UnitsHash = UnitsHash;
+	Data->ShotDeltas = MoveTemp(ShotDeltas);
+	Entry = Data;
+	return Data;
+}
+
+void FCRRecoilPatternBakedDataRegistry::Release(TSharedPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe>& Data)
+{
+	if (!Data.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+
+	if (Data.IsUnique())
+	{
+		// Last user, drop the expired entry so the map doesn't grow with every pattern ever loaded
+		if (const TWeakPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe>* Entry = Entries.Find(Data->UnitsHash); Entry && Entry->HasSameObject(Data.Get()))
+		{
+			Entries.Remove(Data->UnitsHash);
+		}
+	}
+	else
+	{
+		MemorySaved -= Data->ShotDeltas.GetAllocatedSize();
+		DEC_MEMORY_STAT_BY(STAT_CRSharedBakedPatternMemorySaved, Data->ShotDeltas.GetAllocatedSize());
+	}
+
+	Data.Reset();
+}
+
+SIZE_T FCRRecoilPatternBakedDataRegistry::GetMemorySaved() const
+{
+	FScopeLock Lock(&Mutex);
+	return MemorySaved;
+}
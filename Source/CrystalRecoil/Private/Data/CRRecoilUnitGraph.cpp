@@ -1,6 +1,16 @@
 ﻿// Copyright CrystalVapor 2026, All rights reserved.
 
 #include "Data/CRRecoilUnitGraph.h"
+#include "CrystalRecoil.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/IsSorted.h"
+
+void UCRRecoilUnitGraph::Serialize(FArchive& Ar)
+{
+	// Attributes the unit array of loaded patterns to the CrystalRecoil tag
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+	Super::Serialize(Ar);
+}
 
 const FCRRecoilUnit& UCRRecoilUnitGraph::GetUnitAt(const int32 Index) const
 {
@@ -13,15 +23,80 @@ int32 UCRRecoilUnitGraph::GetUnitCount() const
 }
 
 #if WITH_EDITOR
+namespace
+{
+	/**
+	* Orders units by the rearrange policy, ties are broken by ID so every unit has exactly one place
+	* Positions are compared exactly: a tolerance isn't transitive, which breaks the binary searches and merges below
+	*/
+	struct FUnitOrderPredicate
+	{
+		explicit FUnitOrderPredicate(const ECRRecoilUnitGraphRearrangePolicy Policy)
+			: bByY(Policy == ECRRecoilUnitGraphRearrangePolicy::AscendByY || Policy == ECRRecoilUnitGraphRearrangePolicy::DescendByY)
+			, bAscend(Policy == ECRRecoilUnitGraphRearrangePolicy::AscendByY || Policy == ECRRecoilUnitGraphRearrangePolicy::AscendByX)
+		{
+		}
+
+		bool operator()(const FCRRecoilUnit& A, const FCRRecoilUnit& B) const
+		{
+			const float ValueA = bByY ? A.Position.Y : A.Position.X;
+			const float ValueB = bByY ? B.Position.Y : B.Position.X;
+
+			if (ValueA != ValueB)
+			{
+				return bAscend ? ValueA < ValueB : ValueA > ValueB;
+			}
+
+			return A.ID < B.ID;
+		}
+
+		bool bByY;
+		bool bAscend;
+	};
+}
+
 int32 UCRRecoilUnitGraph::AddUnit(const FVector2f& RecoilUnitLocation)
 {
-	RecoilUnits.Add(FCRRecoilUnit(NextID++, RecoilUnitLocation));
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+	const int32 NewIndex = RecoilUnits.Add(FCRRecoilUnit(NextID++, RecoilUnitLocation));
+	MarkUnitsModified();
+
+	// Appending doesn't shift anything, so a clean map can be kept up to date
+	if (!bUnitIndexByIDDirty)
+	{
+		UnitIndexByID.Add(NextID - 1, NewIndex);
+	}
+
 	return NextID - 1;
 }
 
 void UCRRecoilUnitGraph::RemoveUnit(const uint32 ID)
 {
 	RecoilUnits.RemoveAll([ID](const FCRRecoilUnit& Unit) { return Unit.ID == ID; });
+	MarkUnitsModified();
+	InvalidateUnitIndexByID();
+
+	if (RecoilUnits.Num() == 0)
+	{
+		NextID = 0;
+	}
+}
+
+void UCRRecoilUnitGraph::RemoveUnits(TConstArrayView<uint32> IDs)
+{
+	if (IDs.Num() == 0)
+	{
+		return;
+	}
+
+	TSet<uint32> IDsToRemove;
+	IDsToRemove.Reserve(IDs.Num());
+	IDsToRemove.Append(IDs);
+
+	// RemoveAll compacts in a single pass and keeps the order of the remaining units
+	RecoilUnits.RemoveAll([&IDsToRemove](const FCRRecoilUnit& Unit) { return IDsToRemove.Contains(Unit.ID); });
+	MarkUnitsModified();
+	InvalidateUnitIndexByID();
 
 	if (RecoilUnits.Num() == 0)
 	{
@@ -29,9 +104,42 @@ void UCRRecoilUnitGraph::RemoveUnit(const uint32 ID)
 	}
 }
 
+void UCRRecoilUnitGraph::ClearUnits()
+{
+	RecoilUnits.Reset();
+	NextID = 0;
+	MarkUnitsModified();
+	InvalidateUnitIndexByID();
+}
+
 FCRRecoilUnit* UCRRecoilUnitGraph::GetUnitByID(uint32 ID)
 {
-	return RecoilUnits.FindByPredicate([ID](const FCRRecoilUnit& Unit) { return Unit.ID == ID; });
+	const int32 Index = GetUnitIndexByID(ID);
+	return Index != INDEX_NONE ? &RecoilUnits[Index] : nullptr;
+}
+
+int32 UCRRecoilUnitGraph::GetUnitIndexByID(const uint32 ID) const
+{
+	if (bUnitIndexByIDDirty)
+	{
+		RebuildUnitIndexByID();
+	}
+
+	// GetRecoilUnits hands out the array itself, so verify the hit and fall back to a rebuild if someone reordered it
+	const int32* Index = UnitIndexByID.Find(ID);
+	if (Index && RecoilUnits.IsValidIndex(*Index) && RecoilUnits[*Index].ID == ID)
+	{
+		return *Index;
+	}
+
+	if (!Index && UnitIndexByID.Num() == RecoilUnits.Num())
+	{
+		return INDEX_NONE;
+	}
+
+	RebuildUnitIndexByID();
+	Index = UnitIndexByID.Find(ID);
+	return Index ? *Index : INDEX_NONE;
 }
 
 TArray<FCRRecoilUnit>& UCRRecoilUnitGraph::GetRecoilUnits()
@@ -41,23 +149,165 @@ TArray<FCRRecoilUnit>& UCRRecoilUnitGraph::GetRecoilUnits()
 
 void UCRRecoilUnitGraph::RearrangeUnits()
 {
-	constexpr float PositionTolerance = 0.001f;
+	const FUnitOrderPredicate SortPredicate(RearrangePolicy);
+
+	// Called on every mouse move while dragging, most of which don't change the order
+	if (Algo::IsSorted(RecoilUnits, SortPredicate))
+	{
+		return;
+	}
+
+	InvalidateUnitIndexByID();
+	Algo::Sort(RecoilUnits, SortPredicate);
+}
+
+int32 UCRRecoilUnitGraph::AddUnitSorted(const FVector2f& RecoilUnitLocation)
+{
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+	const FUnitOrderPredicate SortPredicate(RearrangePolicy);
+	const FCRRecoilUnit NewUnit(NextID++, RecoilUnitLocation);
+
+	// The new ID is the largest, so it lands after every unit it ties with, exactly where a full sort would put it
+	const int32 InsertIndex = Algo::UpperBound(RecoilUnits, NewUnit, SortPredicate);
+	RecoilUnits.Insert(NewUnit, InsertIndex);
+
+	MarkUnitsModified();
+	InvalidateUnitIndexByID();
+	checkSlow(Algo::IsSorted(RecoilUnits, SortPredicate));
+	return NewUnit.ID;
+}
+
+int32 UCRRecoilUnitGraph::AddUnitsSorted(TConstArrayView<FVector2f> RecoilUnitLocations)
+{
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+	const FUnitOrderPredicate SortPredicate(RearrangePolicy);
+	const int32 FirstID = NextID;
+
+	TArray<FCRRecoilUnit> NewUnits;
+	NewUnits.Reserve(RecoilUnitLocations.Num());
+	for (const FVector2f& Location : RecoilUnitLocations)
+	{
+		NewUnits.Add(FCRRecoilUnit(NextID++, Location));
+	}
+	Algo::Sort(NewUnits, SortPredicate);
+
+	// The existing units are already ordered, so a single merge pass is enough
+	TArray<FCRRecoilUnit> MergedUnits;
+	MergedUnits.Reserve(RecoilUnits.Num() + NewUnits.Num());
+
+	int32 ExistingIndex = 0;
+	int32 NewIndex = 0;
+	while (ExistingIndex < RecoilUnits.Num() && NewIndex < NewUnits.Num())
+	{
+		// Ties go to the existing unit, its ID is smaller
+		if (SortPredicate(NewUnits[NewIndex], RecoilUnits[ExistingIndex]))
+		{
+			MergedUnits.Add(NewUnits[NewIndex++]);
+		}
+		else
+		{
+			MergedUnits.Add(RecoilUnits[ExistingIndex++]);
+		}
+	}
+	MergedUnits.Append(RecoilUnits.GetData() + ExistingIndex, RecoilUnits.Num() - ExistingIndex);
+	MergedUnits.Append(NewUnits.GetData() + NewIndex, NewUnits.Num() - NewIndex);
+	RecoilUnits = MoveTemp(MergedUnits);
+
+	MarkUnitsModified();
+	InvalidateUnitIndexByID();
+	checkSlow(Algo::IsSorted(RecoilUnits, SortPredicate));
+	return FirstID;
+}
+
+void UCRRecoilUnitGraph::RepairUnitOrder()
+{
+	const FUnitOrderPredicate SortPredicate(RearrangePolicy);
+	bool bOrderChanged = false;
 
-	const bool bByY = RearrangePolicy == ECRRecoilUnitGraphRearrangePolicy::AscendByY || RearrangePolicy == ECRRecoilUnitGraphRearrangePolicy::DescendByY;
-	const bool bAscend = RearrangePolicy == ECRRecoilUnitGraphRearrangePolicy::AscendByY || RearrangePolicy == ECRRecoilUnitGraphRearrangePolicy::AscendByX;
+	// Insertion sort: linear on an ordered array, and a moved unit only shifts past the units it crossed
+	for (int32 Index = 1; Index < RecoilUnits.Num(); ++Index)
+	{
+		if (!SortPredicate(RecoilUnits[Index], RecoilUnits[Index - 1]))
+		{
+			continue;
+		}
+
+		const FCRRecoilUnit MovedUnit = RecoilUnits[Index];
+		int32 TargetIndex = Index;
+		while (TargetIndex > 0 && SortPredicate(MovedUnit, RecoilUnits[TargetIndex - 1]))
+		{
+			RecoilUnits[TargetIndex] = RecoilUnits[TargetIndex - 1];
+			--TargetIndex;
+		}
+		RecoilUnits[TargetIndex] = MovedUnit;
+		bOrderChanged = true;
+	}
 
-	Algo::Sort(RecoilUnits, [bByY, bAscend](const FCRRecoilUnit& A, const FCRRecoilUnit& B)
+	if (bOrderChanged)
 	{
-		const float ValueA = bByY ? A.Position.Y : A.Position.X;
-		const float ValueB = bByY ? B.Position.Y : B.Position.X;
+		InvalidateUnitIndexByID();
+	}
+	checkSlow(Algo::IsSorted(RecoilUnits, SortPredicate));
+}
+
+bool UCRRecoilUnitGraph::IsInRearrangeOrder() const
+{
+	return Algo::IsSorted(RecoilUnits, FUnitOrderPredicate(RearrangePolicy));
+}
+
+uint32 UCRRecoilUnitGraph::GetNextID() const
+{
+	return NextID;
+}
+
+void UCRRecoilUnitGraph::RestoreUnits(TConstArrayView<uint32> IDsToRemove, TConstArrayView<TPair<int32, FCRRecoilUnit>> IndexedUnits, const uint32 InNextID)
+{
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+	TSet<uint32> RemovedIDs;
+	RemovedIDs.Append(IDsToRemove);
 
-		if (!FMath::IsNearlyEqual(ValueA, ValueB, PositionTolerance))
+	TArray<FCRRecoilUnit> RestoredUnits;
+	RestoredUnits.Reserve(RecoilUnits.Num() - RemovedIDs.Num() + IndexedUnits.Num());
+
+	int32 SourceIndex = 0;
+	const auto CopyKeptUnitsUntil = [&](const int32 TargetNum)
+	{
+		while (RestoredUnits.Num() < TargetNum && SourceIndex < RecoilUnits.Num())
 		{
-			return bAscend ? ValueA < ValueB : ValueA > ValueB;
+			const FCRRecoilUnit& Unit = RecoilUnits[SourceIndex++];
+			if (!RemovedIDs.Contains(Unit.ID))
+			{
+				RestoredUnits.Add(Unit);
+			}
 		}
+	};
+
+	for (const TPair<int32, FCRRecoilUnit>& IndexedUnit : IndexedUnits)
+	{
+		CopyKeptUnitsUntil(IndexedUnit.Key);
+		RestoredUnits.Add(IndexedUnit.Value);
+	}
+	CopyKeptUnitsUntil(MAX_int32);
 
-		return A.ID < B.ID;
-	});
+	RecoilUnits = MoveTemp(RestoredUnits);
+	NextID = InNextID;
+	MarkUnitsModified();
+	InvalidateUnitIndexByID();
+}
+
+uint32 UCRRecoilUnitGraph::GetUnitOrderRevision() const
+{
+	return UnitOrderRevision;
+}
+
+uint32 UCRRecoilUnitGraph::GetUnitsRevision() const
+{
+	return UnitsRevision;
+}
+
+void UCRRecoilUnitGraph::MarkUnitsModified()
+{
+	++UnitsRevision;
 }
 
 void UCRRecoilUnitGraph::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
@@ -66,46 +316,73 @@ void UCRRecoilUnitGraph::PostEditChangeProperty(FPropertyChangedEvent& PropertyC
 
 	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_STRING_VIEW_CHECKED(UCRRecoilUnitGraph, RecoilUnits))
 	{
+		MarkUnitsModified();
+		InvalidateUnitIndexByID();
+
 		if (RecoilUnits.Num() == 0)
 		{
 			NextID = 0;
 			return;
 		}
 
-		// Process in reverse order to fix duplicate IDs
-		// Example: [0, 1, 2, 3, 3] becomes [0, 1, 2, 3, 4]
-		for (int32 i = RecoilUnits.Num() - 1; i >= 0; --i)
+		// Ensure NextID is higher than all existing IDs, so reassigned IDs can't collide with later units
+		for (const FCRRecoilUnit& Unit : RecoilUnits)
 		{
-			FCRRecoilUnit& Unit = RecoilUnits[i];
-
-			// Check if this ID is a duplicate (appears earlier in the array)
-			bool bIsDuplicate = false;
-			for (int32 j = 0; j < i; ++j)
+			if (Unit.ID >= NextID)
 			{
-				if (RecoilUnits[j].ID == Unit.ID)
-				{
-					bIsDuplicate = true;
-					break;
-				}
+				NextID = Unit.ID + 1;
 			}
+		}
+
+		// The first occurrence of an ID keeps it, later ones get a new unique ID
+		// Example: [0, 1, 2, 3, 3] becomes [0, 1, 2, 3, 4]
+		TSet<uint32> SeenIDs;
+		SeenIDs.Reserve(RecoilUnits.Num());
+		for (FCRRecoilUnit& Unit : RecoilUnits)
+		{
+			bool bIsDuplicate = false;
+			SeenIDs.Add(Unit.ID, &bIsDuplicate);
 
-			// If duplicate, assign a new unique ID
 			if (bIsDuplicate)
 			{
 				Unit.ID = NextID++;
+				SeenIDs.Add(Unit.ID);
 			}
 		}
 
-		// Ensure NextID is higher than all existing IDs
-		for (const FCRRecoilUnit& Unit : RecoilUnits)
+		RearrangeUnits();
+	}
+}
+
+void UCRRecoilUnitGraph::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// Undo replaces the whole unit array
+	MarkUnitsModified();
+	InvalidateUnitIndexByID();
+}
+
+void UCRRecoilUnitGraph::InvalidateUnitIndexByID() const
+{
+	bUnitIndexByIDDirty = true;
+	++UnitOrderRevision;
+}
+
+void UCRRecoilUnitGraph::RebuildUnitIndexByID() const
+{
+	UnitIndexByID.Reset();
+	UnitIndexByID.Reserve(RecoilUnits.Num());
+
+	for (int32 Index = 0; Index < RecoilUnits.Num(); ++Index)
+	{
+		// Keeps the first occurrence, matching the old linear search while duplicate IDs wait to be repaired
+		if (!UnitIndexByID.Contains(RecoilUnits[Index].ID))
 		{
-			if (Unit.ID >= NextID)
-			{
-				NextID = Unit.ID + 1;
-			}
+			UnitIndexByID.Add(RecoilUnits[Index].ID, Index);
 		}
-
-		RearrangeUnits();
 	}
+
+	bUnitIndexByIDDirty = false;
 }
 #endif
@@ -0,0 +1,145 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Subsystems/CRRecoilTickSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Components/CRRecoilComponent.h"
+#include "CrystalRecoil.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Batched Recoil Tick"), STAT_CRBatchedRecoilTick, STATGROUP_CrystalRecoil);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Recoil Components"), STAT_CRBatchedRecoilComponents, STATGROUP_CrystalRecoil);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Recoil Components"), STAT_CRDeferredRecoilComponents, STATGROUP_CrystalRecoil);
+
+namespace
+{
+	// Below this many components per worker the task overhead outweighs the recoil math
+	constexpr int32 MinParallelBatchSize = 16;
+}
+
+void FCRRecoilTickSubsystemTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	// Component ticks don't run when only viewports update either
+	if (Subsystem && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Subsystem->Tick(DeltaTime);
+	}
+}
+
+FString FCRRecoilTickSubsystemTickFunction::DiagnosticMessage()
+{
+	return TEXT("UCRRecoilTickSubsystem[Tick]");
+}
+
+void UCRRecoilTickSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TickFunction.Subsystem = this;
+	TickFunction.TickGroup = TG_PrePhysics;
+	TickFunction.bCanEverTick = true;
+	TickFunction.bStartWithTickEnabled = true;
+	TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UCRRecoilTickSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+	TickFunction.Subsystem = nullptr;
+
+	Super::Deinitialize();
+}
+
+void UCRRecoilTickSubsystem::RegisterComponent(UCRRecoilComponent* Component)
+{
+	if (!Component || Component->bRegisteredWithTickSubsystem)
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+	RegisteredComponents.Add(Component);
+
+	Component->bRecoilTickActive = Component->IsComponentTickEnabled();
+	Component->bRegisteredWithTickSubsystem = true;
+	Component->SetComponentTickEnabled(false);
+}
+
+void UCRRecoilTickSubsystem::UnregisterComponent(UCRRecoilComponent* Component)
+{
+	if (!Component || !Component->bRegisteredWithTickSubsystem)
+	{
+		return;
+	}
+
+	RegisteredComponents.RemoveSingleSwap(Component);
+
+	Component->bRegisteredWithTickSubsystem = false;
+	Component->SetComponentTickEnabled(Component->bRecoilTickActive);
+}
+
+void UCRRecoilTickSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_CRBatchedRecoilTick);
+	LLM_SCOPE_BYTAG(CrystalRecoil);
+
+	ActiveComponents.Reset();
+	int32 NumDeferred = 0;
+
+	// Game thread: read controller rotations and pattern parameters
+	for (UCRRecoilComponent* Component : RegisteredComponents)
+	{
+		if (!IsValid(Component) || !Component->bRecoilTickActive)
+		{
+			continue;
+		}
+
+		// Match the DeltaTime the component's own tick function would have received
+		const AActor* Owner = Component->GetOwner();
+		float ComponentDeltaTime = Owner ? DeltaTime * Owner->CustomTimeDilation : DeltaTime;
+
+		// Low significance components skip frames until their update interval is reached
+		if (!Component->ConsumeRecoilDeltaTime(ComponentDeltaTime))
+		{
+			++NumDeferred;
+			continue;
+		}
+
+		Component->BeginRecoilTick(ComponentDeltaTime);
+		ActiveComponents.Add(Component);
+	}
+
+	const int32 NumActive = ActiveComponents.Num();
+	SET_DWORD_STAT(STAT_CRBatchedRecoilComponents, NumActive);
+	SET_DWORD_STAT(STAT_CRDeferredRecoilComponents, NumDeferred);
+
+	if (NumActive == 0)
+	{
+		return;
+	}
+
+	// Uplift and recovery are split in two passes because recovery depends on what the uplift hooks accepted
+	ParallelFor(TEXT("CRRecoilSimulateUplift"), NumActive, MinParallelBatchSize, [this](const int32 Index)
+	{
+		ActiveComponents[Index]->SimulateRecoilUplift();
+	});
+
+	for (UCRRecoilComponent* Component : ActiveComponents)
+	{
+		Component->CommitRecoilUplift();
+	}
+
+	ParallelFor(TEXT("CRRecoilSimulateRecovery"), NumActive, MinParallelBatchSize, [this](const int32 Index)
+	{
+		ActiveComponents[Index]->SimulateRecoilRecovery();
+	});
+
+	for (UCRRecoilComponent* Component : ActiveComponents)
+	{
+		Component->CommitRecoilRecovery();
+		Component->PublishPoseOutput();
+	}
+}
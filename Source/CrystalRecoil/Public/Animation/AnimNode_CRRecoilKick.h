@@ -0,0 +1,62 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BoneControllers/AnimNode_SkeletalControlBase.h"
+#include "AnimNode_CRRecoilKick.generated.h"
+
+class FCRRecoilPoseBuffer;
+class UCRRecoilComponent;
+
+/**
+* Applies procedural weapon kick to a bone from the recoil of the owning actor's UCRRecoilComponent.
+* The component's pose buffer is looked up on the game thread, again whenever the component is replaced; evaluation only reads the buffer,
+* so the node runs on animation worker threads without touching UObjects or waiting on the game thread.
+*/
+USTRUCT(BlueprintInternalUseOnly)
+struct CRYSTALRECOIL_API FAnimNode_CRRecoilKick : public FAnimNode_SkeletalControlBase
+{
+	GENERATED_BODY()
+
+	// Bone that receives the kick, usually the weapon or hand IK bone
+	UPROPERTY(EditAnywhere, Category = "Kick")
+	FBoneReference KickBone;
+
+	// Bone space pitch per degree of vertical recoil
+	UPROPERTY(EditAnywhere, Category = "Kick")
+	float PitchPerDegree = 1.f;
+
+	// Bone space yaw per degree of horizontal recoil
+	UPROPERTY(EditAnywhere, Category = "Kick")
+	float YawPerDegree = 1.f;
+
+	// Bone space offset per degree of total recoil, e.g. negative X pushes the weapon back into the shoulder
+	UPROPERTY(EditAnywhere, Category = "Kick")
+	FVector TranslationPerDegree = FVector(-0.5, 0.0, 0.0);
+
+	// Recoil beyond this many degrees doesn't move the bone any further
+	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.f, ForceUnits = "deg"), Category = "Kick")
+	float MaxKickDegrees = 10.f;
+
+	// FAnimNode_Base interface
+	virtual bool HasPreUpdate() const override { return true; }
+
+	virtual void PreUpdate(const UAnimInstance* InAnimInstance) override;
+	// End of FAnimNode_Base interface
+
+	// FAnimNode_SkeletalControlBase interface
+	virtual void EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms) override;
+
+	virtual bool IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones) override;
+	// End of FAnimNode_SkeletalControlBase interface
+
+private:
+	virtual void InitializeBoneReferences(const FBoneContainer& RequiredBones) override;
+
+	// Component PoseBuffer came from, so a swapped weapon or respawned owner is picked up instead of reading a stale buffer
+	TWeakObjectPtr<const UCRRecoilComponent> RecoilComponent;
+
+	// Shared with the recoil component, so it stays valid even if the component goes away mid-evaluation
+	TSharedPtr<const FCRRecoilPoseBuffer, ESPMode::ThreadSafe> PoseBuffer;
+};
@@ -0,0 +1,37 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Recoil values animation reads to drive procedural weapon kick
+struct FCRRecoilPoseOutput
+{
+	// Kick applied to the aim and not recovered yet, in pattern space (X = right, Y = up) and degrees
+	FVector2f Kick = FVector2f::ZeroVector;
+
+	// Incremented once per shot, lets nodes trigger per shot impulses
+	uint32 ShotCount = 0;
+};
+
+/**
+* Double-buffered recoil output, written once per recoil tick on the game thread and read from animation worker threads.
+* Publish fills the slot readers aren't pointed at and then flips the published index, so neither side ever blocks.
+* A read that overlaps a publish into its own slot is detected by the publish counter and simply retried.
+*/
+class CRYSTALRECOIL_API FCRRecoilPoseBuffer
+{
+public:
+	// Game thread only
+	void Publish(const FCRRecoilPoseOutput& Output);
+
+	// Any thread
+	FCRRecoilPoseOutput Read() const;
+
+private:
+	FCRRecoilPoseOutput Slots[2];
+
+	// Number of publishes so far, the latest output lives in Slots[PublishCount & 1]
+	std::atomic<uint32> PublishCount = 0;
+};
@@ -0,0 +1,46 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CRRecoilMotion.h"
+
+/**
+* Adapter between the engine-independent CrystalRecoilCore value types and their engine counterparts.
+* Only pitch and yaw exist on the core side, so roll never round-trips through it.
+*/
+namespace CrystalRecoil
+{
+	inline FCRRecoilRotation ToCore(const FRotator& Rotation)
+	{
+		return FCRRecoilRotation(Rotation.Pitch, Rotation.Yaw);
+	}
+
+	inline FCRRecoilVector ToCore(const FVector2f& Vector)
+	{
+		return FCRRecoilVector(Vector.X, Vector.Y);
+	}
+
+	// Ranges are authored as FVector2D(Min, Max)
+	inline FCRRecoilRange ToCoreRange(const FVector2D& Range)
+	{
+		return FCRRecoilRange{ static_cast<float>(Range.X), static_cast<float>(Range.Y) };
+	}
+
+	inline FRotator ToRotator(const FCRRecoilRotation& Rotation)
+	{
+		return FRotator(Rotation.Pitch, Rotation.Yaw, 0.0);
+	}
+
+	inline FVector2f ToVector2f(const FCRRecoilVector& Vector)
+	{
+		return FVector2f(Vector.X, Vector.Y);
+	}
+
+	// CrystalRecoilCore::ApplyToControlRotation for a full control rotation, roll is kept (normalized like the other axes)
+	inline FRotator ApplyToControlRotation(const FRotator& ControlRotation, const FRotator& Input)
+	{
+		const FCRRecoilRotation Applied = CrystalRecoilCore::ApplyToControlRotation(ToCore(ControlRotation), ToCore(Input));
+		return FRotator(Applied.Pitch, Applied.Yaw, FRotator::NormalizeAxis(ControlRotation.Roll));
+	}
+}
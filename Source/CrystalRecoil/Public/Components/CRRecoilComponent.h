@@ -4,10 +4,133 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
+#include "CRRecoilMotion.h"
+#include "Animation/CRRecoilPoseBuffer.h"
+#include "Data/CRRecoilModifier.h"
 #include "CRRecoilComponent.generated.h"
 
 class UCRRecoilPattern;
 
+/**
+* Plain copy of the transient recoil state of a UCRRecoilComponent.
+* Holds no object references or containers, so it can be copied, stored and compared freely by rollback/prediction layers.
+* The controller rotation itself is not part of the snapshot - the rollback layer owns and restores it.
+*/
+struct FCRRecoilStateSnapshot
+{
+	// Pattern blends a snapshot can hold, UCRRecoilComponent::SetPatternBlendWeight blends at most this many patterns
+	static constexpr int32 MaxPatternBlends = 8;
+
+	struct FPatternBlend
+	{
+		// Weak key, a pattern that was garbage collected since is skipped on restore
+		TObjectKey<UCRRecoilPattern> Pattern;
+		float TargetWeight = 0.f;
+		float Weight = 0.f;
+	};
+
+	// Frame this snapshot was recorded for, INDEX_NONE if the slot was never written
+	int32 Frame = INDEX_NONE;
+
+	int32 CurrentShotIndex = 0;
+	float CurrentShotPosition = 0.f;
+
+	// Time indexed shots fired since the last recoil tick, which consumes them
+	int32 PendingTimeIndexedShots = 0;
+
+	// Drawn from by the Random pattern end behavior, restoring it replays the same random shots
+	FCRRecoilRandomStream RandomStream;
+
+	FPatternBlend PatternBlends[MaxPatternBlends];
+	int32 NumPatternBlends = 0;
+	double LastPatternBlendUpdateTime = 0.0;
+
+	// The recoil modifier stack as compiled when the snapshot was taken, see UCRRecoilComponent::RestoreState
+	FCRCompiledRecoilModifiers RecoilModifiers;
+
+	FCRRecoilRotation RecoilToApply;
+	float CurrentRecoilSpeed = 0.f;
+	float CurrentUpliftDeceleration = 0.f;
+
+	FCRRecoilRotation RecoilToRecover;
+	float CurrentRecoverySpeed = 0.f;
+	float LastFireTime = 0.f;
+
+	bool bTrackingInputDuringFire = false;
+	FCRRecoilRotation AccumulatedInputDuringFire;
+
+	FCRRecoilRotation SpringOffset;
+	FCRRecoilRotation SpringVelocity;
+	float SpringTime = 0.f;
+
+	FRotator RecoilInputGeneratedLastFrame = FRotator::ZeroRotator;
+	FRotator CachedControllerRotation = FRotator::ZeroRotator;
+
+	// Frame time deferred by low significance updates that hasn't been simulated yet
+	float PendingRecoilDeltaTime = 0.f;
+
+	// Only used by UCRRecoilSpreadComponent
+	float RecoilHeat = 0.f;
+
+	// Whether the component was ticking (i.e. had pending recoil work) when the snapshot was taken
+	bool bTickEnabled = false;
+};
+
+// How closely a shooter's recoil has to follow the frame rate, see UCRRecoilComponent::SetRecoilSignificance
+UENUM(BlueprintType)
+enum class ECRRecoilSignificance : uint8
+{
+	// Updated every frame, e.g. the local player or the player a spectator is watching
+	High,
+
+	// Updated every LowSignificanceUpdateInterval seconds, e.g. shooters nobody is looking through
+	Low
+};
+
+/**
+* Scratch data for a single recoil tick.
+* Filled by BeginRecoilTick on the game thread, then read and written by the simulate phases (which may run on a worker thread)
+* and consumed by the commit phases back on the game thread.
+*/
+struct FCRRecoilTickContext
+{
+	AController* Controller = nullptr;
+
+	float DeltaTime = 0.f;
+	double WorldTime = 0.0;
+
+	// Copied from the recoil pattern so the simulate phases don't touch UObjects
+	FCRRecoilMotionSettings MotionSettings;
+
+	FRotator InputLastFrame = FRotator::ZeroRotator;
+	FRotator DeltaRecoilRotation = FRotator::ZeroRotator;
+	FRotator DeltaRecoveryRotation = FRotator::ZeroRotator;
+
+	ECRRecoilRecoveryStep RecoveryStep = ECRRecoilRecoveryStep::None;
+
+	// False if the world, controller or pattern was missing - all other phases are skipped
+	bool bValid = false;
+
+	bool bHasUplift = false;
+};
+
+// A pattern blended over the component's recoil pattern, see UCRRecoilComponent::SetPatternBlendWeight
+USTRUCT()
+struct FCRRecoilPatternBlendEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UCRRecoilPattern> Pattern;
+
+	// Weight the entry is smoothed towards
+	float TargetWeight = 0.f;
+
+	// Weight used for the next shot
+	float Weight = 0.f;
+};
+
 UCLASS(ClassGroup = (CrystalRecoil), Meta = (BlueprintSpawnableComponent), DisplayName = "Recoil Component")
 class CRYSTALRECOIL_API UCRRecoilComponent : public UActorComponent
 {
@@ -15,6 +138,10 @@ class CRYSTALRECOIL_API UCRRecoilComponent : public UActorComponent
 public:
 	UCRRecoilComponent();
 
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	/**
@@ -36,17 +163,47 @@ public:
 	/**
 	* Applies recoil for a single shot.
 	* Call each time a bullet is fired.
+	* Time indexed patterns advance by the time since the previous shot instead of a whole unit, see ERecoilPatternIndexing.
+	* Their shots are consumed by the next recoil tick, which spreads the elapsed time evenly across all shots fired since the last one.
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Recoil Component")
 	virtual void ApplyShot();
 
+	/**
+	* Applies recoil for a fraction (or multiple) of a shot, interpolating between pattern units.
+	* Use for weapons whose shots don't map to whole pattern units, e.g. a burst counting as half a unit per bullet
+	* or a charge weapon advancing by its charge level.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component")
+	virtual void ApplyShotAdvance(const float ShotAdvance);
+
 	/**
 	* Assigns the recoil pattern to use for this component.
-	* Call before StartShooting.
+	* Call before StartShooting. Blended patterns whose indexing doesn't match the new pattern are dropped.
 	*/
 	UFUNCTION(BlueprintCallable, Meta = (AllowAbstract = false), Category = "Recoil Component")
 	void SetRecoilPattern(UCRRecoilPattern* InRecoilPattern);
 
+	/**
+	* Blends another pattern into the recoil of each shot, e.g. an ADS, crouch or attachment variant of the current pattern.
+	* Shot deltas are the weighted sum of all blended patterns at the current shot; the recoil pattern set by SetRecoilPattern
+	* gets the weight left over (1 - total weight), and weights totaling more than 1 are normalized.
+	* Weights move towards their target at PatternBlendSpeed and the shot index is kept, so stance changes mid spray don't reset the pattern.
+	* Uplift and recovery parameters always come from the recoil pattern. A weight of 0 removes the pattern once it has blended out.
+	* InPattern must use the same PatternIndexing as the recoil pattern, mixed shot and time indexed blends are rejected.
+	* At most FCRRecoilStateSnapshot::MaxPatternBlends patterns can be blended at once, so snapshots stay fixed size.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component|Blending")
+	void SetPatternBlendWeight(UCRRecoilPattern* InPattern, const float InWeight, const bool bInstant = false);
+
+	/** Returns the current (smoothed) blend weight of a pattern, 0 if it isn't blended */
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component|Blending")
+	float GetPatternBlendWeight(const UCRRecoilPattern* InPattern) const;
+
+	/** Removes all blended patterns at once, leaving only the recoil pattern */
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component|Blending")
+	void ClearPatternBlend();
+
 	/**
 	* Scales all recoil magnitudes.
 	* 1.0 = full strength, 0.5 = half, 0.0 = no recoil
@@ -58,9 +215,155 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Recoil Component")
 	float GetRecoilStrength() const;
 
+	/**
+	* Reseeds the stream the Random pattern end behavior draws from, which BeginPlay seeds randomly.
+	* Give predicting clients and the server the same seed so they draw the same random shots.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component")
+	void SetRandomSeed(const int32 InSeed);
+
+	/**
+	* Adds a modifier to the recoil modifier stack, e.g. when an attachment is equipped or a buff starts.
+	* The stack is folded into a single transform the next time it is used, so the per shot cost doesn't grow with the stack.
+	* Returns a handle for RemoveRecoilModifier.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component|Modifiers")
+	int32 AddRecoilModifier(const FCRRecoilModifier& InModifier);
+
+	/** Removes a modifier added by AddRecoilModifier. Returns false if the handle is not in the stack */
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component|Modifiers")
+	bool RemoveRecoilModifier(const int32 ModifierHandle);
+
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component|Modifiers")
+	void ClearRecoilModifiers();
+
+	/**
+	* Sets how often the recoil of this shooter is updated.
+	* Low significance updates collect the frame time and simulate it every LowSignificanceUpdateInterval seconds.
+	* The component's tick interval is raised to match, so skipped frames don't run the tick function at all.
+	* Raising the significance (or firing a shot) first simulates the deferred time, so the state is current again right away,
+	* e.g. when a spectator switches to this player. Call it from your significance or relevancy logic.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component|Performance")
+	void SetRecoilSignificance(const ECRRecoilSignificance InSignificance);
+
+	UFUNCTION(BlueprintCallable, Category = "Recoil Component|Performance")
+	ECRRecoilSignificance GetRecoilSignificance() const;
+
+	/**
+	* Copies the transient recoil state into OutSnapshot.
+	* Override in subclasses that add state of their own, and call Super.
+	*/
+	virtual void SaveState(FCRRecoilStateSnapshot& OutSnapshot) const;
+
+	/**
+	* Overwrites the transient recoil state with a previously saved snapshot.
+	* Also restores whether the component is ticking, so a rolled back component resumes exactly where it was.
+	* The modifier stack itself is left alone, the restored compiled modifiers apply until the stack is changed again.
+	*/
+	virtual void RestoreState(const FCRRecoilStateSnapshot& Snapshot);
+
+	/**
+	* Saves the current state into the history ring buffer, tagged with Frame.
+	* The slot is picked as Frame modulo StateHistorySize, so recording never allocates and older frames are overwritten.
+	*/
+	void RecordStateSnapshot(const int32 Frame);
+
+	/**
+	* Restores the state recorded for Frame.
+	* Returns false if that frame is no longer (or was never) in the history.
+	*/
+	bool RestoreStateSnapshot(const int32 Frame);
+
+	/** Returns the snapshot recorded for Frame, or nullptr if it is no longer in the history */
+	const FCRRecoilStateSnapshot* FindStateSnapshot(const int32 Frame) const;
+
+	/**
+	* Returns the recoil output published for animation once per recoil tick.
+	* Reading it is safe from any thread, so anim nodes can hold on to it and read it during parallel evaluation.
+	*/
+	TSharedRef<const FCRRecoilPoseBuffer, ESPMode::ThreadSafe> GetPoseBuffer() const;
+
 protected:
+	friend class UCRRecoilTickSubsystem;
+
+	/**
+	* Recoil tick phases. TickComponent runs them back to back; UCRRecoilTickSubsystem runs each phase for all
+	* batched components before moving on, with the Simulate phases spread across worker threads.
+	*
+	* Begin*  - game thread: reads the controller rotation and caches pattern parameters into TickContext
+	* Simulate* - any thread: pure math on this component's own state, must not touch other objects
+	* Commit* - game thread: runs the Process* hooks, writes to the controller and enables/disables the tick
+	*
+	* Subclasses adding per-tick work should override the matching phase and call Super.
+	*/
+	bool BeginRecoilTick(const float DeltaTime);
+
+	/**
+	* Adds DeltaTime to the deferred frame time and decides whether recoil should be updated this frame.
+	* Returns false while a low significance update is still waiting, otherwise InOutDeltaTime is the time to simulate.
+	* Only batched components wait here, the component's own tick function is throttled by its tick interval instead.
+	*/
+	bool ConsumeRecoilDeltaTime(float& InOutDeltaTime);
+
+	// Runs all recoil tick phases back to back on the game thread
+	void UpdateRecoil(const float DeltaTime);
+
+	// Simulates frame time deferred by low significance updates right away
+	void FlushPendingRecoil();
+
+	// Publishes the current recoil to the pose buffer, called after each recoil tick
+	void PublishPoseOutput();
+
+	virtual void SimulateRecoilUplift();
+
+	virtual void CommitRecoilUplift();
+
+	virtual void SimulateRecoilRecovery();
+
+	virtual void CommitRecoilRecovery();
+
+	/**
+	* Starts or stops recoil updates.
+	* Toggles the component tick, or the batched update flag when the component is driven by UCRRecoilTickSubsystem.
+	*/
+	void SetRecoilTickEnabled(const bool bEnabled);
+
+	bool IsRecoilTickEnabled() const;
+
 	virtual void ApplyInputToController(AController* InTargetController, const FRotator& Input);
 
+	// Whether shots can currently be applied: a locally controlled target and a recoil pattern are required
+	bool CanApplyShot() const;
+
+	// Starts the kick of a shot whose pattern delta was already consumed, scaled by RecoilStrength
+	void BeginShot(const FVector2f& PatternDelta, const double ShotTime);
+
+	// Consumes one shot from the recoil pattern and the blended patterns and starts its kick, fired at ShotTime
+	void ConsumePatternShot(const double ShotTime);
+
+	/**
+	* Consumes the time indexed shots queued by ApplyShot, on the game thread at the start of a recoil tick
+	* Shot times are interpolated between the previous shot and WorldTime like UCRRecoilProcessor does for queued Mass shots,
+	* so several shots within one frame advance the pattern by their share of the frame instead of the first one taking it all
+	*/
+	void ConsumePendingShots(const double WorldTime);
+
+	/**
+	* Mixes the deltas of the blended patterns into BaseDelta, the delta consumed from the recoil pattern
+	* ConsumeBlendedShot consumes the same shot from a blended pattern, without touching the component's shot index
+	*/
+	FVector2f BlendPatternDeltas(const FVector2f& BaseDelta, TFunctionRef<FVector2f(const UCRRecoilPattern&)> ConsumeBlendedShot);
+
+	// Moves the blend weights towards their targets for the time passed since the last update
+	void UpdatePatternBlendWeights();
+
+	// Returns the modifier stack folded into one transform, recompiling it first if it changed
+	const FCRCompiledRecoilModifiers& GetCompiledRecoilModifiers() const;
+
+	// Motion settings of the recoil pattern with the modifier stack applied
+	FCRRecoilMotionSettings GetMotionSettings() const;
+
 	/**
 	* Called before each recoil delta is applied to the controller.
 	* Override in subclasses to intercept or modify the recoil rotation without overriding the entire tick.
@@ -97,27 +400,94 @@ protected:
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Recoil Component")
 	TObjectPtr<UCRRecoilPattern> RecoilPattern;
 
+	/**
+	* Number of frames kept by RecordStateSnapshot for rollback
+	* The buffer is allocated once on BeginPlay. Set to 0 to disable the history
+	*/
+	UPROPERTY(EditDefaultsOnly, Meta = (ClampMin = 0), Category = "Recoil Component|Rollback")
+	int32 StateHistorySize = 0;
+
+	/**
+	* Updates this component from UCRRecoilTickSubsystem instead of its own tick function
+	* The subsystem runs the recoil math of all batched components in parallel and only applies the controller writes on the game thread
+	* Worth enabling when many shooters are simulated at once (bots, soak tests)
+	*/
+	UPROPERTY(EditDefaultsOnly, Category = "Recoil Component|Performance")
+	bool bUseBatchedTick = false;
+
+	/**
+	* Seconds between recoil updates while the significance is Low
+	* The deferred frame time is simulated in one step, so the total uplift is unchanged and recovery converges to the same rest aim
+	*/
+	UPROPERTY(EditDefaultsOnly, Meta = (ClampMin = 0.f, ForceUnits = "s"), Category = "Recoil Component|Performance")
+	float LowSignificanceUpdateInterval = 0.1f;
+
+	/**
+	* How fast pattern blend weights move towards their target, in weight per second
+	* Set to 0 to switch weights instantly
+	*/
+	UPROPERTY(EditDefaultsOnly, Meta = (ClampMin = 0.f), Category = "Recoil Component|Blending")
+	float PatternBlendSpeed = 8.f;
+
+	UPROPERTY(Transient)
+	TArray<FCRRecoilPatternBlendEntry> PatternBlendEntries;
+
+	// World time the blend weights were last smoothed at
+	double LastPatternBlendUpdateTime = 0.0;
+
+	// Recoil modifier stack in the order it was added, RecoilModifierHandles[i] is the handle of RecoilModifiers[i]
+	UPROPERTY(Transient)
+	TArray<FCRRecoilModifier> RecoilModifiers;
+
+	TArray<int32> RecoilModifierHandles;
+
+	int32 NextRecoilModifierHandle = 0;
+
+	mutable FCRCompiledRecoilModifiers CompiledRecoilModifiers;
+
+	mutable bool bRecoilModifiersDirty = false;
+
+	UPROPERTY(Transient)
+	ECRRecoilSignificance RecoilSignificance = ECRRecoilSignificance::High;
+
 	// Recoil strength and index parameters
 	float RecoilStrength = 1.f;
 	int32 CurrentShotIndex = 0;
 
-	// Recoil uplift state
-	FRotator RecoilToApply = FRotator::ZeroRotator;
-	float CurrentRecoilSpeed = 0.f;
-	float CurrentUpliftDeceleration = 0.f;
+	// Fractional position along the pattern, used by time indexed patterns and ApplyShotAdvance
+	float CurrentShotPosition = 0.f;
 
-	// Recovery state
-	FRotator RecoilToRecover = FRotator::ZeroRotator;
-	float CurrentRecoverySpeed = 0.f;
-	float LastFireTime = 0.f;
+	// Time indexed shots applied since the last recoil tick, see ConsumePendingShots
+	int32 PendingTimeIndexedShots = 0;
 
-	// Recovery cancellation tracking
-	bool bTrackingInputDuringFire = false;
-	FRotator AccumulatedInputDuringFire = FRotator::ZeroRotator;
+	// Drawn from by the Random pattern end behavior, seeded in BeginPlay
+	FCRRecoilRandomStream RandomStream;
+
+	// Uplift, recovery and cancellation state, advanced by the CrystalRecoilCore math
+	FCRRecoilMotionState Motion;
 
 	// Input tracking for compensation
 	FRotator RecoilInputGeneratedLastFrame = FRotator::ZeroRotator;
 	FRotator CachedControllerRotation = FRotator::ZeroRotator;
 
+	// Frame time collected while the significance is Low, simulated once it reaches LowSignificanceUpdateInterval
+	float PendingRecoilDeltaTime = 0.f;
+
+	// World time of the last recoil update, lets FlushPendingRecoil catch up between the sparse runs of a throttled tick function
+	double LastRecoilUpdateTime = 0.0;
+
 	mutable TWeakObjectPtr<AController> TargetController;
+
+	FCRRecoilTickContext TickContext;
+
+	// Set while UCRRecoilTickSubsystem drives this component, bRecoilTickActive then replaces the component tick state
+	bool bRegisteredWithTickSubsystem = false;
+	bool bRecoilTickActive = false;
+
+	// Ring buffer of recorded snapshots, indexed by Frame % StateHistorySize
+	TArray<FCRRecoilStateSnapshot> StateHistory;
+
+	TSharedRef<FCRRecoilPoseBuffer, ESPMode::ThreadSafe> PoseBuffer = MakeShared<FCRRecoilPoseBuffer, ESPMode::ThreadSafe>();
+
+	uint32 ShotCount = 0;
 };
@@ -26,8 +26,6 @@ class CRYSTALRECOIL_API UCRRecoilSpreadComponent : public UCRRecoilComponent
 	GENERATED_BODY()
 
 public:
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	/**
 	* Call before each shot to get the current spread angle for projectile direction calculation
 	* Returns 0 if any of the three curves are not set
@@ -36,7 +34,7 @@ public:
 	float GetCurrentSpreadAngle() const;
 
 	/**
-	* Called automatically on each ApplyShot()
+	* Called automatically on each ApplyShot() and ApplyShotAdvance()
 	* Exposed for ability to add extra heat from external sources, e.g. melee hits, abilities, debug cheats
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Spread Recoil Component")
@@ -69,9 +67,17 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Spread Recoil Component")
 	FCRSpreadRecoilHeatChangedDelegate OnHeatChanged;
 
+	virtual void SaveState(FCRRecoilStateSnapshot& OutSnapshot) const override;
+
+	virtual void RestoreState(const FCRRecoilStateSnapshot& Snapshot) override;
+
 protected:
 	virtual void ApplyShot() override;
 
+	virtual void ApplyShotAdvance(const float ShotAdvance) override;
+
+	virtual void CommitRecoilRecovery() override;
+
 	void SetRecoilHeat(const float InHeat);
 
 	void DoHeatCooldown(const float DeltaTime);
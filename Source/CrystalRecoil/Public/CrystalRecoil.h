@@ -2,6 +2,14 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "HAL/LowLevelMemTracker.h"
+
+// Memory tag for recoil patterns and runtime recoil state, shows up as "CrystalRecoil" in LLM reports
+LLM_DECLARE_TAG_API(CrystalRecoil, CRYSTALRECOIL_API);
+
+CRYSTALRECOIL_API DECLARE_LOG_CATEGORY_EXTERN(LogCrystalRecoil, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("CrystalRecoil"), STATGROUP_CrystalRecoil, STATCAT_Advanced);
 
 class FCrystalRecoilModule : public IModuleInterface
 {
@@ -0,0 +1,75 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/TransformCalculus2D.h"
+#include "CRRecoilModifier.generated.h"
+
+struct FCRRecoilMotionSettings;
+
+/**
+* One entry of a recoil modifier stack, contributed by an attachment, buff or stance
+* Added to a recoil component with UCRRecoilComponent::AddRecoilModifier
+*/
+USTRUCT(BlueprintType)
+struct CRYSTALRECOIL_API FCRRecoilModifier
+{
+	GENERATED_BODY()
+
+	/**
+	* Scales the horizontal (X) and vertical (Y) recoil of each shot separately
+	* Example: (0.8, 1.0) for a compensator that only tames horizontal kick
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Recoil Modifier")
+	FVector2D AxisScale = FVector2D::UnitVector;
+
+	// Rotates the recoil of each shot counterclockwise, e.g. a muzzle brake that pulls the climb to one side
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ClampMin = -180.f, ClampMax = 180.f, ForceUnits = "deg"), Category = "Recoil Modifier")
+	float Rotation = 0.f;
+
+	/**
+	* Caps the recoil of a single shot once the whole stack has scaled and rotated it, wherever this modifier sits in the stack
+	* Set to 0 for no cap; only the smallest cap in the stack applies
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ClampMin = 0.f, ForceUnits = "deg"), Category = "Recoil Modifier")
+	float MaxShotRecoil = 0.f;
+
+	// > 1 makes the kick reach its peak faster, < 1 slower
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ClampMin = 0.01f), Category = "Recoil Modifier")
+	float UpliftSpeedMultiplier = 1.f;
+
+	// Scales the recovery speeds and acceleration
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ClampMin = 0.01f), Category = "Recoil Modifier")
+	float RecoveryMultiplier = 1.f;
+
+	// Scales the heat each shot adds, only used by UCRRecoilSpreadComponent
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ClampMin = 0.f), Category = "Recoil Modifier")
+	float HeatMultiplier = 1.f;
+};
+
+/**
+* A whole recoil modifier stack folded into a single transform and parameter block
+* Rebuilt only when the stack changes, so applying it costs the same for one modifier or fifty
+*/
+struct CRYSTALRECOIL_API FCRCompiledRecoilModifiers
+{
+	// Composes the modifiers in stack order: each modifier scales and rotates the output of the previous one, then the smallest cap applies once
+	void Compile(TConstArrayView<FCRRecoilModifier> Modifiers);
+
+	FVector2f ApplyToShotDelta(const FVector2f& ShotDelta) const;
+
+	void ApplyToMotionSettings(FCRRecoilMotionSettings& Settings) const;
+
+	FMatrix2x2f ShotTransform;
+
+	// 0 when no modifier caps the shot recoil
+	float MaxShotRecoil = 0.f;
+
+	float UpliftSpeedMultiplier = 1.f;
+	float RecoveryMultiplier = 1.f;
+	float HeatMultiplier = 1.f;
+
+	// True when the stack is empty or all modifiers are neutral, lets the hot paths skip the transform
+	bool bIdentity = true;
+};
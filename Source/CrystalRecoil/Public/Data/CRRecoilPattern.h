@@ -4,9 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "UObject/ObjectSaveContext.h"
+#include "CRRecoilMotion.h"
+#include "CRRecoilShotSequence.h"
+#include "Data/CRRecoilPatternBakedData.h"
 #include "CRRecoilPattern.generated.h"
 
 class UCRRecoilUnitGraph;
+class FDataValidationContext;
+enum class EDataValidationResult : uint8;
 
 UENUM()
 enum class ERecoilPatternEndBehavior : uint8
@@ -24,6 +30,26 @@ enum class ERecoilPatternEndBehavior : uint8
 	Random
 };
 
+UENUM()
+enum class ERecoilMotionModel : uint8
+{
+	// Constant deceleration kick, then recovery after RecoveryDelay
+	Kinematic,
+
+	// Each shot kicks a damped spring that swings back to the pre-shot aim
+	Spring
+};
+
+UENUM()
+enum class ERecoilPatternIndexing : uint8
+{
+	// Every shot advances the pattern by one unit, regardless of fire rate
+	ShotCount,
+
+	// The pattern advances with firing time, so faster fire rates walk it in smaller steps
+	FiringTime
+};
+
 USTRUCT()
 struct FRecoilPatternRandomizedRecoil
 {
@@ -44,36 +70,123 @@ class CRYSTALRECOIL_API UCRRecoilPattern : public UDataAsset
 public:
 	UCRRecoilPattern();
 
+	virtual void Serialize(FArchive& Ar) override;
+
+	virtual void PostLoad() override;
+
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+
+	virtual void BeginDestroy() override;
+
+	#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+	#endif
+
 	UCRRecoilUnitGraph* GetUnitGraph() const;
 
+	/**
+	* Checks the pattern for data that would misbehave at runtime and appends a message per problem
+	* Only reads the asset, so it is safe to run on worker threads for many patterns at once
+	* Returns true if no problems were found
+	*/
+	bool ValidatePattern(TArray<FString>& OutErrors) const;
+
+	/**
+	* Rebuilds BakedShotDeltas from the unit graph
+	* Runs automatically on save and cook and is skipped when the units hash matches the last bake; returns true if the baked data changed
+	*/
+	bool BakeRuntimeData();
+
+	/**
+	* Moves the baked deltas to the copy shared by every loaded pattern with the same units
+	* Cooked builds do this on load, where the baked data is final; editor builds keep their own copy since it is saved with the asset
+	*/
+	void ShareBakedData();
+
+	// True if both patterns read their shot deltas from the same shared baked data
+	bool SharesBakedDataWith(const UCRRecoilPattern& Other) const;
+
+	// Hash of the unit positions, keys the baked data and the in-memory sharing between identical patterns
+	uint64 ComputeUnitsHash() const;
+
+	// Hash of the unit positions and every runtime parameter, equal for patterns that behave identically
+	uint64 ComputeContentHash() const;
+
+	// Bytes of baked runtime data this pattern keeps in memory (shared or not)
+	SIZE_T GetBakedDataSize() const;
+
+	// Incremental recoil delta of the given shot, ShotIndex must be within [0, GetMaxShotIndex()]
+	FVector2f GetShotDelta(const int32 ShotIndex) const;
+
 	/**
 	* Returns the incremental recoil delta for the current shot and advances ShotIndex to the next one
 	* PatternEndBehavior controls what happens once ShotIndex exceeds the pattern length:
 	*   Stop                   - returns zero; index stays put
 	*   RepeatLast             - returns the last delta forever; index stays put
 	*   RestartFromCustomIndex - resets index to the loop point, then advances normally
-	*   Random                 - returns a random delta; index stays put
+	*   Random                 - returns a random delta drawn from RandomStream; index stays put
 	*/
-	FVector2f ConsumeShot(int32& ShotIndex) const;
+	FVector2f ConsumeShot(int32& ShotIndex, FCRRecoilRandomStream& RandomStream) const;
+
+	// Cumulative recoil after the given number of shots, 0 being the origin, ShotCount must be within [0, GetMaxShotIndex() + 1]
+	FVector2f GetShotPosition(const int32 ShotCount) const;
+
+	/**
+	* Returns the recoil covered by advancing a fractional ShotPosition by ShotAdvance shots, interpolating between units
+	* Used by time indexed patterns and weapons that fire partial shots (bursts, charge weapons)
+	* PatternEndBehavior applies past the end of the pattern, as in ConsumeShot
+	*/
+	FVector2f ConsumeShotAdvance(float& ShotPosition, const float ShotAdvance, FCRRecoilRandomStream& RandomStream) const;
+
+	bool IsTimeIndexed() const;
 
 	int32 GetMaxShotIndex() const;
 
+	// Uplift and recovery parameters in the form the CrystalRecoilCore math consumes
+	FCRRecoilMotionSettings GetMotionSettings() const;
+
+	// End behavior parameters in the form the CrystalRecoilCore shot sequence consumes
+	FCRShotSequenceSettings GetShotSequenceSettings() const;
+
 	UPROPERTY()
 	TObjectPtr<UCRRecoilUnitGraph> RecoilUnitGraph;
 
+	/**
+	* How the aim moves after each shot
+	* Kinematic: Snappy kick with a configurable recovery delay and speed ramp
+	* Spring: Smooth, physical kick and return, optionally overshooting the rest aim
+	*/
+	UPROPERTY(EditAnywhere, Category = "Motion")
+	ERecoilMotionModel MotionModel = ERecoilMotionModel::Kinematic;
+
+	/**
+	* How fast the spring swings, in oscillations per second
+	* High Value: Short, tight kick
+	* Low Value: Slow, heavy sway
+	*/
+	UPROPERTY(EditAnywhere, Meta = (EditCondition = "MotionModel == ERecoilMotionModel::Spring", EditConditionHides = true, ClampMin = 0.1f, ForceUnits = "Hz"), Category = "Spring")
+	float SpringFrequency = 4.f;
+
+	/**
+	* 1.0 = Returns to the rest aim as fast as possible without overshooting (critically damped)
+	* Lower values overshoot below the rest aim and settle with a wobble
+	*/
+	UPROPERTY(EditAnywhere, Meta = (EditCondition = "MotionModel == ERecoilMotionModel::Spring", EditConditionHides = true, ClampMin = 0.05f, ClampMax = 1.f), Category = "Spring")
+	float SpringDampingRatio = 1.f;
+
 	/**
 	* Controls how fast the recoil kick reaches its peak
 	* 0.0 = Slow, smooth rise (floaty, heavy weapon feel)
 	* 1.0 = Instant violent snap (sharp, aggressive kick)
 	*/
-	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.f, ClampMax = 1.f), Category = "Uplift")
+	UPROPERTY(EditAnywhere, Meta = (EditCondition = "MotionModel == ERecoilMotionModel::Kinematic", EditConditionHides = true, ClampMin = 0.f, ClampMax = 1.f), Category = "Uplift")
 	float UpliftSpeed = 0.7f;
 
 	/**
 	* Time to wait after the last shot before recovery begins
 	* Set to 0 for recovery to begin immediately on the next frame after the last shot
 	*/
-	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.f, ForceUnits = "s"), Category = "Recovery")
+	UPROPERTY(EditAnywhere, Meta = (EditCondition = "MotionModel == ERecoilMotionModel::Kinematic", EditConditionHides = true, ClampMin = 0.f, ForceUnits = "s"), Category = "Recovery")
 	float RecoveryDelay = 0.1f;
 
 	/**
@@ -81,13 +194,13 @@ public:
 	* High Value: Returns immediately at high speed (Snappy start)
 	* Low Value: Eases in slowly (Smooth start)
 	*/
-	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.01f, ForceUnits = "deg/s"), Category = "Recovery")
+	UPROPERTY(EditAnywhere, Meta = (EditCondition = "MotionModel == ERecoilMotionModel::Kinematic", EditConditionHides = true, ClampMin = 0.01f, ForceUnits = "deg/s"), Category = "Recovery")
 	float InitialRecoverySpeed = 2.f;
 
 	/**
 	* The maximum speed the camera can move while returning to its pre-shot position
 	*/
-	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.01f, ForceUnits = "deg/s"), Category = "Recovery")
+	UPROPERTY(EditAnywhere, Meta = (EditCondition = "MotionModel == ERecoilMotionModel::Kinematic", EditConditionHides = true, ClampMin = 0.01f, ForceUnits = "deg/s"), Category = "Recovery")
 	float MaxRecoverySpeed = 10.f;
 
 	/**
@@ -95,7 +208,7 @@ public:
 	* High Value: Reaches max speed almost instantly
 	* Low Value: Slowly accelerates the return motion (Spongey feel)
 	*/
-	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.01f), Category = "Recovery")
+	UPROPERTY(EditAnywhere, Meta = (EditCondition = "MotionModel == ERecoilMotionModel::Kinematic", EditConditionHides = true, ClampMin = 0.01f), Category = "Recovery")
 	float RecoveryAcceleration = 40.f;
 
 	/**
@@ -103,9 +216,25 @@ public:
 	* Measured from StartShooting until recovery would begin (after RecoveryDelay)
 	* Set to 0 to disable (recovery always completes regardless of player aiming)
 	*/
-	UPROPERTY(EditAnywhere, Meta = (ClampMin = 0.f, ClampMax = 90.f, ForceUnits = "deg"), Category = "Recovery")
+	UPROPERTY(EditAnywhere, Meta = (EditCondition = "MotionModel == ERecoilMotionModel::Kinematic", EditConditionHides = true, ClampMin = 0.f, ClampMax = 90.f, ForceUnits = "deg"), Category = "Recovery")
 	float RecoveryCancelThreshold = 0.f;
 
+	/**
+	* How shots walk along the pattern
+	* ShotCount: Every shot moves to the next unit (Classic spray patterns)
+	* FiringTime: The pattern is authored for ReferenceFireInterval; faster fire rates advance it by a fraction of a unit per shot,
+	* so fire rate upgrades don't multiply the climb per second
+	*/
+	UPROPERTY(EditAnywhere, Category = "Pattern")
+	ERecoilPatternIndexing PatternIndexing = ERecoilPatternIndexing::ShotCount;
+
+	/**
+	* Time between shots the pattern was authored for
+	* Shots fired at least this far apart advance one whole unit; closer shots advance proportionally less
+	*/
+	UPROPERTY(EditAnywhere, Meta = (EditCondition = "PatternIndexing == ERecoilPatternIndexing::FiringTime", EditConditionHides = true, ClampMin = 0.001f, ForceUnits = "s"), Category = "Pattern")
+	float ReferenceFireInterval = 0.1f;
+
 	/**
 	* Defines behavior when the player shoots beyond the defined pattern length
 	* RepeatLast: Good for high-recoil weapons (AK-47 style infinite climb)
@@ -130,4 +259,22 @@ public:
 	*/
 	UPROPERTY(EditAnywhere, Meta = (EditCondition = "PatternEndBehavior == ERecoilPatternEndBehavior::Random", EditConditionHides = true), Category = "Pattern")
 	FRecoilPatternRandomizedRecoil RandomizedRecoil;
+
+protected:
+	/**
+	* Per shot recoil deltas precomputed from the unit graph, so cooked builds don't walk the graph on every shot
+	* Editor builds always read the live graph, since units are edited in place
+	*/
+	UPROPERTY()
+	TArray<FVector2f> BakedShotDeltas;
+
+	// ComputeUnitsHash of the units BakedShotDeltas was built from, 0 if never baked
+	UPROPERTY()
+	uint64 BakedUnitsHash = 0;
+
+	/**
+	* Cooked builds move BakedShotDeltas here on load, shared with every other loaded pattern that has the same units
+	* Editor builds keep their own copy, since it is saved with the asset
+	*/
+	TSharedPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe> SharedBakedData;
 };
@@ -0,0 +1,45 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+// Runtime shot data baked from a recoil pattern's unit graph, shared between all patterns with the same units
+struct FCRRecoilPatternBakedData
+{
+	// UCRRecoilPattern::ComputeUnitsHash of the units the data was baked from
+	uint64 UnitsHash = 0;
+
+	TArray<FVector2f> ShotDeltas;
+};
+
+/**
+* Hands out one shared copy of the baked data per unique unit set, so patterns that are copies of each other
+* (e.g. one per weapon skin) only keep their baked data in memory once
+* Entries are weak, the data is freed with the last pattern using it. Safe to use from the async loading thread
+*/
+class CRYSTALRECOIL_API FCRRecoilPatternBakedDataRegistry
+{
+public:
+	static FCRRecoilPatternBakedDataRegistry& Get();
+
+	/**
+	* Returns the shared baked data for UnitsHash, creating it from ShotDeltas if no live pattern shares it yet
+	* The hash is only a lookup key: the deltas are compared as well, so a hash collision never shares the wrong data
+	*/
+	TSharedRef<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe> Intern(const uint64 UnitsHash, TArray<FVector2f>&& ShotDeltas);
+
+	// Drops a pattern's reference to its shared data, call instead of resetting the pointer directly
+	void Release(TSharedPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe>& Data);
+
+	// Bytes currently saved by sharing, the value STAT_CRSharedBakedPatternMemorySaved reports
+	SIZE_T GetMemorySaved() const;
+
+private:
+	mutable FCriticalSection Mutex;
+
+	SIZE_T MemorySaved = 0;
+
+	TMap<uint64, TWeakPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe>> Entries;
+};
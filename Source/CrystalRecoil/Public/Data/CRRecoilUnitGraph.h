@@ -67,6 +67,8 @@ class CRYSTALRECOIL_API UCRRecoilUnitGraph : public UObject
 	GENERATED_BODY()
 
 public:
+	virtual void Serialize(FArchive& Ar) override;
+
 	const FCRRecoilUnit& GetUnitAt(const int32 Index) const;
 
 	int32 GetUnitCount() const;
@@ -76,13 +78,65 @@ public:
 
 	void RemoveUnit(const uint32 ID);
 
+	// Removes every unit whose ID is in IDs with a single compacting pass, the remaining units keep their order
+	void RemoveUnits(TConstArrayView<uint32> IDs);
+
+	// Removes all units and restarts ID assignment from 0
+	void ClearUnits();
+
 	FCRRecoilUnit* GetUnitByID(uint32 ID);
 
+	// Index of the unit with the given ID in the shot order, or INDEX_NONE
+	int32 GetUnitIndexByID(const uint32 ID) const;
+
 	TArray<FCRRecoilUnit>& GetRecoilUnits();
 
 	void RearrangeUnits();
 
+	// Inserts a unit at its RearrangePolicy position with a binary search instead of re-sorting everything
+	int32 AddUnitSorted(const FVector2f& RecoilUnitLocation);
+
+	/**
+	* Inserts a batch of units at their RearrangePolicy positions with a stable merge
+	* IDs are assigned in input order, starting at the returned ID
+	*/
+	int32 AddUnitsSorted(TConstArrayView<FVector2f> RecoilUnitLocations);
+
+	/**
+	* Restores RearrangePolicy order after a few units moved, by shifting only the units that are out of place
+	* Cost grows with how far units moved rather than with the unit count, so it suits per-frame drags
+	*/
+	void RepairUnitOrder();
+
+	// Whether the units are already in RearrangePolicy order
+	bool IsInRearrangeOrder() const;
+
+	uint32 GetNextID() const;
+
+	/**
+	* Removes the units with IDsToRemove, inserts IndexedUnits at their indices (ascending) and restores NextID, in a single pass
+	* Used by delta undo records, which only store the units an edit touched
+	*/
+	void RestoreUnits(TConstArrayView<uint32> IDsToRemove, TConstArrayView<TPair<int32, FCRRecoilUnit>> IndexedUnits, const uint32 InNextID);
+
+	/**
+	* Bumped whenever units are added, removed or moved outside the editor widget's own incremental updates
+	* Editor caches over unit positions (e.g. the graph widget's spatial grid) compare it to know when to rebuild
+	*/
+	uint32 GetUnitsRevision() const;
+
+	// Call after writing unit positions directly through GetUnitByID / GetRecoilUnits
+	void MarkUnitsModified();
+
+	/**
+	* Bumped whenever units may have changed index (sorting, insertion, removal, undo)
+	* Lets callers hold on to unit indices, e.g. for the duration of a drag, and re-resolve them only when it changes
+	*/
+	uint32 GetUnitOrderRevision() const;
+
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+
+	virtual void PostEditUndo() override;
 	#endif
 
 	#if WITH_EDITORONLY_DATA
@@ -117,6 +171,12 @@ public:
 	#endif
 
 protected:
+	#if WITH_EDITOR
+	void InvalidateUnitIndexByID() const;
+
+	void RebuildUnitIndexByID() const;
+	#endif
+
 	// Array of Units on the Graph
 	UPROPERTY(EditAnywhere, Category = "Recoil Pattern")
 	TArray<FCRRecoilUnit> RecoilUnits;
@@ -124,5 +184,17 @@ protected:
 	#if WITH_EDITORONLY_DATA
 	UPROPERTY()
 	uint32 NextID = 0;
+
+	uint32 UnitsRevision = 0;
+
+	/**
+	* Transient ID -> index acceleration map for GetUnitByID, rebuilt lazily after structural changes
+	* Not a UPROPERTY, so it is never serialized or captured by transactions; PostEditUndo just invalidates it
+	*/
+	mutable TMap<uint32, int32> UnitIndexByID;
+
+	mutable bool bUnitIndexByIDDirty = true;
+
+	mutable uint32 UnitOrderRevision = 0;
 	#endif
 };
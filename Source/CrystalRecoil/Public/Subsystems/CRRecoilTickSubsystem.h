@@ -0,0 +1,73 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CRRecoilTickSubsystem.generated.h"
+
+class UCRRecoilComponent;
+class UCRRecoilTickSubsystem;
+
+/** Runs the batched recoil update in TG_PrePhysics, the tick group the components would have ticked in themselves */
+USTRUCT()
+struct FCRRecoilTickSubsystemTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UCRRecoilTickSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FCRRecoilTickSubsystemTickFunction> : public TStructOpsTypeTraitsBase2<FCRRecoilTickSubsystemTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+* Central update for recoil components with bUseBatchedTick enabled.
+*
+* Recoil of different shooters is independent apart from the final controller writes, so each frame the subsystem:
+* - Gathers controller rotations on the game thread
+* - Runs the uplift, compensation and recovery math of all components across worker threads
+* - Runs the Process* hooks, spread heat cooldown and the controller writes back on the game thread
+*
+* The update runs from a TG_PrePhysics tick function, so batched components keep the place in the frame their own tick had.
+* Use "stat CrystalRecoil" to see the cost of the batched update and the number of active components.
+*/
+UCLASS()
+class CRYSTALRECOIL_API UCRRecoilTickSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Called by UCRRecoilComponent::BeginPlay. Takes over the component's tick state */
+	void RegisterComponent(UCRRecoilComponent* Component);
+
+	/** Called by UCRRecoilComponent::EndPlay. Hands the tick state back to the component */
+	void UnregisterComponent(UCRRecoilComponent* Component);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Deinitialize() override;
+
+	/** Updates all registered components, called by the TG_PrePhysics tick function */
+	void Tick(float DeltaTime);
+
+protected:
+	FCRRecoilTickSubsystemTickFunction TickFunction;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UCRRecoilComponent>> RegisteredComponents;
+
+	// Components updated this frame, kept as a member so the steady state doesn't allocate
+	TArray<UCRRecoilComponent*> ActiveComponents;
+};
@@ -0,0 +1,17 @@
+﻿using UnrealBuildTool;
+
+public class CrystalRecoilCore : ModuleRules
+{
+	public CrystalRecoilCore(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		// Deliberately Core only: the recoil math must not depend on UObjects, so it can be reused by non-component runtimes.
+		// Core is only used for the assertion macros, the math itself also builds without the engine (see Tests/CrystalRecoilCore)
+		PublicDependencyModuleNames.AddRange([
+			"Core"
+		]);
+
+		PublicDefinitions.Add("CRYSTALRECOILCORE_UNREAL=1");
+	}
+}
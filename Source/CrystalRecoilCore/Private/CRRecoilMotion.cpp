@@ -0,0 +1,418 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilMotion.h"
+
+#include <algorithm>
+
+namespace CrystalRecoilCore
+{
+	namespace Private
+	{
+		float SanitizeDeltaTime(const float DeltaTime)
+		{
+			return std::isfinite(DeltaTime) ? std::max(0.f, DeltaTime) : 0.f;
+		}
+
+		// Same as FMath::FInterpConstantTo: moves towards Target by at most Speed * DeltaTime
+		float InterpConstantTo(const float Current, const float Target, const float DeltaTime, const float Speed)
+		{
+			const float Distance = Target - Current;
+			if (Distance * Distance < SmallNumber)
+			{
+				return Target;
+			}
+
+			const float Step = Speed * DeltaTime;
+			return Current + std::clamp(Distance, -Step, Step);
+		}
+
+		// Same as FMath::RInterpTo starting from zero: the share DeltaTime * Speed of Target, all of it once that reaches 1
+		FCRRecoilRotation InterpFromZero(const FCRRecoilRotation& Target, const float DeltaTime, const float Speed)
+		{
+			if (Speed <= 0.f)
+			{
+				return Target;
+			}
+
+			const FCRRecoilRotation Delta = Target.GetNormalized();
+			if (Delta.IsNearlyZero())
+			{
+				return Target;
+			}
+			return (Delta * std::clamp(DeltaTime * Speed, 0.f, 1.f)).GetNormalized();
+		}
+
+		// Damping ratios this close to 1 use the critically damped solution, the underdamped one divides by ~0 there
+		constexpr double CriticalDampingTolerance = 0.001;
+
+		// Displacement and speed below which the spring counts as at rest
+		constexpr double SpringRestTolerance = 0.001;
+
+		double GetSpringAngularFrequency(const FCRRecoilMotionSettings& Settings)
+		{
+			return TwoPi * std::max(Settings.SpringFrequency, KindaSmallNumber);
+		}
+
+		double GetSpringDampingRatio(const FCRRecoilMotionSettings& Settings)
+		{
+			return std::clamp<double>(Settings.SpringDampingRatio, KindaSmallNumber, 1.0);
+		}
+
+		// Current displacement and velocity of the spring, per axis
+		void EvaluateSpringRotation(const FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, FCRRecoilRotation& OutOffset, FCRRecoilRotation& OutVelocity)
+		{
+			OutOffset = FCRRecoilRotation();
+			OutVelocity = FCRRecoilRotation();
+			EvaluateSpring(Settings, State.SpringOffset.Pitch, State.SpringVelocity.Pitch, State.SpringTime, OutOffset.Pitch, OutVelocity.Pitch);
+			EvaluateSpring(Settings, State.SpringOffset.Yaw, State.SpringVelocity.Yaw, State.SpringTime, OutOffset.Yaw, OutVelocity.Yaw);
+		}
+
+		// Restarts the analytic solution from the given displacement and velocity
+		void ResetSpring(FCRRecoilMotionState& State, const FCRRecoilRotation& Offset, const FCRRecoilRotation& Velocity)
+		{
+			State.SpringOffset = Offset;
+			State.SpringVelocity = Velocity;
+			State.SpringTime = 0.f;
+		}
+
+		bool IsSpringAtRest(const FCRRecoilMotionState& State)
+		{
+			return State.SpringOffset.IsNearlyZero(SpringRestTolerance) && State.SpringVelocity.IsNearlyZero(SpringRestTolerance);
+		}
+
+		void BeginSpringShot(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const FCRRecoilVector& ShotDelta)
+		{
+			FCRRecoilRotation Offset;
+			FCRRecoilRotation Velocity;
+			EvaluateSpringRotation(State, Settings, Offset, Velocity);
+
+			// Start from what is actually applied, Process* hooks may have changed it
+			const FCRRecoilRotation Kick(-ShotDelta.Y, ShotDelta.X);
+			ResetSpring(State, State.RecoilToRecover, Velocity + Kick * (1.0 / GetSpringPeakPerVelocity(Settings)));
+		}
+
+		bool SimulateSpringUplift(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const float DeltaTime, FCRRecoilRotation& OutDeltaRotation)
+		{
+			if (IsSpringAtRest(State) && State.RecoilToRecover.IsNearlyZero())
+			{
+				return false;
+			}
+
+			State.SpringTime += DeltaTime;
+
+			FCRRecoilRotation Offset;
+			FCRRecoilRotation Velocity;
+			EvaluateSpringRotation(State, Settings, Offset, Velocity);
+
+			if (Offset.IsNearlyZero(SpringRestTolerance) && Velocity.IsNearlyZero(SpringRestTolerance))
+			{
+				// Snap the rest of the way, so the aim ends exactly where it started
+				Offset = FCRRecoilRotation();
+				ResetSpring(State, FCRRecoilRotation(), FCRRecoilRotation());
+			}
+
+			State.RecoilToApply = Offset - State.RecoilToRecover;
+			if (State.RecoilToApply.IsZero())
+			{
+				return false;
+			}
+
+			OutDeltaRotation = State.RecoilToApply;
+			return true;
+		}
+
+		ECRRecoilRecoveryStep SimulateSpringRecovery(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const FCRRecoilRotation& InputLastFrame)
+		{
+			if (!State.RecoilToRecover.IsNearlyZero(0.001))
+			{
+				FCRRecoilRotation Compensated = State.RecoilToRecover;
+				CompensateRecovery(Compensated, InputLastFrame);
+
+				if (Compensated != State.RecoilToRecover)
+				{
+					// The player already covered part of the way back - continue the spring from there with the same velocity
+					FCRRecoilRotation Offset;
+					FCRRecoilRotation Velocity;
+					EvaluateSpringRotation(State, Settings, Offset, Velocity);
+					ResetSpring(State, Offset + (Compensated - State.RecoilToRecover), Velocity);
+					State.RecoilToRecover = Compensated;
+				}
+			}
+
+			if (IsSpringAtRest(State) && State.RecoilToApply.IsNearlyZero() && State.RecoilToRecover.IsNearlyZero())
+			{
+				return ECRRecoilRecoveryStep::Settle;
+			}
+			return ECRRecoilRecoveryStep::None;
+		}
+	}
+
+	void BeginBurst(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings)
+	{
+		State.AccumulatedInputDuringFire = FCRRecoilRotation();
+		State.bTrackingInputDuringFire = Settings.RecoveryDelay > 0.f && Settings.RecoveryCancelThreshold > 0.f;
+	}
+
+	void BeginShot(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const FCRRecoilVector& ShotDelta, const float WorldTime)
+	{
+		if (!CR_RECOIL_ENSURE_MSG(!ShotDelta.ContainsNaN(), "Recoil shot delta is not finite, the shot is ignored"))
+		{
+			return;
+		}
+
+		State.LastFireTime = WorldTime;
+
+		if (Settings.Model == ECRRecoilMotionModel::Spring)
+		{
+			Private::BeginSpringShot(State, Settings, ShotDelta);
+			CheckMotionInvariants(State);
+			return;
+		}
+
+		const float RecoilDeltaLength = ShotDelta.Size();
+		const float UpliftDuration = GetUpliftDuration(Settings.UpliftSpeed) / std::max(Settings.UpliftSpeedMultiplier, KindaSmallNumber);
+
+		// Kinematics: v0 = 2d/T, a = 2d/T^2
+		// Guarantees camera travels exactly DeltaRecoilLength in exactly UpliftDuration
+		State.CurrentUpliftDeceleration = (2.f * RecoilDeltaLength) / (UpliftDuration * UpliftDuration);
+		State.CurrentRecoilSpeed = 2.f * RecoilDeltaLength / UpliftDuration;
+
+		State.RecoilToApply = FCRRecoilRotation(-ShotDelta.Y, ShotDelta.X);
+		State.CurrentRecoverySpeed = Settings.InitialRecoverySpeed;
+
+		CheckMotionInvariants(State);
+	}
+
+	float GetUpliftDuration(const float UpliftSpeed)
+	{
+		// Map UpliftSpeed (0-1) to duration: high sharpness = short = snappy
+		// Lerp in speed space (1/T) instead of time space so sharpness feels linear
+		// At 0.0: 1/2 = 0.5s (floaty)
+		// At 0.75: ~20ms (fast)
+		// At 1.0: 1/66 = 0.015s (instant)
+		constexpr float MinRate = 1.f / 0.5f;
+		constexpr float MaxRate = 1.f / 0.025f;
+		return 1.f / (MinRate + (MaxRate - MinRate) * UpliftSpeed);
+	}
+
+	bool SimulateUplift(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const float InDeltaTime, FCRRecoilRotation& OutDeltaRotation)
+	{
+		const float DeltaTime = Private::SanitizeDeltaTime(InDeltaTime);
+
+		if (Settings.Model == ECRRecoilMotionModel::Spring)
+		{
+			const bool bHasUplift = Private::SimulateSpringUplift(State, Settings, DeltaTime, OutDeltaRotation);
+			CheckMotionInvariants(State);
+			return bHasUplift;
+		}
+
+		if (State.RecoilToApply.IsNearlyZero())
+		{
+			return false;
+		}
+
+		State.CurrentRecoilSpeed = std::max(0.f, State.CurrentRecoilSpeed - State.CurrentUpliftDeceleration * DeltaTime);
+
+		const FCRRecoilRotation& RecoilToApply = State.RecoilToApply;
+		const float DeltaMove = State.CurrentRecoilSpeed * DeltaTime;
+		const float RemainingMagnitude = std::sqrt(RecoilToApply.Pitch * RecoilToApply.Pitch + RecoilToApply.Yaw * RecoilToApply.Yaw);
+
+		if (DeltaMove >= RemainingMagnitude || std::abs(State.CurrentRecoilSpeed) <= SmallNumber)
+		{
+			OutDeltaRotation = RecoilToApply;
+		}
+		else
+		{
+			const float Alpha = DeltaMove / RemainingMagnitude;
+			OutDeltaRotation = RecoilToApply * Alpha;
+		}
+
+		CheckMotionInvariants(State);
+		return true;
+	}
+
+	void CommitUplift(FCRRecoilMotionState& State, const FCRRecoilRotation& AppliedDeltaRotation)
+	{
+		State.RecoilToApply -= AppliedDeltaRotation;
+		State.RecoilToRecover += AppliedDeltaRotation;
+	}
+
+	ECRRecoilRecoveryStep SimulateRecovery(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const FCRRecoilRotation& InputLastFrame, const float InDeltaTime, const double WorldTime, FCRRecoilRotation& OutDeltaRotation)
+	{
+		const float DeltaTime = Private::SanitizeDeltaTime(InDeltaTime);
+
+		if (Settings.Model == ECRRecoilMotionModel::Spring)
+		{
+			return Private::SimulateSpringRecovery(State, Settings, InputLastFrame);
+		}
+
+		// Always try to compensate if player is pulling against accumulated recoil
+		if (!State.RecoilToRecover.IsNearlyZero(0.001))
+		{
+			CompensateRecovery(State.RecoilToRecover, InputLastFrame);
+		}
+
+		// Accumulate player input during RecoveryDelay wait, but not during uplift
+		if (State.bTrackingInputDuringFire && State.RecoilToApply.IsNearlyZero() && State.LastFireTime + Settings.RecoveryDelay >= WorldTime)
+		{
+			State.AccumulatedInputDuringFire.Pitch += InputLastFrame.Pitch;
+			State.AccumulatedInputDuringFire.Yaw += InputLastFrame.Yaw;
+		}
+
+		// Apply recoil recovery - only after uplift is fully complete
+		if (Settings.RecoveryDelay >= 0.f && State.RecoilToApply.IsNearlyZero() && !State.RecoilToRecover.IsNearlyZero(0.001))
+		{
+			if (State.LastFireTime + Settings.RecoveryDelay < WorldTime)
+			{
+				// Cancel recovery if player made large aiming movements during burst
+				if (State.bTrackingInputDuringFire && Settings.RecoveryCancelThreshold > 0.f)
+				{
+					State.bTrackingInputDuringFire = false; // Stop tracking once we check
+					const bool bPlayerAimedAway = std::abs(State.AccumulatedInputDuringFire.Pitch) > Settings.RecoveryCancelThreshold || std::abs(State.AccumulatedInputDuringFire.Yaw) > Settings.RecoveryCancelThreshold;
+
+					if (bPlayerAimedAway)
+					{
+						// Player took manual control - cancel and reset recovery
+						State.RecoilToRecover = FCRRecoilRotation();
+						return ECRRecoilRecoveryStep::Cancel;
+					}
+				}
+
+				State.CurrentRecoverySpeed = Private::InterpConstantTo(State.CurrentRecoverySpeed, Settings.MaxRecoverySpeed, DeltaTime, Settings.RecoveryAcceleration);
+				OutDeltaRotation = Private::InterpFromZero(State.RecoilToRecover, DeltaTime, State.CurrentRecoverySpeed) * -1.0;
+
+				// Recovery never moves the aim past the pre-shot position
+				CR_RECOIL_CHECK_SLOW(std::abs(OutDeltaRotation.Pitch) <= std::abs(State.RecoilToRecover.Pitch) + KindaSmallNumber);
+				CR_RECOIL_CHECK_SLOW(std::abs(OutDeltaRotation.Yaw) <= std::abs(State.RecoilToRecover.Yaw) + KindaSmallNumber);
+				CheckMotionInvariants(State);
+				return ECRRecoilRecoveryStep::Recover;
+			}
+		}
+		else if (State.RecoilToApply.IsNearlyZero() && State.RecoilToRecover.IsNearlyZero(0.001))
+		{
+			// Nothing to process - settle only if we're past the recovery delay window
+			// Same tolerance as the recovery branch above, a debt between the two would otherwise keep the tick alive forever
+			if (WorldTime > State.LastFireTime + Settings.RecoveryDelay)
+			{
+				State.RecoilToRecover = FCRRecoilRotation();
+				return ECRRecoilRecoveryStep::Settle;
+			}
+		}
+
+		return ECRRecoilRecoveryStep::None;
+	}
+
+	void CommitRecovery(FCRRecoilMotionState& State, const FCRRecoilRotation& AppliedDeltaRotation)
+	{
+		State.RecoilToRecover += AppliedDeltaRotation;
+	}
+
+	bool SettleRecovery(FCRRecoilMotionState& State)
+	{
+		if (!State.RecoilToRecover.IsNearlyZero(0.001))
+		{
+			return false;
+		}
+
+		State.RecoilToRecover = FCRRecoilRotation();
+		return true;
+	}
+
+	void CompensateRecovery(FCRRecoilRotation& RecoilToRecover, const FCRRecoilRotation& LastFrameInput)
+	{
+		// Only compensate if Player is actively countering recoil (threshold to avoid noise and normal aiming)
+		constexpr double InputThreshold = 0.01;
+
+		// Reduce recovery by player input amount when opposing, but don't go past zero
+		auto CompensateAxis = [InputThreshold](double& RecoverAxis, const double InputAxis)
+		{
+			// Player is pulling in the same direction as recovery needs to go
+			if (std::abs(InputAxis) > InputThreshold && Sign(InputAxis) == Sign(RecoverAxis))
+			{
+				const double NewRecovery = RecoverAxis - InputAxis;
+				RecoverAxis = Sign(NewRecovery) == Sign(RecoverAxis) ? NewRecovery : 0.0;
+			}
+		};
+
+		CompensateAxis(RecoilToRecover.Pitch, LastFrameInput.Pitch); // Vertical
+		CompensateAxis(RecoilToRecover.Yaw, LastFrameInput.Yaw);     // Horizontal
+	}
+
+	void CheckMotionInvariants(const FCRRecoilMotionState& State)
+	{
+		CR_RECOIL_CHECKF_SLOW(!State.RecoilToApply.ContainsNaN() && !State.RecoilToRecover.ContainsNaN() && !State.AccumulatedInputDuringFire.ContainsNaN(), "Recoil motion rotations are not finite");
+		CR_RECOIL_CHECKF_SLOW(std::isfinite(State.CurrentRecoilSpeed) && State.CurrentRecoilSpeed >= 0.f, "Invalid uplift speed %f", State.CurrentRecoilSpeed);
+		CR_RECOIL_CHECKF_SLOW(std::isfinite(State.CurrentUpliftDeceleration) && State.CurrentUpliftDeceleration >= 0.f, "Invalid uplift deceleration %f", State.CurrentUpliftDeceleration);
+		CR_RECOIL_CHECKF_SLOW(std::isfinite(State.CurrentRecoverySpeed) && State.CurrentRecoverySpeed >= 0.f, "Invalid recovery speed %f", State.CurrentRecoverySpeed);
+	}
+
+	bool HasPendingMotion(const FCRRecoilMotionState& State)
+	{
+		return !State.RecoilToApply.IsNearlyZero() || !State.RecoilToRecover.IsNearlyZero(0.001) || !Private::IsSpringAtRest(State);
+	}
+
+	FCRRecoilRotation GetPlayerInput(const FCRRecoilRotation& CurrentControlRotation, const FCRRecoilRotation& LastControlRotation, const FCRRecoilRotation& RecoilInputGeneratedLastFrame)
+	{
+		const FCRRecoilRotation RotationDelta = (CurrentControlRotation - LastControlRotation).GetNormalized();
+		return (RotationDelta - RecoilInputGeneratedLastFrame).GetNormalized();
+	}
+
+	FCRRecoilRotation GetGeneratedInput(const FCRRecoilRotation& DeltaRecoilRotation, const FCRRecoilRotation& DeltaRecoveryRotation)
+	{
+		return FCRRecoilRotation(-DeltaRecoilRotation.Pitch - DeltaRecoveryRotation.Pitch, DeltaRecoilRotation.Yaw + DeltaRecoveryRotation.Yaw);
+	}
+
+	void EvaluateSpring(const FCRRecoilMotionSettings& Settings, const double StartOffset, const double StartVelocity, const float Time, double& OutOffset, double& OutVelocity)
+	{
+		const double Omega = Private::GetSpringAngularFrequency(Settings);
+		const double Zeta = Private::GetSpringDampingRatio(Settings);
+		const double Decay = std::exp(-Zeta * Omega * Time);
+
+		if (Zeta >= 1.0 - Private::CriticalDampingTolerance)
+		{
+			// x(t) = (x0 + (v0 + w * x0) * t) * e^(-w * t)
+			const double B = StartVelocity + Omega * StartOffset;
+			OutOffset = (StartOffset + B * Time) * Decay;
+			OutVelocity = (StartVelocity - Omega * B * Time) * Decay;
+			return;
+		}
+
+		// x(t) = e^(-z * w * t) * (x0 * cos(wd * t) + (v0 + z * w * x0) / wd * sin(wd * t))
+		const double DampedOmega = Omega * std::sqrt(1.0 - Zeta * Zeta);
+		const double Sin = std::sin(DampedOmega * Time);
+		const double Cos = std::cos(DampedOmega * Time);
+
+		OutOffset = Decay * (StartOffset * Cos + (StartVelocity + Zeta * Omega * StartOffset) / DampedOmega * Sin);
+		OutVelocity = Decay * (StartVelocity * Cos - (Zeta * Omega * StartVelocity + Omega * Omega * StartOffset) / DampedOmega * Sin);
+	}
+
+	double GetSpringPeakPerVelocity(const FCRRecoilMotionSettings& Settings)
+	{
+		const double Omega = Private::GetSpringAngularFrequency(Settings);
+		const double Zeta = Private::GetSpringDampingRatio(Settings);
+
+		if (Zeta >= 1.0 - Private::CriticalDampingTolerance)
+		{
+			// Peaks at t = 1 / w
+			return 1.0 / (Omega * EulersNumber);
+		}
+
+		// Peaks where the velocity first crosses zero, tan(wd * t) = wd / (z * w)
+		const double DampedOmega = Omega * std::sqrt(1.0 - Zeta * Zeta);
+		const double PeakTime = std::atan2(DampedOmega, Zeta * Omega) / DampedOmega;
+		return std::exp(-Zeta * Omega * PeakTime) * std::sin(DampedOmega * PeakTime) / DampedOmega;
+	}
+
+	FCRRecoilRotation ApplyToControlRotation(FCRRecoilRotation ControlRotation, const FCRRecoilRotation& Input)
+	{
+		// Apply the recoil delta
+		ControlRotation.Pitch -= Input.Pitch;
+		ControlRotation.Yaw += Input.Yaw;
+
+		// Clamp pitch before normalizing to prevent gimbal lock
+		ControlRotation.Pitch = ClampAngle(ControlRotation.Pitch, -89.9f, 89.9f);
+
+		// Normalize yaw to keep it in -180 to 180 range
+		return ControlRotation.GetNormalized();
+	}
+}
@@ -0,0 +1,198 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+/**
+* Plain value types the recoil math runs on. Deliberately free of engine types, so the core builds both as an Unreal
+* module and as a standalone library for the unit tests, benchmarks and fuzzing in Tests/CrystalRecoilCore.
+* CrystalRecoil converts to and from FRotator / FVector2f in CRRecoilCoreConversions.h.
+*/
+
+#ifndef CRYSTALRECOILCORE_API
+#define CRYSTALRECOILCORE_API
+#endif
+
+// Set by CrystalRecoilCore.Build.cs, so invariant checks go through the engine's assertion macros inside Unreal builds
+#if defined(CRYSTALRECOILCORE_UNREAL) && CRYSTALRECOILCORE_UNREAL
+#include "Misc/AssertionMacros.h"
+#define CR_RECOIL_CHECK_SLOW(Expr) checkSlow(Expr)
+#define CR_RECOIL_CHECKF_SLOW(Expr, Format, ...) checkfSlow(Expr, TEXT(Format), ##__VA_ARGS__)
+#define CR_RECOIL_ENSURE_MSG(Expr, Message) ensureMsgf(Expr, TEXT(Message))
+#else
+#include <cassert>
+#define CR_RECOIL_CHECK_SLOW(Expr) assert(Expr)
+#define CR_RECOIL_CHECKF_SLOW(Expr, Format, ...) assert((Expr) && Format)
+#define CR_RECOIL_ENSURE_MSG(Expr, Message) (!!(Expr))
+#endif
+
+namespace CrystalRecoilCore
+{
+	constexpr double TwoPi = 6.283185307179586476925286766559;
+	constexpr double EulersNumber = 2.71828182845904523536;
+	constexpr float KindaSmallNumber = 1.e-4f;
+	constexpr float SmallNumber = 1.e-8f;
+
+	// Angle in degrees wrapped to [0, 360)
+	inline double ClampAxis(double Angle)
+	{
+		Angle = std::fmod(Angle, 360.0);
+		if (Angle < 0.0)
+		{
+			Angle += 360.0;
+		}
+		return Angle;
+	}
+
+	// Angle in degrees wrapped to (-180, 180]
+	inline double NormalizeAxis(double Angle)
+	{
+		Angle = ClampAxis(Angle);
+		if (Angle > 180.0)
+		{
+			Angle -= 360.0;
+		}
+		return Angle;
+	}
+
+	// Clamps an angle in degrees to [Min, Max] on the circle, angles outside snap to the closer bound (as FMath::ClampAngle)
+	inline double ClampAngle(const double Angle, const double Min, const double Max)
+	{
+		const double MaxDelta = ClampAxis(Max - Min) * 0.5;
+		const double RangeCenter = ClampAxis(Min + MaxDelta);
+		const double DeltaFromCenter = NormalizeAxis(Angle - RangeCenter);
+
+		if (DeltaFromCenter > MaxDelta)
+		{
+			return NormalizeAxis(RangeCenter + MaxDelta);
+		}
+		if (DeltaFromCenter < -MaxDelta)
+		{
+			return NormalizeAxis(RangeCenter - MaxDelta);
+		}
+		return NormalizeAxis(Angle);
+	}
+
+	template <typename T>
+	constexpr T Sign(const T Value)
+	{
+		return Value > T(0) ? T(1) : (Value < T(0) ? T(-1) : T(0));
+	}
+}
+
+// Pitch and yaw in degrees, the only axes recoil moves. Mirrors the FRotator operations the math needs
+struct FCRRecoilRotation
+{
+	double Pitch = 0.0;
+	double Yaw = 0.0;
+
+	constexpr FCRRecoilRotation() = default;
+	constexpr FCRRecoilRotation(const double InPitch, const double InYaw) : Pitch(InPitch), Yaw(InYaw) {}
+
+	constexpr FCRRecoilRotation operator+(const FCRRecoilRotation& Other) const { return FCRRecoilRotation(Pitch + Other.Pitch, Yaw + Other.Yaw); }
+	constexpr FCRRecoilRotation operator-(const FCRRecoilRotation& Other) const { return FCRRecoilRotation(Pitch - Other.Pitch, Yaw - Other.Yaw); }
+	constexpr FCRRecoilRotation operator*(const double Scale) const { return FCRRecoilRotation(Pitch * Scale, Yaw * Scale); }
+	constexpr bool operator==(const FCRRecoilRotation& Other) const { return Pitch == Other.Pitch && Yaw == Other.Yaw; }
+	constexpr bool operator!=(const FCRRecoilRotation& Other) const { return !(*this == Other); }
+
+	FCRRecoilRotation& operator+=(const FCRRecoilRotation& Other)
+	{
+		Pitch += Other.Pitch;
+		Yaw += Other.Yaw;
+		return *this;
+	}
+
+	FCRRecoilRotation& operator-=(const FCRRecoilRotation& Other)
+	{
+		Pitch -= Other.Pitch;
+		Yaw -= Other.Yaw;
+		return *this;
+	}
+
+	// Compares the wrapped axes like FRotator::IsNearlyZero, so a full turn counts as zero
+	bool IsNearlyZero(const double Tolerance = CrystalRecoilCore::KindaSmallNumber) const
+	{
+		return std::abs(CrystalRecoilCore::NormalizeAxis(Pitch)) <= Tolerance && std::abs(CrystalRecoilCore::NormalizeAxis(Yaw)) <= Tolerance;
+	}
+
+	bool IsZero() const
+	{
+		return CrystalRecoilCore::ClampAxis(Pitch) == 0.0 && CrystalRecoilCore::ClampAxis(Yaw) == 0.0;
+	}
+
+	bool ContainsNaN() const
+	{
+		return !std::isfinite(Pitch) || !std::isfinite(Yaw);
+	}
+
+	FCRRecoilRotation GetNormalized() const
+	{
+		return FCRRecoilRotation(CrystalRecoilCore::NormalizeAxis(Pitch), CrystalRecoilCore::NormalizeAxis(Yaw));
+	}
+};
+
+// 2D pattern delta or position in degrees, X = yaw, Y = pitch. Same layout as FVector2f
+struct FCRRecoilVector
+{
+	float X = 0.f;
+	float Y = 0.f;
+
+	constexpr FCRRecoilVector() = default;
+	constexpr FCRRecoilVector(const float InX, const float InY) : X(InX), Y(InY) {}
+
+	constexpr FCRRecoilVector operator+(const FCRRecoilVector& Other) const { return FCRRecoilVector(X + Other.X, Y + Other.Y); }
+	constexpr FCRRecoilVector operator-(const FCRRecoilVector& Other) const { return FCRRecoilVector(X - Other.X, Y - Other.Y); }
+	constexpr FCRRecoilVector operator*(const float Scale) const { return FCRRecoilVector(X * Scale, Y * Scale); }
+	constexpr bool operator==(const FCRRecoilVector& Other) const { return X == Other.X && Y == Other.Y; }
+	constexpr bool operator!=(const FCRRecoilVector& Other) const { return !(*this == Other); }
+
+	FCRRecoilVector& operator+=(const FCRRecoilVector& Other)
+	{
+		X += Other.X;
+		Y += Other.Y;
+		return *this;
+	}
+
+	float Size() const
+	{
+		return std::sqrt(X * X + Y * Y);
+	}
+
+	bool ContainsNaN() const
+	{
+		return !std::isfinite(X) || !std::isfinite(Y);
+	}
+};
+
+// Inclusive [Min, Max] range
+struct FCRRecoilRange
+{
+	float Min = 0.f;
+	float Max = 0.f;
+};
+
+/**
+* Seeded random stream for the Random end behavior, the same generator as FRandomStream.
+* Owned by whoever owns the shot sequence state, so saving Seed is enough to replay the exact same random shots.
+*/
+struct FCRRecoilRandomStream
+{
+	uint32_t Seed = 0;
+
+	constexpr FCRRecoilRandomStream() = default;
+	explicit constexpr FCRRecoilRandomStream(const uint32_t InSeed) : Seed(InSeed) {}
+
+	// Uniform in [0, 1)
+	float GetFraction()
+	{
+		Seed = Seed * 196314165u + 907633515u;
+		return static_cast<float>(Seed >> 8) * (1.f / 16777216.f);
+	}
+
+	float RandRange(const float Min, const float Max)
+	{
+		return Min + (Max - Min) * GetFraction();
+	}
+};
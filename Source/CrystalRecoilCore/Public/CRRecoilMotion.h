@@ -0,0 +1,163 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CRRecoilCoreTypes.h"
+
+// Mirrors ERecoilMotionModel, which is a UENUM and can't live in this UObject-free module
+enum class ECRRecoilMotionModel : uint8_t
+{
+	// Constant deceleration uplift, then delayed recovery towards the pre-shot aim
+	Kinematic,
+
+	// Each shot kicks a damped spring that returns to the pre-shot aim, evaluated in closed form
+	Spring
+};
+
+// Pattern parameters the recoil motion math reads, copied out of UCRRecoilPattern so the math never touches UObjects
+struct FCRRecoilMotionSettings
+{
+	ECRRecoilMotionModel Model = ECRRecoilMotionModel::Kinematic;
+
+	// 0 = slow, floaty uplift, 1 = instant snap
+	float UpliftSpeed = 0.7f;
+
+	// Divides the uplift duration on top of UpliftSpeed, set by recoil modifiers (> 1 = faster kick)
+	float UpliftSpeedMultiplier = 1.f;
+
+	float RecoveryDelay = 0.1f;
+	float InitialRecoverySpeed = 2.f;
+	float MaxRecoverySpeed = 10.f;
+	float RecoveryAcceleration = 40.f;
+
+	// 0 disables cancelling recovery when the player aims away during a burst
+	float RecoveryCancelThreshold = 0.f;
+
+	// Spring model only: undamped natural frequency in Hz and damping ratio (1 = critically damped, < 1 = overshoots)
+	float SpringFrequency = 4.f;
+	float SpringDampingRatio = 1.f;
+};
+
+/**
+* Transient recoil motion of one shooter: the uplift still to apply, the recovery debt and the burst input tracking.
+* Rotations are in degrees.
+*/
+struct FCRRecoilMotionState
+{
+	// Uplift
+	FCRRecoilRotation RecoilToApply;
+	float CurrentRecoilSpeed = 0.f;
+	float CurrentUpliftDeceleration = 0.f;
+
+	// Recovery
+	FCRRecoilRotation RecoilToRecover;
+	float CurrentRecoverySpeed = 0.f;
+	float LastFireTime = 0.f;
+
+	// Recovery cancellation tracking
+	bool bTrackingInputDuringFire = false;
+	FCRRecoilRotation AccumulatedInputDuringFire;
+
+	// Spring model: displacement and velocity (deg/s) the analytic solution started from, and the time since then
+	FCRRecoilRotation SpringOffset;
+	FCRRecoilRotation SpringVelocity;
+	float SpringTime = 0.f;
+};
+
+// Outcome of the recovery simulation for one tick
+enum class ECRRecoilRecoveryStep : uint8_t
+{
+	// Nothing to apply this tick
+	None,
+
+	// Player aimed away during the burst - recovery was dropped and the tick should stop
+	Cancel,
+
+	// The recovery delta should be applied to the controller
+	Recover,
+
+	// All recoil is consumed and the recovery delay has passed - the tick should stop
+	Settle
+};
+
+/**
+* Engine-independent recoil kinematics, compensation and recovery.
+* Everything here is plain math over FCRRecoilMotionState, so it is safe to call from any thread.
+* UCRRecoilComponent is a thin adapter that feeds it controller input and applies the resulting deltas.
+*/
+namespace CrystalRecoilCore
+{
+	// Resets the burst input tracking, call when the fire button is pressed
+	CRYSTALRECOILCORE_API void BeginBurst(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings);
+
+	/**
+	* Starts the uplift for one shot with the given pattern delta (X = yaw, Y = pitch, in degrees)
+	* Kinematic: picks the speed and deceleration that cover exactly the delta in exactly the uplift duration
+	* Spring: adds the velocity impulse that makes an isolated shot peak at exactly the delta, on top of the motion in flight
+	* A non-finite delta is rejected, so a corrupt pattern can't poison the state with NaNs
+	*/
+	CRYSTALRECOILCORE_API void BeginShot(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const FCRRecoilVector& ShotDelta, const float WorldTime);
+
+	// Time the uplift of one shot takes for the given UpliftSpeed
+	CRYSTALRECOILCORE_API float GetUpliftDuration(const float UpliftSpeed);
+
+	/**
+	* Advances the uplift by DeltaTime, returns false if there is nothing left to apply
+	* The spring model moves the aim entirely in this step, in both directions, so its deltas also include the return motion
+	* Negative or non-finite DeltaTimes are treated as 0 here and in SimulateRecovery
+	*/
+	CRYSTALRECOILCORE_API bool SimulateUplift(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const float DeltaTime, FCRRecoilRotation& OutDeltaRotation);
+
+	// Moves an applied uplift delta from the recoil still to apply into the recovery debt
+	CRYSTALRECOILCORE_API void CommitUplift(FCRRecoilMotionState& State, const FCRRecoilRotation& AppliedDeltaRotation);
+
+	/**
+	* Runs compensation, burst input tracking and recovery for one tick
+	* InputLastFrame is the player's own aim input of the last frame, with the recoil's generated input removed
+	* The spring model only runs compensation here (by restarting the spring from the compensated displacement) and settles once at rest
+	*/
+	CRYSTALRECOILCORE_API ECRRecoilRecoveryStep SimulateRecovery(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const FCRRecoilRotation& InputLastFrame, const float DeltaTime, const double WorldTime, FCRRecoilRotation& OutDeltaRotation);
+
+	// Pays back an applied recovery delta from the recovery debt
+	CRYSTALRECOILCORE_API void CommitRecovery(FCRRecoilMotionState& State, const FCRRecoilRotation& AppliedDeltaRotation);
+
+	// Clears a recovery debt that is small enough to be done with, returns true if recovery is complete
+	CRYSTALRECOILCORE_API bool SettleRecovery(FCRRecoilMotionState& State);
+
+	/**
+	* Reduces the recovery debt if the player is already pulling the aim in the recovery direction
+	* Example: gun kicks up 5°, player pulls down 2° while recovering, so only 3° are left to recover
+	*/
+	CRYSTALRECOILCORE_API void CompensateRecovery(FCRRecoilRotation& RecoilToRecover, const FCRRecoilRotation& LastFrameInput);
+
+	/**
+	* Asserts that the state is finite and internally consistent (speeds and deceleration are non-negative)
+	* Compiled out unless DO_GUARD_SLOW (or NDEBUG is undefined in standalone builds), the simulate functions call it after every step
+	*/
+	CRYSTALRECOILCORE_API void CheckMotionInvariants(const FCRRecoilMotionState& State);
+
+	// Whether uplift or recovery still has work to do
+	CRYSTALRECOILCORE_API bool HasPendingMotion(const FCRRecoilMotionState& State);
+
+	// The player's own aim input between two frames, with the input the recoil generated itself removed
+	CRYSTALRECOILCORE_API FCRRecoilRotation GetPlayerInput(const FCRRecoilRotation& CurrentControlRotation, const FCRRecoilRotation& LastControlRotation, const FCRRecoilRotation& RecoilInputGeneratedLastFrame);
+
+	/**
+	* The control rotation change the recoil deltas of one tick cause, in the same space as GetPlayerInput
+	* Pitch is negated because ApplyToControlRotation subtracts pitch but adds yaw. Without this, the sign mismatch
+	* would make GetPlayerInput see double the recoil as phantom player input and incorrectly trigger compensation
+	*/
+	CRYSTALRECOILCORE_API FCRRecoilRotation GetGeneratedInput(const FCRRecoilRotation& DeltaRecoilRotation, const FCRRecoilRotation& DeltaRecoveryRotation);
+
+	/**
+	* Closed form solution of a damped spring with rest position 0, for one axis
+	* Exact for any Time, so the result doesn't depend on how the time was split into frames
+	*/
+	CRYSTALRECOILCORE_API void EvaluateSpring(const FCRRecoilMotionSettings& Settings, const double StartOffset, const double StartVelocity, const float Time, double& OutOffset, double& OutVelocity);
+
+	// Peak displacement an isolated spring reaches per deg/s of initial velocity
+	CRYSTALRECOILCORE_API double GetSpringPeakPerVelocity(const FCRRecoilMotionSettings& Settings);
+
+	// Applies a recoil delta to a control rotation, clamping pitch short of straight up/down and normalizing yaw
+	CRYSTALRECOILCORE_API FCRRecoilRotation ApplyToControlRotation(FCRRecoilRotation ControlRotation, const FCRRecoilRotation& Input);
+}
@@ -0,0 +1,192 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CRRecoilCoreTypes.h"
+
+// Mirrors ERecoilPatternEndBehavior, which is a UENUM and can't live in this UObject-free module
+enum class ECRShotSequenceEndBehavior : uint8_t
+{
+	RepeatLast,
+	Stop,
+	RestartFromCustomIndex,
+	Random
+};
+
+// What a shot sequence does once the shooter fires past its last shot
+struct FCRShotSequenceSettings
+{
+	ECRShotSequenceEndBehavior EndBehavior = ECRShotSequenceEndBehavior::RepeatLast;
+
+	int32_t CustomRestartIndex = 0;
+
+	FCRRecoilRange RandomXRange;
+
+	FCRRecoilRange RandomYRange;
+
+	// Time indexed patterns only: the time between shots the pattern was authored for, 0 for shot indexed patterns
+	float ReferenceFireInterval = 0.f;
+};
+
+namespace CrystalRecoilCore
+{
+	/**
+	* Returns the incremental recoil delta of the current shot and advances ShotIndex to the next one, applying EndBehavior past the pattern end
+	* GetShotDelta is called as GetShotDelta(int32_t ShotIndex) -> FCRRecoilVector, only with indices in [0, ShotCount - 1]
+	* Templated on the delta source so live editor graphs and baked arrays share the same logic without an indirect call per shot
+	* RandomStream is only drawn from by the Random end behavior
+	*/
+	template <typename GetShotDeltaType>
+	FCRRecoilVector ConsumeShot(int32_t& ShotIndex, const int32_t ShotCount, const FCRShotSequenceSettings& Settings, FCRRecoilRandomStream& RandomStream, GetShotDeltaType&& GetShotDelta)
+	{
+		if (ShotCount == 0)
+		{
+			return FCRRecoilVector();
+		}
+
+		const int32_t MaxShotIndex = ShotCount - 1;
+		if (ShotIndex >= MaxShotIndex)
+		{
+			switch (Settings.EndBehavior)
+			{
+				case ECRShotSequenceEndBehavior::Stop:
+				{
+					return FCRRecoilVector();
+				}
+				case ECRShotSequenceEndBehavior::RepeatLast:
+				{
+					return GetShotDelta(MaxShotIndex);
+				}
+				case ECRShotSequenceEndBehavior::RestartFromCustomIndex:
+				{
+					ShotIndex = Settings.CustomRestartIndex < 0 ? 0 : (Settings.CustomRestartIndex > MaxShotIndex ? MaxShotIndex : Settings.CustomRestartIndex);
+
+					// Restarting at the last shot repeats it, advancing would step past the end of the pattern
+					if (ShotIndex == MaxShotIndex)
+					{
+						return GetShotDelta(MaxShotIndex);
+					}
+					break;
+				}
+				case ECRShotSequenceEndBehavior::Random:
+				{
+					const float RandomX = RandomStream.RandRange(Settings.RandomXRange.Min, Settings.RandomXRange.Max);
+					return FCRRecoilVector(RandomX, RandomStream.RandRange(Settings.RandomYRange.Min, Settings.RandomYRange.Max));
+				}
+			}
+		}
+
+		// Normal path (and RestartFromCustomIndex after reset): consume this shot and advance the index
+		CR_RECOIL_CHECK_SLOW(ShotIndex >= 0 && ShotIndex < MaxShotIndex);
+		return GetShotDelta(ShotIndex++);
+	}
+
+	/**
+	* Advances a fractional ShotPosition by ShotAdvance shots and returns the recoil delta covered on the way
+	* The pattern is treated as a polyline through GetShotPosition(0..ShotCount), where GetShotPosition(N) is the
+	* cumulative recoil after N shots (GetShotPosition(0) is the origin), so every lookup is O(1)
+	* Past the end EndBehavior applies per shot worth of advance: Stop clamps, RepeatLast extends the last segment,
+	* RestartFromCustomIndex loops back and Random scales a random delta by the advance
+	*/
+	template <typename GetShotPositionType>
+	FCRRecoilVector ConsumeShotAdvance(float& ShotPosition, const float ShotAdvance, const int32_t ShotCount, const FCRShotSequenceSettings& Settings, FCRRecoilRandomStream& RandomStream, GetShotPositionType&& GetShotPosition)
+	{
+		if (ShotCount == 0 || !(ShotAdvance > 0.f))
+		{
+			return FCRRecoilVector();
+		}
+
+		const float EndPosition = static_cast<float>(ShotCount);
+		auto SamplePosition = [ShotCount, &GetShotPosition](const float Position)
+		{
+			const int32_t FloorIndex = static_cast<int32_t>(std::floor(Position));
+			const int32_t LowerIndex = FloorIndex < 0 ? 0 : (FloorIndex > ShotCount - 1 ? ShotCount - 1 : FloorIndex);
+			const FCRRecoilVector Lower = GetShotPosition(LowerIndex);
+			return Lower + (GetShotPosition(LowerIndex + 1) - Lower) * (Position - static_cast<float>(LowerIndex));
+		};
+
+		FCRRecoilVector Delta;
+		float RemainingAdvance = ShotAdvance;
+
+		// Inside the pattern
+		const float InsideAdvance = std::fmin(RemainingAdvance, std::fmax(0.f, EndPosition - ShotPosition));
+		if (InsideAdvance > 0.f)
+		{
+			Delta += SamplePosition(ShotPosition + InsideAdvance) - SamplePosition(ShotPosition);
+			ShotPosition += InsideAdvance;
+			RemainingAdvance -= InsideAdvance;
+		}
+
+		if (RemainingAdvance <= 0.f)
+		{
+			return Delta;
+		}
+
+		switch (Settings.EndBehavior)
+		{
+			case ECRShotSequenceEndBehavior::Stop:
+			{
+				break;
+			}
+			case ECRShotSequenceEndBehavior::RepeatLast:
+			{
+				Delta += (GetShotPosition(ShotCount) - GetShotPosition(ShotCount - 1)) * RemainingAdvance;
+				break;
+			}
+			case ECRShotSequenceEndBehavior::RestartFromCustomIndex:
+			{
+				const int32_t RestartIndex = Settings.CustomRestartIndex < 0 ? 0 : (Settings.CustomRestartIndex > ShotCount - 1 ? ShotCount - 1 : Settings.CustomRestartIndex);
+				const float LoopLength = EndPosition - static_cast<float>(RestartIndex);
+
+				// Whole loops add the full loop travel at once, so huge advances stay O(1)
+				const float WholeLoops = std::floor(RemainingAdvance / LoopLength);
+				Delta += (GetShotPosition(ShotCount) - GetShotPosition(RestartIndex)) * WholeLoops;
+				RemainingAdvance -= WholeLoops * LoopLength;
+
+				// A whole number of loops ends back at the end of the pattern, which is where ShotPosition already is
+				if (RemainingAdvance > 0.f)
+				{
+					ShotPosition = static_cast<float>(RestartIndex) + RemainingAdvance;
+					Delta += SamplePosition(ShotPosition) - GetShotPosition(RestartIndex);
+				}
+				break;
+			}
+			case ECRShotSequenceEndBehavior::Random:
+			{
+				const float RandomX = RandomStream.RandRange(Settings.RandomXRange.Min, Settings.RandomXRange.Max);
+				Delta += FCRRecoilVector(RandomX, RandomStream.RandRange(Settings.RandomYRange.Min, Settings.RandomYRange.Max)) * RemainingAdvance;
+				break;
+			}
+		}
+
+		return Delta;
+	}
+
+	/**
+	* How many shots worth of pattern a shot of a time indexed pattern advances: the time since the previous shot
+	* in units of ReferenceFireInterval, capped at one shot so pauses between shots don't skip parts of the pattern
+	* At the reference fire rate every shot advances exactly one shot; twice the fire rate advances half a shot per shot
+	* The first shot of a burst (ShotPosition still at the origin) always advances a whole shot
+	*/
+	inline float GetTimeIndexedShotAdvance(const FCRShotSequenceSettings& Settings, const float ShotPosition, const float LastFireTime, const double WorldTime)
+	{
+		if (ShotPosition <= 0.f || Settings.ReferenceFireInterval <= 0.f)
+		{
+			return 1.f;
+		}
+		const float ShotAdvance = static_cast<float>(WorldTime - LastFireTime) / Settings.ReferenceFireInterval;
+		return ShotAdvance > 0.f ? std::fmin(ShotAdvance, 1.f) : 0.f;
+	}
+
+	// ConsumeShot over a flat array of per shot deltas, e.g. baked pattern data
+	inline FCRRecoilVector ConsumeShot(int32_t& ShotIndex, const FCRRecoilVector* ShotDeltas, const int32_t ShotCount, const FCRShotSequenceSettings& Settings, FCRRecoilRandomStream& RandomStream)
+	{
+		return ConsumeShot(ShotIndex, ShotCount, Settings, RandomStream, [ShotDeltas](const int32_t Index) { return ShotDeltas[Index]; });
+	}
+
+	// ConsumeShotAdvance over a flat array of PositionCount cumulative shot positions, ShotPositions[0] being the origin
+	inline FCRRecoilVector ConsumeShotAdvance(float& ShotPosition, const float ShotAdvance, const FCRRecoilVector* ShotPositions, const int32_t PositionCount, const FCRShotSequenceSettings& Settings, FCRRecoilRandomStream& RandomStream)
+	{
+		return ConsumeShotAdvance(ShotPosition, ShotAdvance, PositionCount > 0 ? PositionCount - 1 : 0, Settings, RandomStream, [ShotPositions](const int32_t Index) { return ShotPositions[Index]; });
+	}
+}
@@ -21,7 +21,12 @@ public class CrystalRecoilEditor : ModuleRules
 			"Projects",
 			"GraphEditor",
 			"CurveEditor",
-			"ApplicationCore"
+			"ApplicationCore",
+			"AssetRegistry",
+			"Json",
+			"AnimGraph",
+			"BlueprintGraph",
+			"CrystalRecoilTests"
 		]);
 	}
 }
@@ -0,0 +1,22 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "AnimGraph/AnimGraphNode_CRRecoilKick.h"
+
+#define LOCTEXT_NAMESPACE "AnimGraphNode_CRRecoilKick"
+
+FText UAnimGraphNode_CRRecoilKick::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return GetControllerDescription();
+}
+
+FText UAnimGraphNode_CRRecoilKick::GetTooltipText() const
+{
+	return LOCTEXT("Tooltip", "Applies procedural weapon kick to a bone from the owning actor's recoil component. Safe to evaluate on worker threads.");
+}
+
+FText UAnimGraphNode_CRRecoilKick::GetControllerDescription() const
+{
+	return LOCTEXT("Title", "Recoil Kick");
+}
+
+#undef LOCTEXT_NAMESPACE
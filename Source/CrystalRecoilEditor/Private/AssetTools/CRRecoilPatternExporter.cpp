@@ -0,0 +1,40 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "AssetTools/CRRecoilPatternExporter.h"
+#include "AssetTools/CRRecoilPatternInterchange.h"
+#include "Data/CRRecoilPattern.h"
+
+UCRRecoilPatternExporter::UCRRecoilPatternExporter()
+{
+	SupportedClass = UCRRecoilPattern::StaticClass();
+	bText = false;
+	PreferredFormatIndex = 0;
+
+	FormatExtension.Add(TEXT("crpattern"));
+	FormatExtension.Add(TEXT("json"));
+	FormatExtension.Add(TEXT("csv"));
+	FormatDescription.Add(TEXT("CrystalRecoil Binary Recoil Pattern"));
+	FormatDescription.Add(TEXT("CrystalRecoil JSON Recoil Pattern"));
+	FormatDescription.Add(TEXT("CrystalRecoil CSV Recoil Pattern"));
+}
+
+bool UCRRecoilPatternExporter::ExportBinary(UObject* Object, const TCHAR* Type, FArchive& Ar, FFeedbackContext* Warn, int32 FileIndex, uint32 PortFlags)
+{
+	const UCRRecoilPattern* Pattern = Cast<UCRRecoilPattern>(Object);
+	const TOptional<ECRRecoilPatternInterchangeFormat> Format = FCRRecoilPatternInterchange::FormatFromExtension(Type);
+	if (!Pattern || !Format.IsSet())
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	FString Error;
+	if (!FCRRecoilPatternInterchange::ExportPattern(Format.GetValue(), *Pattern, Bytes, Error))
+	{
+		Warn->Logf(ELogVerbosity::Error, TEXT("Failed to export recoil pattern %s: %s"), *Pattern->GetName(), *Error);
+		return false;
+	}
+
+	Ar.Serialize(Bytes.GetData(), Bytes.Num());
+	return true;
+}
@@ -0,0 +1,87 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "AssetTools/CRRecoilPatternImportFactory.h"
+#include "AssetTools/CRRecoilPatternInterchange.h"
+#include "Data/CRRecoilPattern.h"
+#include "Editor.h"
+#include "HAL/FileManager.h"
+#include "Subsystems/ImportSubsystem.h"
+
+namespace
+{
+	// Enough to find the JSON version key even after a few metadata fields
+	constexpr int64 SignatureProbeSize = 1024;
+}
+
+UCRRecoilPatternImportFactory::UCRRecoilPatternImportFactory()
+{
+	bCreateNew = false;
+	bEditorImport = true;
+	bText = false;
+	SupportedClass = UCRRecoilPattern::StaticClass();
+
+	// .json and .csv are shared with other importers, FactoryCanImport sorts out which files are ours
+	ImportPriority = DefaultImportPriority + 1;
+
+	Formats.Add(TEXT("crpattern;CrystalRecoil Binary Recoil Pattern"));
+	Formats.Add(TEXT("json;CrystalRecoil JSON Recoil Pattern"));
+	Formats.Add(TEXT("csv;CrystalRecoil CSV Recoil Pattern"));
+}
+
+bool UCRRecoilPatternImportFactory::FactoryCanImport(const FString& Filename)
+{
+	const TOptional<ECRRecoilPatternInterchangeFormat> Format = FCRRecoilPatternInterchange::FormatFromExtension(FPaths::GetExtension(Filename));
+	if (!Format.IsSet())
+	{
+		return false;
+	}
+
+	const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	TArray<uint8, TInlineAllocator<SignatureProbeSize>> LeadingBytes;
+	LeadingBytes.SetNumUninitialized(static_cast<int32>(FMath::Min(Reader->TotalSize(), SignatureProbeSize)));
+	Reader->Serialize(LeadingBytes.GetData(), LeadingBytes.Num());
+
+	return !Reader->IsError() && FCRRecoilPatternInterchange::HasSignature(Format.GetValue(), LeadingBytes);
+}
+
+UObject* UCRRecoilPatternImportFactory::FactoryCreateBinary(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags, UObject* Context, const TCHAR* Type, const uint8*& Buffer, const uint8* BufferEnd, FFeedbackContext* Warn)
+{
+	GEditor->GetEditorSubsystem<UImportSubsystem>()->BroadcastAssetPreImport(this, InClass, InParent, InName, Type);
+
+	const TOptional<ECRRecoilPatternInterchangeFormat> Format = FCRRecoilPatternInterchange::FormatFromExtension(Type);
+	if (!Format.IsSet())
+	{
+		Warn->Logf(ELogVerbosity::Error, TEXT("Unsupported recoil pattern file type '%s'"), Type);
+		GEditor->GetEditorSubsystem<UImportSubsystem>()->BroadcastAssetPostImport(this, nullptr);
+		return nullptr;
+	}
+
+	// Reuse an existing pattern of the same name so importing over it keeps references intact
+	UCRRecoilPattern* Pattern = FindObject<UCRRecoilPattern>(InParent, *InName.ToString());
+	if (!Pattern)
+	{
+		Pattern = NewObject<UCRRecoilPattern>(InParent, InClass, InName, Flags);
+	}
+
+	FString Error;
+	const TConstArrayView<uint8> Data(Buffer, static_cast<int32>(BufferEnd - Buffer));
+	if (!FCRRecoilPatternInterchange::ImportIntoPattern(Format.GetValue(), Data, *Pattern, Error))
+	{
+		Warn->Logf(ELogVerbosity::Error, TEXT("Failed to import recoil pattern %s: %s"), *InName.ToString(), *Error);
+		GEditor->GetEditorSubsystem<UImportSubsystem>()->BroadcastAssetPostImport(this, nullptr);
+		return nullptr;
+	}
+
+	GEditor->GetEditorSubsystem<UImportSubsystem>()->BroadcastAssetPostImport(this, Pattern);
+	return Pattern;
+}
+
+FText UCRRecoilPatternImportFactory::GetToolTip() const
+{
+	return NSLOCTEXT("CrystalRecoil", "RecoilPatternImportFactoryToolTip", "Weapon Recoil Pattern imported from a .crpattern, .json or .csv file");
+}
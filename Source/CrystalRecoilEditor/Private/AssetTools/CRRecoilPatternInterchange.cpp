@@ -0,0 +1,834 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "AssetTools/CRRecoilPatternInterchange.h"
+#include "Data/CRRecoilPattern.h"
+#include "Data/CRRecoilUnitGraph.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	struct FCRInterchangeFloatField
+	{
+		const TCHAR* Name;
+		float FCRRecoilPatternInterchangeData::* Member;
+	};
+
+	// Scalar parameters shared by the JSON and CSV forms, named after the UCRRecoilPattern properties
+	const FCRInterchangeFloatField InterchangeFloatFields[] =
+	{
+		{ TEXT("SpringFrequency"), &FCRRecoilPatternInterchangeData::SpringFrequency },
+		{ TEXT("SpringDampingRatio"), &FCRRecoilPatternInterchangeData::SpringDampingRatio },
+		{ TEXT("UpliftSpeed"), &FCRRecoilPatternInterchangeData::UpliftSpeed },
+		{ TEXT("RecoveryDelay"), &FCRRecoilPatternInterchangeData::RecoveryDelay },
+		{ TEXT("InitialRecoverySpeed"), &FCRRecoilPatternInterchangeData::InitialRecoverySpeed },
+		{ TEXT("MaxRecoverySpeed"), &FCRRecoilPatternInterchangeData::MaxRecoverySpeed },
+		{ TEXT("RecoveryAcceleration"), &FCRRecoilPatternInterchangeData::RecoveryAcceleration },
+		{ TEXT("RecoveryCancelThreshold"), &FCRRecoilPatternInterchangeData::RecoveryCancelThreshold },
+		{ TEXT("ReferenceFireInterval"), &FCRRecoilPatternInterchangeData::ReferenceFireInterval },
+	};
+
+	const TCHAR* const VersionFieldName = TEXT("CrystalRecoilPattern");
+	const TCHAR* const MotionModelFieldName = TEXT("MotionModel");
+	const TCHAR* const PatternIndexingFieldName = TEXT("PatternIndexing");
+	const TCHAR* const EndBehaviorFieldName = TEXT("PatternEndBehavior");
+	const TCHAR* const RestartIndexFieldName = TEXT("CustomRecoilRestartIndex");
+	const TCHAR* const RandomXRangeFieldName = TEXT("RandomXRange");
+	const TCHAR* const RandomYRangeFieldName = TEXT("RandomYRange");
+	const TCHAR* const UnitsFieldName = TEXT("Units");
+
+	template <typename CharType>
+	bool EqualsField(const TStringView<CharType> Value, const TCHAR* FieldName)
+	{
+		TStringBuilder<64> Builder;
+		Builder << Value;
+		return FCString::Stricmp(*Builder, FieldName) == 0;
+	}
+
+	bool ParseFloatCell(const FUtf8StringView Cell, float& OutValue)
+	{
+		// Inline builder - converts the cell without touching the heap
+		TStringBuilder<64> Builder;
+		Builder << Cell.TrimStartAndEnd();
+		return Builder.Len() > 0 && LexTryParseString(OutValue, *Builder);
+	}
+
+	bool ParseIntCell(const FUtf8StringView Cell, int32& OutValue)
+	{
+		TStringBuilder<64> Builder;
+		Builder << Cell.TrimStartAndEnd();
+		return Builder.Len() > 0 && LexTryParseString(OutValue, *Builder);
+	}
+
+	template <typename EnumType>
+	bool ParseEnumName(const FStringView Name, EnumType& OutValue)
+	{
+		const int64 Value = StaticEnum<EnumType>()->GetValueByNameString(FString(Name));
+		if (Value == INDEX_NONE)
+		{
+			return false;
+		}
+		OutValue = static_cast<EnumType>(Value);
+		return true;
+	}
+
+	template <typename EnumType>
+	FString GetEnumName(const EnumType Value)
+	{
+		return StaticEnum<EnumType>()->GetNameStringByValue(static_cast<int64>(Value));
+	}
+
+	float* FindFloatField(FCRRecoilPatternInterchangeData& Data, const FStringView Name)
+	{
+		for (const FCRInterchangeFloatField& Field : InterchangeFloatFields)
+		{
+			if (Name.Equals(Field.Name, ESearchCase::IgnoreCase))
+			{
+				return &(Data.*Field.Member);
+			}
+		}
+		return nullptr;
+	}
+
+	FUtf8StringView MakeUtf8View(TConstArrayView<uint8> Data)
+	{
+		FUtf8StringView View(reinterpret_cast<const UTF8CHAR*>(Data.GetData()), Data.Num());
+
+		// Skip the UTF-8 BOM spreadsheet tools like to write
+		if (View.StartsWith(UTF8TEXT("\xEF\xBB\xBF")))
+		{
+			View.RightChopInline(3);
+		}
+		return View;
+	}
+
+	void AppendBuilder(TArray<uint8>& OutBytes, const FAnsiStringBuilderBase& Builder)
+	{
+		OutBytes.Append(reinterpret_cast<const uint8*>(Builder.GetData()), Builder.Len());
+	}
+}
+
+void FCRRecoilPatternInterchangeData::ReadFromPattern(const UCRRecoilPattern& Pattern)
+{
+	MotionModel = Pattern.MotionModel;
+	SpringFrequency = Pattern.SpringFrequency;
+	SpringDampingRatio = Pattern.SpringDampingRatio;
+	UpliftSpeed = Pattern.UpliftSpeed;
+	RecoveryDelay = Pattern.RecoveryDelay;
+	InitialRecoverySpeed = Pattern.InitialRecoverySpeed;
+	MaxRecoverySpeed = Pattern.MaxRecoverySpeed;
+	RecoveryAcceleration = Pattern.RecoveryAcceleration;
+	RecoveryCancelThreshold = Pattern.RecoveryCancelThreshold;
+	PatternIndexing = Pattern.PatternIndexing;
+	ReferenceFireInterval = Pattern.ReferenceFireInterval;
+	PatternEndBehavior = Pattern.PatternEndBehavior;
+	CustomRecoilRestartIndex = Pattern.CustomRecoilRestartIndex;
+	RandomXRange = FVector2f(Pattern.RandomizedRecoil.RandomXRange);
+	RandomYRange = FVector2f(Pattern.RandomizedRecoil.RandomYRange);
+
+	const UCRRecoilUnitGraph* UnitGraph = Pattern.GetUnitGraph();
+	const int32 UnitCount = UnitGraph ? UnitGraph->GetUnitCount() : 0;
+	UnitPositions.Reset(UnitCount);
+
+	for (int32 Index = 0; Index < UnitCount; ++Index)
+	{
+		UnitPositions.Add(UnitGraph->GetUnitAt(Index).Position);
+	}
+}
+
+void FCRRecoilPatternInterchangeData::ApplyToPattern(UCRRecoilPattern& Pattern) const
+{
+	Pattern.MotionModel = MotionModel;
+	Pattern.SpringFrequency = SpringFrequency;
+	Pattern.SpringDampingRatio = SpringDampingRatio;
+	Pattern.UpliftSpeed = UpliftSpeed;
+	Pattern.RecoveryDelay = RecoveryDelay;
+	Pattern.InitialRecoverySpeed = InitialRecoverySpeed;
+	Pattern.MaxRecoverySpeed = MaxRecoverySpeed;
+	Pattern.RecoveryAcceleration = RecoveryAcceleration;
+	Pattern.RecoveryCancelThreshold = RecoveryCancelThreshold;
+	Pattern.PatternIndexing = PatternIndexing;
+	Pattern.ReferenceFireInterval = ReferenceFireInterval;
+	Pattern.PatternEndBehavior = PatternEndBehavior;
+	Pattern.CustomRecoilRestartIndex = CustomRecoilRestartIndex;
+	Pattern.RandomizedRecoil.RandomXRange = FVector2D(RandomXRange);
+	Pattern.RandomizedRecoil.RandomYRange = FVector2D(RandomYRange);
+
+	// Units keep the file order - it defines the shot order, so no auto rearrange here
+	UCRRecoilUnitGraph* UnitGraph = Pattern.GetUnitGraph();
+	UnitGraph->ClearUnits();
+	UnitGraph->GetRecoilUnits().Reserve(UnitPositions.Num());
+
+	for (const FVector2f& Position : UnitPositions)
+	{
+		UnitGraph->AddUnit(Position);
+	}
+}
+
+TOptional<ECRRecoilPatternInterchangeFormat> FCRRecoilPatternInterchange::FormatFromExtension(FStringView Extension)
+{
+	Extension.TrimStartInline();
+	if (Extension.StartsWith(TEXT('.')))
+	{
+		Extension.RightChopInline(1);
+	}
+
+	for (const ECRRecoilPatternInterchangeFormat Format : { ECRRecoilPatternInterchangeFormat::Binary, ECRRecoilPatternInterchangeFormat::Json, ECRRecoilPatternInterchangeFormat::Csv })
+	{
+		if (Extension.Equals(GetExtension(Format), ESearchCase::IgnoreCase))
+		{
+			return Format;
+		}
+	}
+	return {};
+}
+
+const TCHAR* FCRRecoilPatternInterchange::GetExtension(const ECRRecoilPatternInterchangeFormat Format)
+{
+	switch (Format)
+	{
+		case ECRRecoilPatternInterchangeFormat::Binary: return TEXT("crpattern");
+		case ECRRecoilPatternInterchangeFormat::Json: return TEXT("json");
+		case ECRRecoilPatternInterchangeFormat::Csv: return TEXT("csv");
+	}
+	return TEXT("");
+}
+
+bool FCRRecoilPatternInterchange::HasSignature(const ECRRecoilPatternInterchangeFormat Format, TConstArrayView<uint8> LeadingBytes)
+{
+	switch (Format)
+	{
+		case ECRRecoilPatternInterchangeFormat::Binary:
+		{
+			uint32 Magic = 0;
+			if (LeadingBytes.Num() < sizeof(Magic))
+			{
+				return false;
+			}
+			FMemory::Memcpy(&Magic, LeadingBytes.GetData(), sizeof(Magic));
+			return Magic == BinaryMagic;
+		}
+		case ECRRecoilPatternInterchangeFormat::Json:
+		{
+			TAnsiStringBuilder<64> Key;
+			Key << '"' << VersionFieldName << '"';
+			return MakeUtf8View(LeadingBytes).Contains(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Key.GetData()), Key.Len()));
+		}
+		case ECRRecoilPatternInterchangeFormat::Csv:
+		{
+			return MakeUtf8View(LeadingBytes).TrimStart().StartsWith(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(CsvSignature)));
+		}
+	}
+	return false;
+}
+
+bool FCRRecoilPatternInterchange::Parse(const ECRRecoilPatternInterchangeFormat Format, TConstArrayView<uint8> Data, FCRRecoilPatternInterchangeData& InOutData, FString& OutError)
+{
+	switch (Format)
+	{
+		case ECRRecoilPatternInterchangeFormat::Binary: return ParseBinary(Data, InOutData, OutError);
+		case ECRRecoilPatternInterchangeFormat::Json: return ParseJson(Data, InOutData, OutError);
+		case ECRRecoilPatternInterchangeFormat::Csv: return ParseCsv(Data, InOutData, OutError);
+	}
+	return false;
+}
+
+bool FCRRecoilPatternInterchange::Write(const ECRRecoilPatternInterchangeFormat Format, const FCRRecoilPatternInterchangeData& Data, TArray<uint8>& OutBytes, FString& OutError)
+{
+	if (!ValidateForWrite(Data, OutError))
+	{
+		return false;
+	}
+
+	switch (Format)
+	{
+		case ECRRecoilPatternInterchangeFormat::Binary: WriteBinary(Data, OutBytes); break;
+		case ECRRecoilPatternInterchangeFormat::Json: WriteJson(Data, OutBytes); break;
+		case ECRRecoilPatternInterchangeFormat::Csv: WriteCsv(Data, OutBytes); break;
+	}
+	return true;
+}
+
+bool FCRRecoilPatternInterchange::ImportIntoPattern(const ECRRecoilPatternInterchangeFormat Format, TConstArrayView<uint8> Data, UCRRecoilPattern& Pattern, FString& OutError)
+{
+	FCRRecoilPatternInterchangeData ParsedData;
+	ParsedData.ReadFromPattern(Pattern);
+
+	if (!Parse(Format, Data, ParsedData, OutError))
+	{
+		return false;
+	}
+
+	Pattern.Modify();
+	Pattern.GetUnitGraph()->Modify();
+	ParsedData.ApplyToPattern(Pattern);
+	Pattern.MarkPackageDirty();
+	return true;
+}
+
+bool FCRRecoilPatternInterchange::ExportPattern(const ECRRecoilPatternInterchangeFormat Format, const UCRRecoilPattern& Pattern, TArray<uint8>& OutBytes, FString& OutError)
+{
+	FCRRecoilPatternInterchangeData Data;
+	Data.ReadFromPattern(Pattern);
+	return Write(Format, Data, OutBytes, OutError);
+}
+
+bool FCRRecoilPatternInterchange::ParseBinary(TConstArrayView<uint8> Data, FCRRecoilPatternInterchangeData& InOutData, FString& OutError)
+{
+	FMemoryReaderView Reader(MakeArrayView(Data.GetData(), Data.Num()));
+
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	uint16 Flags = 0;
+	Reader << Magic << Version << Flags;
+
+	if (Reader.IsError() || Magic != BinaryMagic)
+	{
+		OutError = TEXT("Not a CrystalRecoil binary pattern (bad magic)");
+		return false;
+	}
+
+	if (Version == 0 || Version > BinaryVersion)
+	{
+		OutError = FString::Printf(TEXT("Unsupported binary pattern version %d (newest supported is %d)"), Version, BinaryVersion);
+		return false;
+	}
+
+	if ((Flags & ~BinaryKnownFlags) != 0)
+	{
+		OutError = FString::Printf(TEXT("Unsupported binary pattern flags 0x%04x"), Flags);
+		return false;
+	}
+
+	uint8 EndBehavior = 0;
+	uint8 MotionModel = static_cast<uint8>(InOutData.MotionModel);
+	uint8 PatternIndexing = static_cast<uint8>(InOutData.PatternIndexing);
+	int32 UnitCount = 0;
+
+	if (Version >= 2)
+	{
+		Reader << MotionModel;
+		Reader << InOutData.SpringFrequency;
+		Reader << InOutData.SpringDampingRatio;
+	}
+
+	if (Version >= 3)
+	{
+		Reader << PatternIndexing;
+		Reader << InOutData.ReferenceFireInterval;
+	}
+
+	Reader << InOutData.UpliftSpeed;
+	Reader << InOutData.RecoveryDelay;
+	Reader << InOutData.InitialRecoverySpeed;
+	Reader << InOutData.MaxRecoverySpeed;
+	Reader << InOutData.RecoveryAcceleration;
+	Reader << InOutData.RecoveryCancelThreshold;
+	Reader << EndBehavior;
+	Reader << InOutData.CustomRecoilRestartIndex;
+	Reader << InOutData.RandomXRange;
+	Reader << InOutData.RandomYRange;
+	Reader << UnitCount;
+
+	if (Reader.IsError() || UnitCount < 0)
+	{
+		OutError = TEXT("Truncated or corrupt binary pattern header");
+		return false;
+	}
+
+	if (!StaticEnum<ERecoilPatternEndBehavior>()->IsValidEnumValue(EndBehavior))
+	{
+		OutError = FString::Printf(TEXT("Invalid PatternEndBehavior value %d"), EndBehavior);
+		return false;
+	}
+	InOutData.PatternEndBehavior = static_cast<ERecoilPatternEndBehavior>(EndBehavior);
+
+	if (!StaticEnum<ERecoilMotionModel>()->IsValidEnumValue(MotionModel))
+	{
+		OutError = FString::Printf(TEXT("Invalid MotionModel value %d"), MotionModel);
+		return false;
+	}
+	InOutData.MotionModel = static_cast<ERecoilMotionModel>(MotionModel);
+
+	if (!StaticEnum<ERecoilPatternIndexing>()->IsValidEnumValue(PatternIndexing))
+	{
+		OutError = FString::Printf(TEXT("Invalid PatternIndexing value %d"), PatternIndexing);
+		return false;
+	}
+	InOutData.PatternIndexing = static_cast<ERecoilPatternIndexing>(PatternIndexing);
+
+	// Check the size before allocating, so a corrupt count can't request gigabytes
+	const int64 RemainingBytes = Reader.TotalSize() - Reader.Tell();
+	if (RemainingBytes < static_cast<int64>(UnitCount) * static_cast<int64>(sizeof(FVector2f)))
+	{
+		OutError = FString::Printf(TEXT("Binary pattern declares %d units but only has data for %lld"), UnitCount, RemainingBytes / static_cast<int64>(sizeof(FVector2f)));
+		return false;
+	}
+
+	InOutData.UnitPositions.SetNumUninitialized(UnitCount);
+	for (FVector2f& Position : InOutData.UnitPositions)
+	{
+		Reader << Position;
+	}
+
+	if (Reader.IsError())
+	{
+		OutError = TEXT("Truncated binary pattern unit data");
+		return false;
+	}
+	return true;
+}
+
+bool FCRRecoilPatternInterchange::ParseJson(TConstArrayView<uint8> Data, FCRRecoilPatternInterchangeData& InOutData, FString& OutError)
+{
+	enum class EArrayContext : uint8
+	{
+		None,
+		RandomXRange,
+		RandomYRange,
+		Units,
+		UnitPair
+	};
+
+	// Token-level parse straight from the UTF-8 bytes, no DOM is built
+	const TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(MakeUtf8View(Data));
+
+	EArrayContext ArrayContext = EArrayContext::None;
+	int32 ObjectDepth = 0;
+	int32 PairCount = 0;
+	float Pair[2] = { 0.f, 0.f };
+	bool bFoundVersion = false;
+	bool bFoundUnits = false;
+
+	EJsonNotation Notation;
+	while (Reader->ReadNext(Notation))
+	{
+		const FString& Identifier = Reader->GetIdentifier();
+
+		switch (Notation)
+		{
+			case EJsonNotation::ObjectStart:
+			{
+				if (++ObjectDepth > 1)
+				{
+					OutError = FString::Printf(TEXT("Unexpected nested object '%s'"), *Identifier);
+					return false;
+				}
+				break;
+			}
+			case EJsonNotation::ObjectEnd:
+			{
+				--ObjectDepth;
+				break;
+			}
+			case EJsonNotation::ArrayStart:
+			{
+				if (ArrayContext == EArrayContext::Units)
+				{
+					ArrayContext = EArrayContext::UnitPair;
+					PairCount = 0;
+				}
+				else if (ArrayContext == EArrayContext::None && Identifier.Equals(UnitsFieldName, ESearchCase::IgnoreCase))
+				{
+					ArrayContext = EArrayContext::Units;
+					bFoundUnits = true;
+					InOutData.UnitPositions.Reset();
+				}
+				else if (ArrayContext == EArrayContext::None && (Identifier.Equals(RandomXRangeFieldName, ESearchCase::IgnoreCase) || Identifier.Equals(RandomYRangeFieldName, ESearchCase::IgnoreCase)))
+				{
+					ArrayContext = Identifier.Equals(RandomXRangeFieldName, ESearchCase::IgnoreCase) ? EArrayContext::RandomXRange : EArrayContext::RandomYRange;
+					PairCount = 0;
+				}
+				else
+				{
+					OutError = FString::Printf(TEXT("Unexpected array '%s'"), *Identifier);
+					return false;
+				}
+				break;
+			}
+			case EJsonNotation::ArrayEnd:
+			{
+				if (ArrayContext == EArrayContext::Units)
+				{
+					ArrayContext = EArrayContext::None;
+					break;
+				}
+
+				if (PairCount != 2)
+				{
+					OutError = FString::Printf(TEXT("Expected exactly 2 numbers per pair, got %d"), PairCount);
+					return false;
+				}
+
+				if (ArrayContext == EArrayContext::UnitPair)
+				{
+					InOutData.UnitPositions.Emplace(Pair[0], Pair[1]);
+					ArrayContext = EArrayContext::Units;
+				}
+				else
+				{
+					FVector2f& Range = ArrayContext == EArrayContext::RandomXRange ? InOutData.RandomXRange : InOutData.RandomYRange;
+					Range = FVector2f(Pair[0], Pair[1]);
+					ArrayContext = EArrayContext::None;
+				}
+				break;
+			}
+			case EJsonNotation::Number:
+			{
+				const double Value = Reader->GetValueAsNumber();
+
+				if (ArrayContext == EArrayContext::UnitPair || ArrayContext == EArrayContext::RandomXRange || ArrayContext == EArrayContext::RandomYRange)
+				{
+					if (PairCount >= 2)
+					{
+						OutError = TEXT("Expected exactly 2 numbers per pair");
+						return false;
+					}
+					Pair[PairCount++] = static_cast<float>(Value);
+				}
+				else if (ArrayContext == EArrayContext::Units)
+				{
+					OutError = TEXT("Units must be [X, Y] pairs");
+					return false;
+				}
+				else if (Identifier.Equals(VersionFieldName, ESearchCase::IgnoreCase))
+				{
+					bFoundVersion = true;
+					if (Value > JsonVersion)
+					{
+						OutError = FString::Printf(TEXT("Unsupported JSON pattern version %d (newest supported is %d)"), static_cast<int32>(Value), JsonVersion);
+						return false;
+					}
+				}
+				else if (Identifier.Equals(RestartIndexFieldName, ESearchCase::IgnoreCase))
+				{
+					InOutData.CustomRecoilRestartIndex = static_cast<int32>(Value);
+				}
+				else if (float* Field = FindFloatField(InOutData, Identifier))
+				{
+					*Field = static_cast<float>(Value);
+				}
+				// Unknown scalar fields are ignored so newer tools can add metadata
+				break;
+			}
+			case EJsonNotation::String:
+			{
+				if (Identifier.Equals(EndBehaviorFieldName, ESearchCase::IgnoreCase) && !ParseEnumName(Reader->GetValueAsString(), InOutData.PatternEndBehavior))
+				{
+					OutError = FString::Printf(TEXT("Unknown PatternEndBehavior '%s'"), *Reader->GetValueAsString());
+					return false;
+				}
+				if (Identifier.Equals(MotionModelFieldName, ESearchCase::IgnoreCase) && !ParseEnumName(Reader->GetValueAsString(), InOutData.MotionModel))
+				{
+					OutError = FString::Printf(TEXT("Unknown MotionModel '%s'"), *Reader->GetValueAsString());
+					return false;
+				}
+				if (Identifier.Equals(PatternIndexingFieldName, ESearchCase::IgnoreCase) && !ParseEnumName(Reader->GetValueAsString(), InOutData.PatternIndexing))
+				{
+					OutError = FString::Printf(TEXT("Unknown PatternIndexing '%s'"), *Reader->GetValueAsString());
+					return false;
+				}
+				break;
+			}
+			case EJsonNotation::Error:
+			{
+				OutError = Reader->GetErrorMessage();
+				return false;
+			}
+			default:
+			{
+				break;
+			}
+		}
+	}
+
+	if (Notation == EJsonNotation::Error || !Reader->GetErrorMessage().IsEmpty())
+	{
+		OutError = Reader->GetErrorMessage();
+		return false;
+	}
+
+	if (!bFoundVersion)
+	{
+		OutError = FString::Printf(TEXT("Missing '%s' version field"), VersionFieldName);
+		return false;
+	}
+
+	if (!bFoundUnits)
+	{
+		OutError = FString::Printf(TEXT("Missing '%s' array"), UnitsFieldName);
+		return false;
+	}
+	return true;
+}
+
+bool FCRRecoilPatternInterchange::ParseCsv(TConstArrayView<uint8> Data, FCRRecoilPatternInterchangeData& InOutData, FString& OutError)
+{
+	FUtf8StringView Remaining = MakeUtf8View(Data);
+	bool bFoundSignature = false;
+	bool bInUnits = false;
+	int32 LineNumber = 0;
+
+	InOutData.UnitPositions.Reset();
+
+	while (!Remaining.IsEmpty())
+	{
+		int32 LineEnd = INDEX_NONE;
+		Remaining.FindChar(UTF8TEXT('\n'), LineEnd);
+		const FUtf8StringView Line = (LineEnd == INDEX_NONE ? Remaining : Remaining.Left(LineEnd)).TrimStartAndEnd();
+		Remaining.RightChopInline(LineEnd == INDEX_NONE ? Remaining.Len() : LineEnd + 1);
+		++LineNumber;
+
+		if (Line.IsEmpty())
+		{
+			continue;
+		}
+
+		if (Line.StartsWith(UTF8TEXT('#')))
+		{
+			const FUtf8StringView Signature(reinterpret_cast<const UTF8CHAR*>(CsvSignature));
+			if (Line.StartsWith(Signature))
+			{
+				bFoundSignature = true;
+
+				// "v<N>" after the signature, files written before it was checked may omit it
+				FUtf8StringView VersionText = Line.RightChop(Signature.Len()).TrimStart();
+				if (VersionText.StartsWith(UTF8TEXT('v')) || VersionText.StartsWith(UTF8TEXT('V')))
+				{
+					int32 Version = 0;
+					if (!ParseIntCell(VersionText.RightChop(1), Version) || Version > CsvVersion)
+					{
+						TStringBuilder<64> Builder;
+						Builder << VersionText;
+						OutError = FString::Printf(TEXT("Unsupported CSV pattern version '%s' (newest supported is %d)"), *Builder, CsvVersion);
+						return false;
+					}
+				}
+			}
+			continue;
+		}
+
+		if (!bFoundSignature)
+		{
+			OutError = FString::Printf(TEXT("Missing '%hs' header line"), CsvSignature);
+			return false;
+		}
+
+		// Up to three cells: Key,Value[,Value] or X,Y
+		TArray<FUtf8StringView, TInlineAllocator<3>> Cells;
+		FUtf8StringView CellsRemaining = Line;
+		while (Cells.Num() < 3)
+		{
+			int32 Comma = INDEX_NONE;
+			CellsRemaining.FindChar(UTF8TEXT(','), Comma);
+			Cells.Add((Comma == INDEX_NONE ? CellsRemaining : CellsRemaining.Left(Comma)).TrimStartAndEnd());
+			if (Comma == INDEX_NONE)
+			{
+				break;
+			}
+			CellsRemaining.RightChopInline(Comma + 1);
+		}
+
+		if (Cells.Num() < 2)
+		{
+			OutError = FString::Printf(TEXT("Line %d: expected at least 2 cells"), LineNumber);
+			return false;
+		}
+
+		if (EqualsField(Cells[0], TEXT("X")) && EqualsField(Cells[1], TEXT("Y")))
+		{
+			bInUnits = true;
+			continue;
+		}
+
+		if (bInUnits)
+		{
+			FVector2f Position;
+			if (!ParseFloatCell(Cells[0], Position.X) || !ParseFloatCell(Cells[1], Position.Y))
+			{
+				OutError = FString::Printf(TEXT("Line %d: invalid unit position"), LineNumber);
+				return false;
+			}
+			InOutData.UnitPositions.Add(Position);
+			continue;
+		}
+
+		TStringBuilder<64> Key;
+		Key << Cells[0];
+
+		bool bParsed = true;
+		if (Key.ToView().Equals(RestartIndexFieldName, ESearchCase::IgnoreCase))
+		{
+			bParsed = ParseIntCell(Cells[1], InOutData.CustomRecoilRestartIndex);
+		}
+		else if (Key.ToView().Equals(EndBehaviorFieldName, ESearchCase::IgnoreCase))
+		{
+			TStringBuilder<64> Value;
+			Value << Cells[1];
+			bParsed = ParseEnumName(Value.ToView(), InOutData.PatternEndBehavior);
+		}
+		else if (Key.ToView().Equals(MotionModelFieldName, ESearchCase::IgnoreCase))
+		{
+			TStringBuilder<64> Value;
+			Value << Cells[1];
+			bParsed = ParseEnumName(Value.ToView(), InOutData.MotionModel);
+		}
+		else if (Key.ToView().Equals(PatternIndexingFieldName, ESearchCase::IgnoreCase))
+		{
+			TStringBuilder<64> Value;
+			Value << Cells[1];
+			bParsed = ParseEnumName(Value.ToView(), InOutData.PatternIndexing);
+		}
+		else if (Key.ToView().Equals(RandomXRangeFieldName, ESearchCase::IgnoreCase) || Key.ToView().Equals(RandomYRangeFieldName, ESearchCase::IgnoreCase))
+		{
+			FVector2f& Range = Key.ToView().Equals(RandomXRangeFieldName, ESearchCase::IgnoreCase) ? InOutData.RandomXRange : InOutData.RandomYRange;
+			bParsed = Cells.Num() == 3 && ParseFloatCell(Cells[1], Range.X) && ParseFloatCell(Cells[2], Range.Y);
+		}
+		else if (float* Field = FindFloatField(InOutData, Key.ToView()))
+		{
+			bParsed = ParseFloatCell(Cells[1], *Field);
+		}
+		// Unknown keys are ignored, same as JSON
+
+		if (!bParsed)
+		{
+			OutError = FString::Printf(TEXT("Line %d: invalid value for '%s'"), LineNumber, *Key);
+			return false;
+		}
+	}
+
+	if (!bFoundSignature)
+	{
+		OutError = FString::Printf(TEXT("Missing '%hs' header line"), CsvSignature);
+		return false;
+	}
+	return true;
+}
+
+bool FCRRecoilPatternInterchange::ValidateForWrite(const FCRRecoilPatternInterchangeData& Data, FString& OutError)
+{
+	// Checked for every format, so the three stay interchangeable
+	for (const FCRInterchangeFloatField& Field : InterchangeFloatFields)
+	{
+		if (!FMath::IsFinite(Data.*Field.Member))
+		{
+			OutError = FString::Printf(TEXT("'%s' is not a finite number"), Field.Name);
+			return false;
+		}
+	}
+
+	if (!FMath::IsFinite(Data.RandomXRange.X) || !FMath::IsFinite(Data.RandomXRange.Y))
+	{
+		OutError = FString::Printf(TEXT("'%s' is not a finite range"), RandomXRangeFieldName);
+		return false;
+	}
+
+	if (!FMath::IsFinite(Data.RandomYRange.X) || !FMath::IsFinite(Data.RandomYRange.Y))
+	{
+		OutError = FString::Printf(TEXT("'%s' is not a finite range"), RandomYRangeFieldName);
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Data.UnitPositions.Num(); ++Index)
+	{
+		if (!FMath::IsFinite(Data.UnitPositions[Index].X) || !FMath::IsFinite(Data.UnitPositions[Index].Y))
+		{
+			OutError = FString::Printf(TEXT("Unit %d has a position that is not finite"), Index);
+			return false;
+		}
+	}
+	return true;
+}
+
+void FCRRecoilPatternInterchange::WriteBinary(const FCRRecoilPatternInterchangeData& Data, TArray<uint8>& OutBytes)
+{
+	FCRRecoilPatternInterchangeData WritableData = Data;
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 Magic = BinaryMagic;
+	uint16 Version = BinaryVersion;
+	uint16 Flags = 0;
+	uint8 EndBehavior = static_cast<uint8>(WritableData.PatternEndBehavior);
+	uint8 MotionModel = static_cast<uint8>(WritableData.MotionModel);
+	uint8 PatternIndexing = static_cast<uint8>(WritableData.PatternIndexing);
+	int32 UnitCount = WritableData.UnitPositions.Num();
+
+	Writer << Magic << Version << Flags;
+	Writer << MotionModel;
+	Writer << WritableData.SpringFrequency;
+	Writer << WritableData.SpringDampingRatio;
+	Writer << PatternIndexing;
+	Writer << WritableData.ReferenceFireInterval;
+	Writer << WritableData.UpliftSpeed;
+	Writer << WritableData.RecoveryDelay;
+	Writer << WritableData.InitialRecoverySpeed;
+	Writer << WritableData.MaxRecoverySpeed;
+	Writer << WritableData.RecoveryAcceleration;
+	Writer << WritableData.RecoveryCancelThreshold;
+	Writer << EndBehavior;
+	Writer << WritableData.CustomRecoilRestartIndex;
+	Writer << WritableData.RandomXRange;
+	Writer << WritableData.RandomYRange;
+	Writer << UnitCount;
+
+	for (FVector2f& Position : WritableData.UnitPositions)
+	{
+		Writer << Position;
+	}
+}
+
+void FCRRecoilPatternInterchange::WriteJson(const FCRRecoilPatternInterchangeData& Data, TArray<uint8>& OutBytes)
+{
+	// Everything written is ASCII, so an ANSI builder produces valid UTF-8
+	TAnsiStringBuilder<4096> Builder;
+	Builder.Appendf("{\n\t\"%s\": %d,\n", TCHAR_TO_ANSI(VersionFieldName), JsonVersion);
+	Builder.Appendf("\t\"%s\": \"%s\",\n", TCHAR_TO_ANSI(MotionModelFieldName), TCHAR_TO_ANSI(*GetEnumName(Data.MotionModel)));
+
+	for (const FCRInterchangeFloatField& Field : InterchangeFloatFields)
+	{
+		Builder.Appendf("\t\"%s\": %.9g,\n", TCHAR_TO_ANSI(Field.Name), Data.*Field.Member);
+	}
+
+	Builder.Appendf("\t\"%s\": \"%s\",\n", TCHAR_TO_ANSI(PatternIndexingFieldName), TCHAR_TO_ANSI(*GetEnumName(Data.PatternIndexing)));
+	Builder.Appendf("\t\"%s\": \"%s\",\n", TCHAR_TO_ANSI(EndBehaviorFieldName), TCHAR_TO_ANSI(*GetEnumName(Data.PatternEndBehavior)));
+	Builder.Appendf("\t\"%s\": %d,\n", TCHAR_TO_ANSI(RestartIndexFieldName), Data.CustomRecoilRestartIndex);
+	Builder.Appendf("\t\"%s\": [%.9g, %.9g],\n", TCHAR_TO_ANSI(RandomXRangeFieldName), Data.RandomXRange.X, Data.RandomXRange.Y);
+	Builder.Appendf("\t\"%s\": [%.9g, %.9g],\n", TCHAR_TO_ANSI(RandomYRangeFieldName), Data.RandomYRange.X, Data.RandomYRange.Y);
+	Builder.Appendf("\t\"%s\": [", TCHAR_TO_ANSI(UnitsFieldName));
+
+	for (int32 Index = 0; Index < Data.UnitPositions.Num(); ++Index)
+	{
+		const FVector2f& Position = Data.UnitPositions[Index];
+		Builder.Appendf("%s\n\t\t[%.9g, %.9g]", Index > 0 ? "," : "", Position.X, Position.Y);
+	}
+
+	Builder.Append(Data.UnitPositions.IsEmpty() ? "]\n}\n" : "\n\t]\n}\n");
+	AppendBuilder(OutBytes, Builder);
+}
+
+void FCRRecoilPatternInterchange::WriteCsv(const FCRRecoilPatternInterchangeData& Data, TArray<uint8>& OutBytes)
+{
+	TAnsiStringBuilder<4096> Builder;
+	Builder.Appendf("%s v%d\n", CsvSignature, CsvVersion);
+	Builder.Appendf("%s,%s\n", TCHAR_TO_ANSI(MotionModelFieldName), TCHAR_TO_ANSI(*GetEnumName(Data.MotionModel)));
+
+	for (const FCRInterchangeFloatField& Field : InterchangeFloatFields)
+	{
+		Builder.Appendf("%s,%.9g\n", TCHAR_TO_ANSI(Field.Name), Data.*Field.Member);
+	}
+
+	Builder.Appendf("%s,%s\n", TCHAR_TO_ANSI(PatternIndexingFieldName), TCHAR_TO_ANSI(*GetEnumName(Data.PatternIndexing)));
+	Builder.Appendf("%s,%s\n", TCHAR_TO_ANSI(EndBehaviorFieldName), TCHAR_TO_ANSI(*GetEnumName(Data.PatternEndBehavior)));
+	Builder.Appendf("%s,%d\n", TCHAR_TO_ANSI(RestartIndexFieldName), Data.CustomRecoilRestartIndex);
+	Builder.Appendf("%s,%.9g,%.9g\n", TCHAR_TO_ANSI(RandomXRangeFieldName), Data.RandomXRange.X, Data.RandomXRange.Y);
+	Builder.Appendf("%s,%.9g,%.9g\n", TCHAR_TO_ANSI(RandomYRangeFieldName), Data.RandomYRange.X, Data.RandomYRange.Y);
+	Builder.Append("X,Y\n");
+
+	for (const FVector2f& Position : Data.UnitPositions)
+	{
+		Builder.Appendf("%.9g,%.9g\n", Position.X, Position.Y);
+	}
+
+	AppendBuilder(OutBytes, Builder);
+}
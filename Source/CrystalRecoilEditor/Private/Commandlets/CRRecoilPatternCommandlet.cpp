@@ -0,0 +1,210 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Commandlets/CRRecoilPatternCommandlet.h"
+#include "Algo/Count.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "CrystalRecoilEditor.h"
+#include "Data/CRRecoilPattern.h"
+#include "Data/CRRecoilUnitGraph.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+namespace
+{
+	struct FCRRecoilPatternCheckResult
+	{
+		TArray<FString> Errors;
+		bool bBakeChanged = false;
+		uint64 UnitsHash = 0;
+		uint64 ContentHash = 0;
+		SIZE_T BakedDataSize = 0;
+	};
+}
+
+UCRRecoilPatternCommandlet::UCRRecoilPatternCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UCRRecoilPatternCommandlet::Main(const FString& Params)
+{
+	FString ContentPath;
+	FParse::Value(*Params, TEXT("Path="), ContentPath);
+
+	FString ReportFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("CrystalRecoil"), TEXT("RecoilPatternReport.json"));
+	FParse::Value(*Params, TEXT("Report="), ReportFile);
+
+	const bool bSave = FParse::Param(*Params, TEXT("Save"));
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UCRRecoilPattern::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	if (!ContentPath.IsEmpty())
+	{
+		Filter.PackagePaths.Add(*ContentPath);
+		Filter.bRecursivePaths = true;
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	// Loading has to happen on the game thread, validation and hashing only read the patterns and run in parallel
+	TArray<UCRRecoilPattern*> Patterns;
+	Patterns.Reserve(Assets.Num());
+
+	for (const FAssetData& Asset : Assets)
+	{
+		UCRRecoilPattern* Pattern = Cast<UCRRecoilPattern>(Asset.GetAsset());
+		if (!Pattern)
+		{
+			UE_LOG(LogCrystalRecoilEditor, Error, TEXT("Failed to load %s"), *Asset.GetObjectPathString());
+			continue;
+		}
+		Patterns.Add(Pattern);
+	}
+
+	TArray<FCRRecoilPatternCheckResult> Results;
+	Results.SetNum(Patterns.Num());
+
+	ParallelFor(Patterns.Num(), [&Patterns, &Results](const int32 Index)
+	{
+		FCRRecoilPatternCheckResult& Result = Results[Index];
+		Patterns[Index]->ValidatePattern(Result.Errors);
+		Result.UnitsHash = Patterns[Index]->ComputeUnitsHash();
+		Result.ContentHash = Patterns[Index]->ComputeContentHash();
+	});
+
+	// Baking writes to the pattern objects, so it stays on the game thread
+	for (int32 Index = 0; Index < Patterns.Num(); ++Index)
+	{
+		FCRRecoilPatternCheckResult& Result = Results[Index];
+		if (Result.Errors.IsEmpty())
+		{
+			Result.bBakeChanged = Patterns[Index]->BakeRuntimeData();
+		}
+		Result.BakedDataSize = Patterns[Index]->GetBakedDataSize();
+	}
+
+	// Patterns with the same units share their baked data at runtime, fully identical patterns could be merged into one asset
+	TMap<uint64, TArray<int32>> PatternsByContentHash;
+	TMap<uint64, int32> PatternCountByUnitsHash;
+	for (int32 Index = 0; Index < Patterns.Num(); ++Index)
+	{
+		PatternsByContentHash.FindOrAdd(Results[Index].ContentHash).Add(Index);
+		++PatternCountByUnitsHash.FindOrAdd(Results[Index].UnitsHash);
+	}
+
+	SIZE_T SharedBakedBytes = 0;
+	for (int32 Index = 0; Index < Patterns.Num(); ++Index)
+	{
+		// Every pattern but the first with the same units reuses the shared copy
+		int32& RemainingCount = PatternCountByUnitsHash[Results[Index].UnitsHash];
+		if (--RemainingCount > 0)
+		{
+			SharedBakedBytes += Results[Index].BakedDataSize;
+		}
+	}
+
+	int32 SavedCount = 0;
+	FString Report;
+	const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Report);
+
+	Writer->WriteObjectStart();
+	Writer->WriteArrayStart(TEXT("patterns"));
+
+	for (int32 Index = 0; Index < Patterns.Num(); ++Index)
+	{
+		UCRRecoilPattern* Pattern = Patterns[Index];
+		const FCRRecoilPatternCheckResult& Result = Results[Index];
+
+		for (const FString& Error : Result.Errors)
+		{
+			UE_LOG(LogCrystalRecoilEditor, Error, TEXT("%s: %s"), *Pattern->GetPathName(), *Error);
+		}
+
+		if (Result.bBakeChanged && bSave)
+		{
+			UPackage* Package = Pattern->GetPackage();
+			Package->MarkPackageDirty();
+
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+
+			const FString PackageFilename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+			if (UPackage::SavePackage(Package, Pattern, *PackageFilename, SaveArgs))
+			{
+				++SavedCount;
+			}
+			else
+			{
+				UE_LOG(LogCrystalRecoilEditor, Error, TEXT("Failed to save %s"), *PackageFilename);
+			}
+		}
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("asset"), Pattern->GetPathName());
+		Writer->WriteValue(TEXT("units"), Pattern->GetUnitGraph() ? Pattern->GetUnitGraph()->GetUnitCount() : 0);
+		Writer->WriteValue(TEXT("valid"), Result.Errors.IsEmpty());
+		Writer->WriteValue(TEXT("bakeChanged"), Result.bBakeChanged);
+		Writer->WriteValue(TEXT("errors"), Result.Errors);
+		Writer->WriteObjectEnd();
+	}
+
+	const int32 FailedCount = Algo::CountIf(Results, [](const FCRRecoilPatternCheckResult& Result) { return !Result.Errors.IsEmpty(); });
+
+	Writer->WriteArrayEnd();
+
+	int32 DuplicateCount = 0;
+	Writer->WriteArrayStart(TEXT("duplicates"));
+	for (const TPair<uint64, TArray<int32>>& Group : PatternsByContentHash)
+	{
+		if (Group.Value.Num() < 2)
+		{
+			continue;
+		}
+
+		DuplicateCount += Group.Value.Num() - 1;
+
+		TArray<FString> AssetPaths;
+		for (const int32 Index : Group.Value)
+		{
+			AssetPaths.Add(Patterns[Index]->GetPathName());
+		}
+
+		UE_LOG(LogCrystalRecoilEditor, Display, TEXT("Identical recoil patterns: %s"), *FString::Join(AssetPaths, TEXT(", ")));
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("contentHash"), FString::Printf(TEXT("%016llx"), Group.Key));
+		Writer->WriteValue(TEXT("assets"), AssetPaths);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteValue(TEXT("duplicateCount"), DuplicateCount);
+	Writer->WriteValue(TEXT("sharedBakedBytes"), static_cast<int64>(SharedBakedBytes));
+	Writer->WriteValue(TEXT("checked"), Patterns.Num());
+	Writer->WriteValue(TEXT("failed"), FailedCount);
+	Writer->WriteValue(TEXT("loadFailures"), Assets.Num() - Patterns.Num());
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(Report, *ReportFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogCrystalRecoilEditor, Error, TEXT("Failed to write report %s"), *ReportFile);
+		return 1;
+	}
+
+	UE_LOG(LogCrystalRecoilEditor, Display, TEXT("Checked %d recoil patterns: %d failed, %d saved, %d duplicates, %llu baked bytes shared at runtime. Report: %s"), Patterns.Num(), FailedCount, SavedCount, DuplicateCount, static_cast<uint64>(SharedBakedBytes), *ReportFile);
+	return FailedCount > 0 || Patterns.Num() != Assets.Num() ? 1 : 0;
+}
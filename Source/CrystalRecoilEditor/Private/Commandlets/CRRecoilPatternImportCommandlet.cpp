@@ -0,0 +1,106 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Commandlets/CRRecoilPatternImportCommandlet.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetTools/CRRecoilPatternInterchange.h"
+#include "CrystalRecoilEditor.h"
+#include "Data/CRRecoilPattern.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "ObjectTools.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+UCRRecoilPatternImportCommandlet::UCRRecoilPatternImportCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UCRRecoilPatternImportCommandlet::Main(const FString& Params)
+{
+	FString SourceDirectory;
+	FString DestinationPath;
+	if (!FParse::Value(*Params, TEXT("Source="), SourceDirectory) || !FParse::Value(*Params, TEXT("Dest="), DestinationPath))
+	{
+		UE_LOG(LogCrystalRecoilEditor, Error, TEXT("Usage: -run=CRRecoilPatternImport -Source=<Directory> -Dest=/Game/<Path>"));
+		return 1;
+	}
+
+	TArray<FString> Files;
+	for (const ECRRecoilPatternInterchangeFormat Format : { ECRRecoilPatternInterchangeFormat::Binary, ECRRecoilPatternInterchangeFormat::Json, ECRRecoilPatternInterchangeFormat::Csv })
+	{
+		IFileManager::Get().FindFilesRecursive(Files, *SourceDirectory, *FString::Printf(TEXT("*.%s"), FCRRecoilPatternInterchange::GetExtension(Format)), true, false, false);
+	}
+
+	int32 ImportedCount = 0;
+	int32 FailedCount = 0;
+	TArray<uint8> FileBytes;
+
+	for (const FString& File : Files)
+	{
+		const ECRRecoilPatternInterchangeFormat Format = FCRRecoilPatternInterchange::FormatFromExtension(FPaths::GetExtension(File)).GetValue();
+
+		FileBytes.Reset();
+		if (!FFileHelper::LoadFileToArray(FileBytes, *File))
+		{
+			UE_LOG(LogCrystalRecoilEditor, Error, TEXT("Failed to read %s"), *File);
+			++FailedCount;
+			continue;
+		}
+
+		// .json and .csv files without the signature belong to someone else
+		if (!FCRRecoilPatternInterchange::HasSignature(Format, FileBytes))
+		{
+			UE_LOG(LogCrystalRecoilEditor, Display, TEXT("Skipping %s, not a recoil pattern file"), *File);
+			continue;
+		}
+
+		const FString AssetName = ObjectTools::SanitizeObjectName(FPaths::GetBaseFilename(File));
+		const FString PackageName = FPaths::Combine(DestinationPath, AssetName);
+
+		UPackage* Package = CreatePackage(*PackageName);
+		Package->FullyLoad();
+
+		UCRRecoilPattern* Pattern = FindObject<UCRRecoilPattern>(Package, *AssetName);
+		const bool bIsNewAsset = Pattern == nullptr;
+		if (bIsNewAsset)
+		{
+			Pattern = NewObject<UCRRecoilPattern>(Package, *AssetName, RF_Public | RF_Standalone);
+		}
+
+		FString Error;
+		if (!FCRRecoilPatternInterchange::ImportIntoPattern(Format, FileBytes, *Pattern, Error))
+		{
+			UE_LOG(LogCrystalRecoilEditor, Error, TEXT("Failed to import %s: %s"), *File, *Error);
+			++FailedCount;
+			continue;
+		}
+
+		if (bIsNewAsset)
+		{
+			FAssetRegistryModule::AssetCreated(Pattern);
+		}
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.Error = GError;
+
+		const FString PackageFilename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+		if (!UPackage::SavePackage(Package, Pattern, *PackageFilename, SaveArgs))
+		{
+			UE_LOG(LogCrystalRecoilEditor, Error, TEXT("Failed to save %s"), *PackageFilename);
+			++FailedCount;
+			continue;
+		}
+
+		UE_LOG(LogCrystalRecoilEditor, Display, TEXT("Imported %s -> %s (%d units)"), *File, *PackageName, Pattern->GetUnitGraph()->GetUnitCount());
+		++ImportedCount;
+	}
+
+	UE_LOG(LogCrystalRecoilEditor, Display, TEXT("Recoil pattern import finished: %d imported, %d failed"), ImportedCount, FailedCount);
+	return FailedCount > 0 ? 1 : 0;
+}
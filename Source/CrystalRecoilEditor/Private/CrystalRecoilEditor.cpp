@@ -4,6 +4,8 @@
 
 #define LOCTEXT_NAMESPACE "CrystalRecoil"
 
+DEFINE_LOG_CATEGORY(LogCrystalRecoilEditor);
+
 void FCrystalRecoilEditorModule::StartupModule()
 {
 	FCRRecoilPatternEditorCommands::Register();
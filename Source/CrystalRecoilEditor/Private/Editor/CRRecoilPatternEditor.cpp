@@ -7,42 +7,90 @@
 #include "IStructureDetailsView.h"
 #include "Widget/CRRecoilUnitGraphEditor.h"
 
+FCRRecoilUnitSelection::FScopedBatch::FScopedBatch(FCRRecoilUnitSelection& InSelection)
+	: Selection(InSelection)
+{
+	++Selection.BatchDepth;
+}
+
+FCRRecoilUnitSelection::FScopedBatch::~FScopedBatch()
+{
+	check(Selection.BatchDepth > 0);
+	if (--Selection.BatchDepth == 0 && Selection.bPendingSelectionChanged)
+	{
+		Selection.bPendingSelectionChanged = false;
+		Selection.OnSelectionChanged.Broadcast();
+	}
+}
+
 void FCRRecoilUnitSelection::AddSelection(const int32 UnitID)
 {
-	SelectedUnits.AddUnique(UnitID);
-	OnSelectionChanged.Broadcast();
+	FScopedBatch Batch(*this);
+	AddSelectionInternal(UnitID);
 }
 
 void FCRRecoilUnitSelection::AddSelection(const TArray<int32>& UnitsArray)
 {
+	FScopedBatch Batch(*this);
+	SelectedUnitSet.Reserve(SelectedUnitSet.Num() + UnitsArray.Num());
+
 	for (const int32 Unit : UnitsArray)
 	{
-		SelectedUnits.AddUnique(Unit);
+		AddSelectionInternal(Unit);
 	}
-
-	OnSelectionChanged.Broadcast();
 }
 
 void FCRRecoilUnitSelection::AddSelection(const TArray<FCRRecoilUnit>& RecoilUnitsArray)
 {
+	FScopedBatch Batch(*this);
+	SelectedUnitSet.Reserve(SelectedUnitSet.Num() + RecoilUnitsArray.Num());
+
 	for (const FCRRecoilUnit& RecoilUnit : RecoilUnitsArray)
 	{
-		SelectedUnits.AddUnique(RecoilUnit.ID);
+		AddSelectionInternal(RecoilUnit.ID);
 	}
-
-	OnSelectionChanged.Broadcast();
 }
 
 void FCRRecoilUnitSelection::RemoveSelection(const int32 UnitID)
 {
-	SelectedUnits.Remove(UnitID);
-	OnSelectionChanged.Broadcast();
+	FScopedBatch Batch(*this);
+	if (SelectedUnitSet.Remove(UnitID) > 0)
+	{
+		SelectedUnits.Remove(UnitID);
+		NotifySelectionChanged();
+	}
+}
+
+void FCRRecoilUnitSelection::SetSelection(const TArray<int32>& UnitsArray)
+{
+	FScopedBatch Batch(*this);
+
+	// Marquee drags call this on every mouse move, most of which don't change anything
+	if (UnitsArray.Num() == SelectedUnits.Num() && !UnitsArray.ContainsByPredicate([this](const int32 UnitID) { return !SelectedUnitSet.Contains(UnitID); }))
+	{
+		return;
+	}
+
+	SelectedUnits.Reset();
+	SelectedUnitSet.Reset();
+	SelectedUnitSet.Reserve(UnitsArray.Num());
+
+	for (const int32 Unit : UnitsArray)
+	{
+		AddSelectionInternal(Unit);
+	}
+	NotifySelectionChanged();
 }
 
 void FCRRecoilUnitSelection::ClearSelection()
 {
-	SelectedUnits.Empty();
-	OnSelectionChanged.Broadcast();
+	FScopedBatch Batch(*this);
+	if (!SelectedUnits.IsEmpty())
+	{
+		SelectedUnits.Empty();
+		SelectedUnitSet.Empty();
+		NotifySelectionChanged();
+	}
 }
 
 const TArray<int32>& FCRRecoilUnitSelection::GetSelection() const
@@ -70,7 +118,7 @@ bool FCRRecoilUnitSelection::IsEmpty() const
 
 bool FCRRecoilUnitSelection::IsUnitSelected(const int32 UnitID) const
 {
-	return SelectedUnits.Contains(UnitID);
+	return SelectedUnitSet.Contains(UnitID);
 }
 
 int32 FCRRecoilUnitSelection::GetNum() const
@@ -78,6 +126,25 @@ int32 FCRRecoilUnitSelection::GetNum() const
 	return SelectedUnits.Num();
 }
 
+void FCRRecoilUnitSelection::AddSelectionInternal(const int32 UnitID)
+{
+	bool bAlreadySelected = false;
+	SelectedUnitSet.Add(UnitID, &bAlreadySelected);
+
+	if (!bAlreadySelected)
+	{
+		SelectedUnits.Add(UnitID);
+		NotifySelectionChanged();
+	}
+}
+
+void FCRRecoilUnitSelection::NotifySelectionChanged()
+{
+	// Every edit runs inside a batch, the outermost one broadcasts
+	check(BatchDepth > 0);
+	bPendingSelectionChanged = true;
+}
+
 FCRRecoilPatternEditor::FCRRecoilPatternEditor()
 {
 	RecoilUnitSelection.OnSelectionChanged.AddRaw<FCRRecoilPatternEditor>(this, &FCRRecoilPatternEditor::OnSelectionChanged);
@@ -280,6 +347,7 @@ void FCRRecoilPatternEditor::ExtendToolBar()
 
 		Builder.AddWidget(SNew(SSpacer).Size(FVector2D(4.f, 0.f)));
 
+		Builder.BeginBlockGroup();
 		Builder.AddToolBarButton(
 			Commands.ZoomViewToFit,
 			"RecoilPatternToolBarExtHook",
@@ -287,6 +355,15 @@ void FCRRecoilPatternEditor::ExtendToolBar()
 			TAttribute<FText>(),
 			FSlateIcon("EditorStyle", "Curve.ZoomToFit"));
 
+		Builder.AddComboButton(
+			FUIAction(),
+			FOnGetContent::CreateSP(this, &FCRRecoilPatternEditor::GetMenuContent_ZoomViewToFit),
+			FText(),
+			Commands.ZoomViewToFit->GetDescription(),
+			FSlateIcon(),
+			true);
+		Builder.EndBlockGroup();
+
 		Builder.EndSection();
 		Builder.PopCommandList();
 	};
@@ -450,6 +527,7 @@ void FCRRecoilPatternEditor::Command_SelectAll()
 {
 	UCRRecoilUnitGraph* RecoilUnitGraph = GetRecoilUnitGraph();
 	check(RecoilUnitGraph);
+	FCRRecoilUnitSelection::FScopedBatch SelectionBatch(RecoilUnitSelection);
 	RecoilUnitSelection.ClearSelection();
 	RecoilUnitSelection.AddSelection(RecoilUnitGraph->GetRecoilUnits());
 }
@@ -490,7 +568,14 @@ void FCRRecoilPatternEditor::Command_SwitchUnitScaling()
 
 void FCRRecoilPatternEditor::Command_ZoomToFitAllUnits() const
 {
-	UnitGraphWidget->ZoomToFitAllUnits();
+	if (bAnimateZoomToFit)
+	{
+		UnitGraphWidget->AnimateZoomToFitAllUnits();
+	}
+	else
+	{
+		UnitGraphWidget->ZoomToFitAllUnits();
+	}
 }
 
 void FCRRecoilPatternEditor::Command_ToggleShortcutsVisibility()
@@ -561,6 +646,32 @@ TSharedRef<SWidget> FCRRecoilPatternEditor::GetMenuContent_UnitsSnapping()
 	return MenuBuilder.MakeWidget();
 }
 
+TSharedRef<SWidget> FCRRecoilPatternEditor::GetMenuContent_ZoomViewToFit()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	MenuBuilder.AddMenuEntry(
+		NSLOCTEXT("CrystalRecoil", "AnimateZoomToFit", "Animate Zoom to Fit"),
+		NSLOCTEXT("CrystalRecoil", "AnimateZoomToFitTooltip", "Ease the view towards the units instead of jumping there"),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateLambda([this]()
+			{
+				bAnimateZoomToFit = !bAnimateZoomToFit;
+			}),
+			FCanExecuteAction(),
+			FIsActionChecked::CreateLambda([this]()
+			{
+				return bAnimateZoomToFit;
+			})
+		),
+		NAME_None,
+		EUserInterfaceActionType::ToggleButton
+	);
+
+	return MenuBuilder.MakeWidget();
+}
+
 void FCRRecoilPatternEditor::OnSelectionChanged() const
 {
 	if (RecoilUnitSelection.GetNum() == 1)
@@ -595,6 +706,7 @@ void FCRRecoilPatternEditor::OnSelectionChanged() const
 				// Write edited copy back into the actual array
 				const FCRRecoilUnit* EditedUnit = reinterpret_cast<const FCRRecoilUnit*>(SelectedUnitScope->GetStructMemory());
 				*ActualUnit = *EditedUnit;
+				GetRecoilUnitGraph()->MarkUnitsModified();
 			});
 
 			UnitDetailsWidget->SetStructureData(SelectedUnitScope);
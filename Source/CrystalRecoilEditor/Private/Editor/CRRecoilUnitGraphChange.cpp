@@ -0,0 +1,95 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Editor/CRRecoilUnitGraphChange.h"
+#include "Misc/ITransaction.h"
+
+FCRRecoilUnitGraphChange::FCRRecoilUnitGraphChange(const UCRRecoilUnitGraph& UnitGraph, TConstArrayView<uint32> InTouchedIDs, const bool bMayRearrange)
+	: TouchedIDs(InTouchedIDs)
+	, BeforeNextID(UnitGraph.GetNextID())
+{
+	if (bMayRearrange && !UnitGraph.IsInRearrangeOrder())
+	{
+		TouchedIDs.Reset(UnitGraph.GetUnitCount());
+		for (int32 Index = 0; Index < UnitGraph.GetUnitCount(); ++Index)
+		{
+			TouchedIDs.Add(UnitGraph.GetUnitAt(Index).ID);
+		}
+	}
+
+	CaptureUnits(UnitGraph, TouchedIDs, BeforeUnits);
+}
+
+void FCRRecoilUnitGraphChange::RecordAfter(const UCRRecoilUnitGraph& UnitGraph, TConstArrayView<uint32> AddedIDs)
+{
+	TouchedIDs.Append(AddedIDs.GetData(), AddedIDs.Num());
+	CaptureUnits(UnitGraph, TouchedIDs, AfterUnits);
+	AfterNextID = UnitGraph.GetNextID();
+}
+
+bool FCRRecoilUnitGraphChange::HasChanges() const
+{
+	if (BeforeNextID != AfterNextID || BeforeUnits.Num() != AfterUnits.Num())
+	{
+		return true;
+	}
+
+	for (int32 Index = 0; Index < BeforeUnits.Num(); ++Index)
+	{
+		const TPair<int32, FCRRecoilUnit>& Before = BeforeUnits[Index];
+		const TPair<int32, FCRRecoilUnit>& After = AfterUnits[Index];
+		if (Before.Key != After.Key || Before.Value.ID != After.Value.ID || Before.Value.Position != After.Value.Position)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FCRRecoilUnitGraphChange::StoreUndo(UCRRecoilUnitGraph& UnitGraph, TUniquePtr<FCRRecoilUnitGraphChange> Change)
+{
+	if (!GUndo || !Change.IsValid())
+	{
+		return;
+	}
+
+	UnitGraph.MarkPackageDirty();
+	GUndo->StoreUndo(&UnitGraph, MoveTemp(Change));
+}
+
+void FCRRecoilUnitGraphChange::Apply(UObject* Object)
+{
+	if (UCRRecoilUnitGraph* UnitGraph = Cast<UCRRecoilUnitGraph>(Object))
+	{
+		UnitGraph->RestoreUnits(TouchedIDs, AfterUnits, AfterNextID);
+	}
+}
+
+void FCRRecoilUnitGraphChange::Revert(UObject* Object)
+{
+	if (UCRRecoilUnitGraph* UnitGraph = Cast<UCRRecoilUnitGraph>(Object))
+	{
+		UnitGraph->RestoreUnits(TouchedIDs, BeforeUnits, BeforeNextID);
+	}
+}
+
+FString FCRRecoilUnitGraphChange::ToString() const
+{
+	return FString::Printf(TEXT("Recoil Unit Graph Change (%d units)"), TouchedIDs.Num());
+}
+
+void FCRRecoilUnitGraphChange::CaptureUnits(const UCRRecoilUnitGraph& UnitGraph, TConstArrayView<uint32> IDs, TArray<TPair<int32, FCRRecoilUnit>>& OutUnits)
+{
+	OutUnits.Reset(IDs.Num());
+	for (const uint32 ID : IDs)
+	{
+		const int32 Index = UnitGraph.GetUnitIndexByID(ID);
+		if (Index != INDEX_NONE)
+		{
+			OutUnits.Emplace(Index, UnitGraph.GetUnitAt(Index));
+		}
+	}
+
+	// RestoreUnits inserts in ascending index order
+	OutUnits.Sort([](const TPair<int32, FCRRecoilUnit>& A, const TPair<int32, FCRRecoilUnit>& B) { return A.Key < B.Key; });
+}
@@ -4,99 +4,106 @@
 
 namespace
 {
-	TArray<FCRRecoilUnit> CacheSelectedUnits(UCRRecoilUnitGraph* UnitGraph, const FCRRecoilUnitSelection& UnitSelection)
+	TArray<uint32> GetSelectedUnitIDs(const FCRRecoilUnitSelection& UnitSelection)
 	{
-		TArray<FCRRecoilUnit> Result;
-		for (const FCRRecoilUnit* RecoilUnit : UnitSelection.GetSelectedRecoilUnits(UnitGraph))
+		TArray<uint32> Result;
+		Result.Reserve(UnitSelection.GetSelection().Num());
+		for (const int32 UnitID : UnitSelection.GetSelection())
 		{
-			if (RecoilUnit)
-			{
-				Result.Add(*RecoilUnit);
-			}
+			Result.Add(UnitID);
 		}
 		return Result;
 	}
 
-	TArray<FCRRecoilUnit> CacheAllUnits(UCRRecoilUnitGraph* UnitGraph)
+	void StoreDragUndo(UCRRecoilUnitGraph* UnitGraph, TUniquePtr<FCRRecoilUnitGraphChange> Change, const FText& Description)
 	{
-		TArray<FCRRecoilUnit> Result;
-		for (int32 Index = 0; Index < UnitGraph->GetUnitCount(); ++Index)
+		if (!Change.IsValid())
 		{
-			Result.Add(UnitGraph->GetUnitAt(Index));
+			return;
 		}
-		return Result;
+
+		Change->RecordAfter(*UnitGraph);
+		if (Change->HasChanges())
+		{
+			FScopedTransaction Transaction(Description);
+			FCRRecoilUnitGraphChange::StoreUndo(*UnitGraph, MoveTemp(Change));
+		}
+	}
+}
+
+const TArray<int32>& FCRUnitGraphDragUnitIndices::Resolve(const UCRRecoilUnitGraph& UnitGraph, const FCRRecoilUnitSelection& UnitSelection)
+{
+	const uint32 OrderRevision = UnitGraph.GetUnitOrderRevision();
+	if (ResolvedOrderRevision == OrderRevision)
+	{
+		return Indices;
 	}
 
-	void ApplyCacheToUnitGraph(UCRRecoilUnitGraph* UnitGraph, const TArray<FCRRecoilUnit>& CachedUnits)
+	Indices.Reset(UnitSelection.GetSelection().Num());
+	for (const int32 UnitID : UnitSelection.GetSelection())
 	{
-		for (const FCRRecoilUnit& RecoilUnit : CachedUnits)
+		const int32 Index = UnitGraph.GetUnitIndexByID(UnitID);
+		if (Index != INDEX_NONE)
 		{
-			if (FCRRecoilUnit* UnitPtr = UnitGraph->GetUnitByID(RecoilUnit.ID))
-			{
-				UnitPtr->Position = RecoilUnit.Position;
-			}
+			Indices.Add(Index);
 		}
 	}
+
+	// Read after resolving, looking up IDs may rebuild the graph's index map
+	ResolvedOrderRevision = UnitGraph.GetUnitOrderRevision();
+	return Indices;
 }
 
 FCRUnitGraphScaleUnitsDelayedDrag::FCRUnitGraphScaleUnitsDelayedDrag(UCRRecoilUnitGraph* UnitGraph, const FCRRecoilUnitSelection& UnitSelection, const FVector2f InInitialRecoilLocation, const FVector2f InInitialPosition, const FKey& InEffectiveKey)
 {
 	CachedUnitGraph = UnitGraph;
-	CachedRecoilUnits = CacheSelectedUnits(UnitGraph, UnitSelection);
+	PendingChange = MakeUnique<FCRRecoilUnitGraphChange>(*UnitGraph, GetSelectedUnitIDs(UnitSelection));
 	InitialRecoilLocation = InInitialRecoilLocation;
 	InitialPanelLocation = InInitialPosition;
 }
 
 FCRUnitGraphScaleUnitsDelayedDrag::~FCRUnitGraphScaleUnitsDelayedDrag()
 {
-	const TArray<FCRRecoilUnit> MovedRecoilUnits = CacheAllUnits(CachedUnitGraph);
-	ApplyCacheToUnitGraph(CachedUnitGraph, CachedRecoilUnits);
-	FScopedTransaction Transaction(NSLOCTEXT("CRUnitGraphScaleUnitsDelayedDrag", "DragOperation", "Scale recoil units"));
-	CachedUnitGraph->Modify();
-	ApplyCacheToUnitGraph(CachedUnitGraph, MovedRecoilUnits);
+	StoreDragUndo(CachedUnitGraph, MoveTemp(PendingChange), NSLOCTEXT("CRUnitGraphScaleUnitsDelayedDrag", "DragOperation", "Scale recoil units"));
 }
 
 void FCRUnitGraphScaleUnitsDelayedDrag::ApplyScaling(const FCRRecoilUnitSelection& RecoilUnitSelection, float NewScale)
 {
 	NewScale = FMath::Max(0.05f, NewScale);
 	const float ScaleFactor = NewScale / CurrentScale;
-	TArray<FCRRecoilUnit*> SelectedRecoilUnitPtrs = RecoilUnitSelection.GetSelectedRecoilUnits(CachedUnitGraph);
+	const TArray<int32>& UnitIndices = SelectedUnitIndices.Resolve(*CachedUnitGraph, RecoilUnitSelection);
+	TArray<FCRRecoilUnit>& RecoilUnits = CachedUnitGraph->GetRecoilUnits();
 
-	for (int32 Index = 1; Index < SelectedRecoilUnitPtrs.Num(); ++Index)
+	for (int32 Index = 1; Index < UnitIndices.Num(); ++Index)
 	{
-		FVector2f VectorFromInitialToUnit = SelectedRecoilUnitPtrs[Index]->Position - InitialRecoilLocation;
+		FCRRecoilUnit& RecoilUnit = RecoilUnits[UnitIndices[Index]];
+		FVector2f VectorFromInitialToUnit = RecoilUnit.Position - InitialRecoilLocation;
 		VectorFromInitialToUnit *= ScaleFactor;
-		SelectedRecoilUnitPtrs[Index]->Position = InitialRecoilLocation + VectorFromInitialToUnit;
+		RecoilUnit.Position = InitialRecoilLocation + VectorFromInitialToUnit;
 	}
 
 	CurrentScale = NewScale;
 }
 
-FCRUnitGraphMoveUnitsDelayedDrag::FCRUnitGraphMoveUnitsDelayedDrag(UCRRecoilUnitGraph* UnitGraph, const FCRRecoilUnitSelection& UnitSelection, const FVector2f InInitialRecoilLocation, const FVector2f InInitialPosition, const FKey& InEffectiveKey)
+FCRUnitGraphMoveUnitsDelayedDrag::FCRUnitGraphMoveUnitsDelayedDrag(UCRRecoilUnitGraph* UnitGraph, const FCRRecoilUnitSelection& UnitSelection, const FVector2f InInitialRecoilLocation, const FVector2f InInitialPosition, const FKey& InEffectiveKey, const bool bAutoRearrange)
 	: FDelayedDrag(static_cast<FVector2D>(InInitialPosition), InEffectiveKey)
 {
 	TriggerDistance = 0.f;
 	CachedUnitGraph = UnitGraph;
-	CachedRecoilUnits = CacheSelectedUnits(UnitGraph, UnitSelection);
+	PendingChange = MakeUnique<FCRRecoilUnitGraphChange>(*UnitGraph, GetSelectedUnitIDs(UnitSelection), bAutoRearrange);
 	LastRecoilCoordsLocation = InInitialRecoilLocation;
 }
 
 FCRUnitGraphMoveUnitsDelayedDrag::~FCRUnitGraphMoveUnitsDelayedDrag()
 {
-	const TArray<FCRRecoilUnit> MovedRecoilUnits = CacheAllUnits(CachedUnitGraph);
-	ApplyCacheToUnitGraph(CachedUnitGraph, CachedRecoilUnits);
-	FScopedTransaction Transaction(NSLOCTEXT("CRUnitGraphMoveUnitsDelayedDrag", "DragOperation", "Move recoil units"));
-	CachedUnitGraph->Modify();
-	ApplyCacheToUnitGraph(CachedUnitGraph, MovedRecoilUnits);
+	StoreDragUndo(CachedUnitGraph, MoveTemp(PendingChange), NSLOCTEXT("CRUnitGraphMoveUnitsDelayedDrag", "DragOperation", "Move recoil units"));
 }
 
-void FCRUnitGraphMoveUnitsDelayedDrag::ApplyMovement(const FCRRecoilUnitSelection& UnitSelection, const FVector2f& Movement) const
+void FCRUnitGraphMoveUnitsDelayedDrag::ApplyMovement(const FCRRecoilUnitSelection& UnitSelection, const FVector2f& Movement)
 {
-	for (FCRRecoilUnit* RecoilUnit : UnitSelection.GetSelectedRecoilUnits(CachedUnitGraph))
+	TArray<FCRRecoilUnit>& RecoilUnits = CachedUnitGraph->GetRecoilUnits();
+	for (const int32 UnitIndex : SelectedUnitIndices.Resolve(*CachedUnitGraph, UnitSelection))
 	{
-		if (RecoilUnit)
-		{
-			RecoilUnit->Position += Movement;
-		}
+		RecoilUnits[UnitIndex].Position += Movement;
 	}
 }
@@ -0,0 +1,114 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Editor.h"
+#include "Input/HittestGrid.h"
+#include "Layout/Geometry.h"
+#include "Rendering/DrawElements.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/Package.h"
+#include "Widgets/SWindow.h"
+#include "Data/CRRecoilPattern.h"
+#include "Data/CRRecoilUnitGraph.h"
+#include "Editor/CRRecoilPatternEditor.h"
+#include "Widget/CRRecoilUnitGraphEditor.h"
+
+namespace CrystalRecoilEditor::Tests
+{
+	/**
+	* Transient pattern opened in the recoil pattern editor, plus a unit graph widget that can be painted off screen
+	* The widget is a second view on the editor's pattern and selection, so tests can drive it without touching the editor tabs
+	*/
+	class FCRUnitGraphEditorTestContext
+	{
+	public:
+		explicit FCRUnitGraphEditorTestContext(TConstArrayView<FVector2f> UnitPositions)
+			: ViewSize(1600.f, 900.f)
+		{
+			Pattern = NewObject<UCRRecoilPattern>(GetTransientPackage(), NAME_None, RF_Transient);
+			Pattern->GetUnitGraph()->AddUnitsSorted(UnitPositions);
+
+			Editor = FCRRecoilPatternEditor::CreateRecoilPatternEditor(EToolkitMode::Standalone, nullptr, Pattern);
+
+			Widget = SNew(SCRRecoilUnitGraphWidget).RecoilPatternEditor(Editor.Get());
+			Widget->SetRecoilUnitGraph(Pattern->GetUnitGraph());
+			Widget->SlatePrepass(1.f);
+
+			PaintWindow = SNew(SWindow).ClientSize(FVector2D(ViewSize));
+			ElementList = MakeUnique<FSlateWindowElementList>(PaintWindow);
+		}
+
+		~FCRUnitGraphEditorTestContext()
+		{
+			GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(Pattern);
+		}
+
+		FCRUnitGraphEditorTestContext(const FCRUnitGraphEditorTestContext&) = delete;
+		FCRUnitGraphEditorTestContext& operator=(const FCRUnitGraphEditorTestContext&) = delete;
+
+		UCRRecoilUnitGraph* GetUnitGraph() const
+		{
+			return Pattern->GetUnitGraph();
+		}
+
+		FCRRecoilUnitSelection& GetSelection() const
+		{
+			return Editor->GetRecoilUnitSelection();
+		}
+
+		SCRRecoilUnitGraphWidget& GetWidget() const
+		{
+			return *Widget;
+		}
+
+		// Geometry the widget is painted with, also usable to build mouse events in panel space
+		FGeometry GetGeometry() const
+		{
+			return FGeometry::MakeRoot(FVector2D(ViewSize), FSlateLayoutTransform());
+		}
+
+		// Paints the whole widget into a reused element list, like one editor frame
+		void Paint()
+		{
+			ElementList->ResetElementList();
+
+			FHittestGrid HittestGrid;
+			const FPaintArgs PaintArgs(PaintWindow.Get(), HittestGrid, FVector2D::ZeroVector, FApp::GetCurrentTime(), 1.f / 60.f);
+			Widget->Paint(PaintArgs, GetGeometry(), FSlateRect(FVector2f::ZeroVector, ViewSize), *ElementList, 0, FWidgetStyle(), true);
+		}
+
+	private:
+		FVector2f ViewSize;
+
+		UCRRecoilPattern* Pattern = nullptr;
+
+		TSharedPtr<FCRRecoilPatternEditor> Editor;
+
+		TSharedPtr<SCRRecoilUnitGraphWidget> Widget;
+
+		TSharedPtr<SWindow> PaintWindow;
+
+		TUniquePtr<FSlateWindowElementList> ElementList;
+	};
+
+	// Square grid of UnitCount unit positions, Spacing degrees apart
+	inline TArray<FVector2f> MakeUnitGridPositions(const int32 UnitCount, const float Spacing)
+	{
+		const int32 Columns = FMath::Max(1, FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(UnitCount))));
+
+		TArray<FVector2f> Positions;
+		Positions.Reserve(UnitCount);
+		for (int32 UnitIndex = 0; UnitIndex < UnitCount; ++UnitIndex)
+		{
+			Positions.Add(FVector2f((UnitIndex % Columns) * Spacing, (UnitIndex / Columns) * Spacing));
+		}
+		return Positions;
+	}
+}
+
+#endif
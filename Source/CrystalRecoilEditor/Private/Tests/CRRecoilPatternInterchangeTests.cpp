@@ -0,0 +1,331 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryWriter.h"
+#include "AssetTools/CRRecoilPatternInterchange.h"
+#include "Data/CRRecoilPattern.h"
+#include <limits>
+
+namespace CrystalRecoilEditor::Tests
+{
+	const ECRRecoilPatternInterchangeFormat InterchangeTestFormats[] = {
+		ECRRecoilPatternInterchangeFormat::Binary,
+		ECRRecoilPatternInterchangeFormat::Json,
+		ECRRecoilPatternInterchangeFormat::Csv
+	};
+
+	// Every field away from its default and most floats not exactly representable in decimal, so lossy writes show up
+	static FCRRecoilPatternInterchangeData MakeInterchangeTestData()
+	{
+		FCRRecoilPatternInterchangeData Data;
+		Data.MotionModel = ERecoilMotionModel::Spring;
+		Data.SpringFrequency = 7.3f;
+		Data.SpringDampingRatio = 0.65f;
+		Data.UpliftSpeed = 123.456f;
+		Data.RecoveryDelay = 0.1f;
+		Data.InitialRecoverySpeed = 1.f / 3.f;
+		Data.MaxRecoverySpeed = 42.42f;
+		Data.RecoveryAcceleration = 9.81f;
+		Data.RecoveryCancelThreshold = 0.7f;
+		Data.PatternIndexing = ERecoilPatternIndexing::FiringTime;
+		Data.ReferenceFireInterval = 0.0857f;
+		Data.PatternEndBehavior = ERecoilPatternEndBehavior::RestartFromCustomIndex;
+		Data.CustomRecoilRestartIndex = 3;
+		Data.RandomXRange = FVector2f(-0.3f, 0.45f);
+		Data.RandomYRange = FVector2f(-0.15f, 0.2f);
+		Data.UnitPositions = { FVector2f(0.f, 0.5f), FVector2f(-0.1f, 1.3f), FVector2f(0.27f, 2.71828f), FVector2f(-12.34f, 5.6789f) };
+		return Data;
+	}
+
+	static bool HaveSameInterchangeData(const FCRRecoilPatternInterchangeData& A, const FCRRecoilPatternInterchangeData& B)
+	{
+		return A.MotionModel == B.MotionModel
+			&& A.SpringFrequency == B.SpringFrequency
+			&& A.SpringDampingRatio == B.SpringDampingRatio
+			&& A.UpliftSpeed == B.UpliftSpeed
+			&& A.RecoveryDelay == B.RecoveryDelay
+			&& A.InitialRecoverySpeed == B.InitialRecoverySpeed
+			&& A.MaxRecoverySpeed == B.MaxRecoverySpeed
+			&& A.RecoveryAcceleration == B.RecoveryAcceleration
+			&& A.RecoveryCancelThreshold == B.RecoveryCancelThreshold
+			&& A.PatternIndexing == B.PatternIndexing
+			&& A.ReferenceFireInterval == B.ReferenceFireInterval
+			&& A.PatternEndBehavior == B.PatternEndBehavior
+			&& A.CustomRecoilRestartIndex == B.CustomRecoilRestartIndex
+			&& A.RandomXRange == B.RandomXRange
+			&& A.RandomYRange == B.RandomYRange
+			&& A.UnitPositions == B.UnitPositions;
+	}
+
+	/**
+	* Writes a binary pattern of an older (or invalid) version by hand, in the layout that version had
+	* DeclaredUnitCount is written as the unit count, the unit data written is always Data.UnitPositions
+	*/
+	static TArray<uint8> MakeBinaryPattern(const FCRRecoilPatternInterchangeData& Data, const uint16 Version, const uint16 Flags, const int32 DeclaredUnitCount)
+	{
+		FCRRecoilPatternInterchangeData WritableData = Data;
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+
+		uint32 Magic = FCRRecoilPatternInterchange::BinaryMagic;
+		uint16 WrittenVersion = Version;
+		uint16 WrittenFlags = Flags;
+		uint8 MotionModel = static_cast<uint8>(WritableData.MotionModel);
+		uint8 PatternIndexing = static_cast<uint8>(WritableData.PatternIndexing);
+		uint8 EndBehavior = static_cast<uint8>(WritableData.PatternEndBehavior);
+		int32 UnitCount = DeclaredUnitCount;
+
+		Writer << Magic << WrittenVersion << WrittenFlags;
+		if (Version >= 2)
+		{
+			Writer << MotionModel << WritableData.SpringFrequency << WritableData.SpringDampingRatio;
+		}
+		if (Version >= 3)
+		{
+			Writer << PatternIndexing << WritableData.ReferenceFireInterval;
+		}
+		Writer << WritableData.UpliftSpeed << WritableData.RecoveryDelay << WritableData.InitialRecoverySpeed;
+		Writer << WritableData.MaxRecoverySpeed << WritableData.RecoveryAcceleration << WritableData.RecoveryCancelThreshold;
+		Writer << EndBehavior << WritableData.CustomRecoilRestartIndex << WritableData.RandomXRange << WritableData.RandomYRange;
+		Writer << UnitCount;
+		for (FVector2f& Position : WritableData.UnitPositions)
+		{
+			Writer << Position;
+		}
+		return Bytes;
+	}
+
+	static TArray<uint8> MakeTextBytes(const ANSICHAR* Text)
+	{
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+	}
+
+	static bool ParseInterchange(const ECRRecoilPatternInterchangeFormat Format, TConstArrayView<uint8> Bytes, FCRRecoilPatternInterchangeData& InOutData)
+	{
+		FString Error;
+		return FCRRecoilPatternInterchange::Parse(Format, Bytes, InOutData, Error);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilPatternInterchangeRoundTripTest, "CrystalRecoil.Editor.Interchange.RoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilPatternInterchangeRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	const FCRRecoilPatternInterchangeData Expected = MakeInterchangeTestData();
+	FCRRecoilPatternInterchangeData ExpectedEmpty = Expected;
+	ExpectedEmpty.UnitPositions.Reset();
+
+	for (const ECRRecoilPatternInterchangeFormat Format : InterchangeTestFormats)
+	{
+		const TCHAR* Extension = FCRRecoilPatternInterchange::GetExtension(Format);
+		TestTrue(FString::Printf(TEXT("%s: extension maps back to the format"), Extension), FCRRecoilPatternInterchange::FormatFromExtension(FString::Printf(TEXT(".%s"), Extension)) == TOptional<ECRRecoilPatternInterchangeFormat>(Format));
+
+		for (const FCRRecoilPatternInterchangeData* Source : { &Expected, &ExpectedEmpty })
+		{
+			TArray<uint8> Bytes;
+			FString Error;
+			if (!TestTrue(FString::Printf(TEXT("%s: write succeeds"), Extension), FCRRecoilPatternInterchange::Write(Format, *Source, Bytes, Error)))
+			{
+				return false;
+			}
+			TestTrue(FString::Printf(TEXT("%s: written file has the format's signature"), Extension), FCRRecoilPatternInterchange::HasSignature(Format, Bytes));
+
+			// Parsed over default data, so every field has to come from the file
+			FCRRecoilPatternInterchangeData Parsed;
+			const bool bParsed = FCRRecoilPatternInterchange::Parse(Format, Bytes, Parsed, Error);
+			TestTrue(FString::Printf(TEXT("%s: parse succeeds (%s)"), Extension, *Error), bParsed);
+			TestTrue(FString::Printf(TEXT("%s: %d units and every field survive the round trip"), Extension, Source->UnitPositions.Num()), HaveSameInterchangeData(Parsed, *Source));
+		}
+	}
+
+	// The same data through a pattern asset, units must keep the file order
+	UCRRecoilPattern* Pattern = NewObject<UCRRecoilPattern>(GetTransientPackage(), NAME_None, RF_Transient);
+	for (const ECRRecoilPatternInterchangeFormat Format : InterchangeTestFormats)
+	{
+		TArray<uint8> Bytes;
+		FString Error;
+		FCRRecoilPatternInterchange::Write(Format, Expected, Bytes, Error);
+		TestTrue(TEXT("ImportIntoPattern succeeds"), FCRRecoilPatternInterchange::ImportIntoPattern(Format, Bytes, *Pattern, Error));
+
+		FCRRecoilPatternInterchangeData Imported;
+		Imported.ReadFromPattern(*Pattern);
+		TestTrue(FString::Printf(TEXT("%s: imported pattern matches the file"), FCRRecoilPatternInterchange::GetExtension(Format)), HaveSameInterchangeData(Imported, Expected));
+
+		TArray<uint8> ExportedBytes;
+		TestTrue(TEXT("ExportPattern succeeds"), FCRRecoilPatternInterchange::ExportPattern(Format, *Pattern, ExportedBytes, Error));
+		TestTrue(FString::Printf(TEXT("%s: exporting the imported pattern writes the same file"), FCRRecoilPatternInterchange::GetExtension(Format)), ExportedBytes == Bytes);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilPatternInterchangeBinaryTest, "CrystalRecoil.Editor.Interchange.Binary", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilPatternInterchangeBinaryTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	constexpr ECRRecoilPatternInterchangeFormat Binary = ECRRecoilPatternInterchangeFormat::Binary;
+	const FCRRecoilPatternInterchangeData FileData = MakeInterchangeTestData();
+	const int32 UnitCount = FileData.UnitPositions.Num();
+
+	// What the asset had before the import, older versions must leave the fields they don't carry at these values
+	FCRRecoilPatternInterchangeData AssetData;
+	AssetData.MotionModel = ERecoilMotionModel::Kinematic;
+	AssetData.SpringFrequency = 2.5f;
+	AssetData.SpringDampingRatio = 0.9f;
+	AssetData.PatternIndexing = ERecoilPatternIndexing::ShotCount;
+	AssetData.ReferenceFireInterval = 0.125f;
+
+	{
+		FCRRecoilPatternInterchangeData Parsed = AssetData;
+		TestTrue(TEXT("v1 file parses"), ParseInterchange(Binary, MakeBinaryPattern(FileData, 1, 0, UnitCount), Parsed));
+
+		FCRRecoilPatternInterchangeData Expected = FileData;
+		Expected.MotionModel = AssetData.MotionModel;
+		Expected.SpringFrequency = AssetData.SpringFrequency;
+		Expected.SpringDampingRatio = AssetData.SpringDampingRatio;
+		Expected.PatternIndexing = AssetData.PatternIndexing;
+		Expected.ReferenceFireInterval = AssetData.ReferenceFireInterval;
+		TestTrue(TEXT("v1 file reads its fields and keeps the motion model, spring and indexing settings"), HaveSameInterchangeData(Parsed, Expected));
+	}
+
+	{
+		FCRRecoilPatternInterchangeData Parsed = AssetData;
+		TestTrue(TEXT("v2 file parses"), ParseInterchange(Binary, MakeBinaryPattern(FileData, 2, 0, UnitCount), Parsed));
+
+		FCRRecoilPatternInterchangeData Expected = FileData;
+		Expected.PatternIndexing = AssetData.PatternIndexing;
+		Expected.ReferenceFireInterval = AssetData.ReferenceFireInterval;
+		TestTrue(TEXT("v2 file reads its fields and keeps the indexing settings"), HaveSameInterchangeData(Parsed, Expected));
+	}
+
+	{
+		FCRRecoilPatternInterchangeData Parsed = AssetData;
+		TestTrue(TEXT("Hand written current version parses"), ParseInterchange(Binary, MakeBinaryPattern(FileData, FCRRecoilPatternInterchange::BinaryVersion, 0, UnitCount), Parsed));
+		TestTrue(TEXT("Hand written current version reads every field"), HaveSameInterchangeData(Parsed, FileData));
+	}
+
+	FCRRecoilPatternInterchangeData Parsed = AssetData;
+	TestFalse(TEXT("Version 0 is rejected"), ParseInterchange(Binary, MakeBinaryPattern(FileData, 0, 0, UnitCount), Parsed));
+	TestFalse(TEXT("Newer version is rejected"), ParseInterchange(Binary, MakeBinaryPattern(FileData, FCRRecoilPatternInterchange::BinaryVersion + 1, 0, UnitCount), Parsed));
+
+	for (int32 FlagBit = 0; FlagBit < 16; ++FlagBit)
+	{
+		const uint16 Flag = static_cast<uint16>(1 << FlagBit);
+		if ((Flag & FCRRecoilPatternInterchange::BinaryKnownFlags) == 0)
+		{
+			TestFalse(FString::Printf(TEXT("Unknown flag 0x%04x is rejected"), Flag), ParseInterchange(Binary, MakeBinaryPattern(FileData, FCRRecoilPatternInterchange::BinaryVersion, Flag, UnitCount), Parsed));
+		}
+	}
+
+	TArray<uint8> BadMagic = MakeBinaryPattern(FileData, FCRRecoilPatternInterchange::BinaryVersion, 0, UnitCount);
+	BadMagic[0] ^= 0xFF;
+	TestFalse(TEXT("Bad magic is rejected"), ParseInterchange(Binary, BadMagic, Parsed));
+	TestFalse(TEXT("Bad magic has no binary signature"), FCRRecoilPatternInterchange::HasSignature(Binary, BadMagic));
+
+	// Every cut, from inside the magic to half of the last unit
+	const TArray<uint8> FullFile = MakeBinaryPattern(FileData, FCRRecoilPatternInterchange::BinaryVersion, 0, UnitCount);
+	for (int32 Length = 0; Length < FullFile.Num(); ++Length)
+	{
+		if (!TestFalse(FString::Printf(TEXT("File truncated to %d of %d bytes is rejected"), Length, FullFile.Num()), ParseInterchange(Binary, MakeArrayView(FullFile.GetData(), Length), Parsed)))
+		{
+			break;
+		}
+	}
+
+	TestFalse(TEXT("Unit count one past the data is rejected"), ParseInterchange(Binary, MakeBinaryPattern(FileData, FCRRecoilPatternInterchange::BinaryVersion, 0, UnitCount + 1), Parsed));
+	TestFalse(TEXT("Huge unit count is rejected before allocating"), ParseInterchange(Binary, MakeBinaryPattern(FileData, FCRRecoilPatternInterchange::BinaryVersion, 0, MAX_int32), Parsed));
+	TestFalse(TEXT("Negative unit count is rejected"), ParseInterchange(Binary, MakeBinaryPattern(FileData, FCRRecoilPatternInterchange::BinaryVersion, 0, -1), Parsed));
+
+	// Trailing bytes past the declared units are ignored
+	FCRRecoilPatternInterchangeData FewerUnits;
+	TestTrue(TEXT("Unit count below the data parses"), ParseInterchange(Binary, MakeBinaryPattern(FileData, FCRRecoilPatternInterchange::BinaryVersion, 0, UnitCount - 1), FewerUnits));
+	TestEqual(TEXT("Only the declared units are read"), FewerUnits.UnitPositions.Num(), UnitCount - 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilPatternInterchangeTextTest, "CrystalRecoil.Editor.Interchange.Text", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilPatternInterchangeTextTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	constexpr ECRRecoilPatternInterchangeFormat Csv = ECRRecoilPatternInterchangeFormat::Csv;
+	constexpr ECRRecoilPatternInterchangeFormat Json = ECRRecoilPatternInterchangeFormat::Json;
+
+	{
+		FCRRecoilPatternInterchangeData Parsed;
+		const TArray<uint8> Bytes = MakeTextBytes("\xEF\xBB\xBF# CrystalRecoil Pattern v1\r\nUpliftSpeed,12.5\r\nRandomXRange,-1,2\r\nX,Y\r\n0,1\r\n-0.5,2.25\r\n");
+		TestTrue(TEXT("CSV with a BOM and CRLF line ends has the CSV signature"), FCRRecoilPatternInterchange::HasSignature(Csv, Bytes));
+		TestTrue(TEXT("CSV with a BOM and CRLF line ends parses"), ParseInterchange(Csv, Bytes, Parsed));
+		TestEqual(TEXT("CSV UpliftSpeed"), Parsed.UpliftSpeed, 12.5f);
+		TestEqual(TEXT("CSV RandomXRange"), Parsed.RandomXRange, FVector2f(-1.f, 2.f));
+		TestTrue(TEXT("CSV units"), Parsed.UnitPositions == TArray<FVector2f>({ FVector2f(0.f, 1.f), FVector2f(-0.5f, 2.25f) }));
+	}
+
+	{
+		FCRRecoilPatternInterchangeData Parsed;
+		const TArray<uint8> Bytes = MakeTextBytes("UpliftSpeed,12.5\nX,Y\n0,1\n");
+		TestFalse(TEXT("CSV without the signature has no CSV signature"), FCRRecoilPatternInterchange::HasSignature(Csv, Bytes));
+		TestFalse(TEXT("CSV without the signature is rejected"), ParseInterchange(Csv, Bytes, Parsed));
+	}
+
+	FCRRecoilPatternInterchangeData Parsed;
+	TestFalse(TEXT("Empty CSV is rejected"), ParseInterchange(Csv, {}, Parsed));
+	TestFalse(TEXT("CSV from a newer version is rejected"), ParseInterchange(Csv, MakeTextBytes("# CrystalRecoil Pattern v2\nX,Y\n0,1\n"), Parsed));
+	TestFalse(TEXT("CSV with a bad unit row is rejected"), ParseInterchange(Csv, MakeTextBytes("# CrystalRecoil Pattern v1\nX,Y\n0,abc\n"), Parsed));
+	TestFalse(TEXT("CSV with a bad enum value is rejected"), ParseInterchange(Csv, MakeTextBytes("# CrystalRecoil Pattern v1\nPatternEndBehavior,Sideways\nX,Y\n"), Parsed));
+
+	{
+		FCRRecoilPatternInterchangeData JsonParsed;
+		const TArray<uint8> Bytes = MakeTextBytes("\xEF\xBB\xBF{ \"CrystalRecoilPattern\": 1, \"UpliftSpeed\": 12.5, \"FutureField\": 7, \"Units\": [[0, 1], [-0.5, 2.25]] }");
+		TestTrue(TEXT("JSON with a BOM and an unknown field parses"), ParseInterchange(Json, Bytes, JsonParsed));
+		TestEqual(TEXT("JSON UpliftSpeed"), JsonParsed.UpliftSpeed, 12.5f);
+		TestTrue(TEXT("JSON units"), JsonParsed.UnitPositions == TArray<FVector2f>({ FVector2f(0.f, 1.f), FVector2f(-0.5f, 2.25f) }));
+	}
+
+	TestFalse(TEXT("JSON without the version field is rejected"), ParseInterchange(Json, MakeTextBytes("{ \"Units\": [] }"), Parsed));
+	TestFalse(TEXT("JSON without units is rejected"), ParseInterchange(Json, MakeTextBytes("{ \"CrystalRecoilPattern\": 1 }"), Parsed));
+	TestFalse(TEXT("JSON from a newer version is rejected"), ParseInterchange(Json, MakeTextBytes("{ \"CrystalRecoilPattern\": 2, \"Units\": [] }"), Parsed));
+	TestFalse(TEXT("JSON unit with three numbers is rejected"), ParseInterchange(Json, MakeTextBytes("{ \"CrystalRecoilPattern\": 1, \"Units\": [[0, 1, 2]] }"), Parsed));
+	TestFalse(TEXT("JSON nan is rejected"), ParseInterchange(Json, MakeTextBytes("{ \"CrystalRecoilPattern\": 1, \"UpliftSpeed\": nan, \"Units\": [] }"), Parsed));
+	TestFalse(TEXT("Malformed JSON is rejected"), ParseInterchange(Json, MakeTextBytes("{ \"CrystalRecoilPattern\": 1, \"Units\": [[0, 1]"), Parsed));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilPatternInterchangeNonFiniteTest, "CrystalRecoil.Editor.Interchange.NonFinite", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilPatternInterchangeNonFiniteTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	FCRRecoilPatternInterchangeData NaNField = MakeInterchangeTestData();
+	NaNField.RecoveryDelay = std::numeric_limits<float>::quiet_NaN();
+
+	FCRRecoilPatternInterchangeData InfiniteRange = MakeInterchangeTestData();
+	InfiniteRange.RandomYRange.X = -std::numeric_limits<float>::infinity();
+
+	FCRRecoilPatternInterchangeData InfiniteUnit = MakeInterchangeTestData();
+	InfiniteUnit.UnitPositions.Last().Y = std::numeric_limits<float>::infinity();
+
+	for (const ECRRecoilPatternInterchangeFormat Format : InterchangeTestFormats)
+	{
+		for (const FCRRecoilPatternInterchangeData* Data : { &NaNField, &InfiniteRange, &InfiniteUnit })
+		{
+			TArray<uint8> Bytes;
+			FString Error;
+			TestFalse(FString::Printf(TEXT("%s: non-finite value is refused"), FCRRecoilPatternInterchange::GetExtension(Format)), FCRRecoilPatternInterchange::Write(Format, *Data, Bytes, Error));
+			TestTrue(TEXT("Nothing is written"), Bytes.IsEmpty());
+			TestFalse(TEXT("The error is reported"), Error.IsEmpty());
+		}
+	}
+	return true;
+}
+
+#endif
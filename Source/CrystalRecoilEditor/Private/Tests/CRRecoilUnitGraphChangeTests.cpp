@@ -0,0 +1,188 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "InputCoreTypes.h"
+#include "UObject/Package.h"
+#include "Data/CRRecoilUnitGraph.h"
+#include "Editor/CRRecoilPatternEditor.h"
+#include "Editor/CRRecoilUnitGraphChange.h"
+#include "Editor/CRRecoilUnitGraphWidgetDragOperations.h"
+
+namespace CrystalRecoilEditor::Tests
+{
+	// Not in AscendByY order, like a graph edited with auto rearrange turned off
+	const FVector2f UnorderedUnitPositions[] = {
+		FVector2f(0.f, 1.f), FVector2f(0.2f, 3.f), FVector2f(-0.1f, 2.f), FVector2f(0.3f, 5.f),
+		FVector2f(0.f, 4.f), FVector2f(-0.4f, 7.f), FVector2f(0.1f, 6.f), FVector2f(0.5f, 8.f)
+	};
+
+	struct FCRUnitGraphState
+	{
+		TArray<FCRRecoilUnit> RecoilUnits;
+		uint32 NextID = 0;
+	};
+
+	static FCRUnitGraphState CaptureUnitGraphState(UCRRecoilUnitGraph& UnitGraph)
+	{
+		return { UnitGraph.GetRecoilUnits(), UnitGraph.GetNextID() };
+	}
+
+	// Units compare equal by ID only, this also checks positions, and that ID lookups agree with the restored order
+	static bool MatchesUnitGraphState(UCRRecoilUnitGraph& UnitGraph, const FCRUnitGraphState& State)
+	{
+		const TArray<FCRRecoilUnit>& RecoilUnits = UnitGraph.GetRecoilUnits();
+		if (UnitGraph.GetNextID() != State.NextID || RecoilUnits.Num() != State.RecoilUnits.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < RecoilUnits.Num(); ++Index)
+		{
+			if (RecoilUnits[Index].ID != State.RecoilUnits[Index].ID || RecoilUnits[Index].Position != State.RecoilUnits[Index].Position || UnitGraph.GetUnitIndexByID(RecoilUnits[Index].ID) != Index)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static UCRRecoilUnitGraph* MakeChangeTestUnitGraph(const bool bInRearrangeOrder)
+	{
+		UCRRecoilUnitGraph* UnitGraph = NewObject<UCRRecoilUnitGraph>(GetTransientPackage(), NAME_None, RF_Transient);
+		if (bInRearrangeOrder)
+		{
+			UnitGraph->AddUnitsSorted(UnorderedUnitPositions);
+		}
+		else
+		{
+			for (const FVector2f& Position : UnorderedUnitPositions)
+			{
+				UnitGraph->AddUnit(Position);
+			}
+		}
+		return UnitGraph;
+	}
+
+	// Undoes and redoes the change twice, the way the transaction buffer would, checking the graph against the states around the edit
+	static void TestUndoRedo(FAutomationTestBase& Test, const TCHAR* EditName, UCRRecoilUnitGraph& UnitGraph, FCRRecoilUnitGraphChange& Change, const FCRUnitGraphState& BeforeState)
+	{
+		const FCRUnitGraphState AfterState = CaptureUnitGraphState(UnitGraph);
+		Test.TestTrue(FString::Printf(TEXT("%s: the change records something"), EditName), Change.HasChanges());
+
+		for (int32 Round = 0; Round < 2; ++Round)
+		{
+			Change.Revert(&UnitGraph);
+			Test.TestTrue(FString::Printf(TEXT("%s: undo %d restores the units and next ID from before the edit"), EditName, Round + 1), MatchesUnitGraphState(UnitGraph, BeforeState));
+
+			Change.Apply(&UnitGraph);
+			Test.TestTrue(FString::Printf(TEXT("%s: redo %d restores the units and next ID from after the edit"), EditName, Round + 1), MatchesUnitGraphState(UnitGraph, AfterState));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilUnitGraphChangeTest, "CrystalRecoil.Editor.UnitGraphChange", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilUnitGraphChangeTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	const FVector2f PastedPositions[] = { FVector2f(0.05f, 2.5f), FVector2f(-0.3f, 0.5f), FVector2f(0.4f, 9.f) };
+
+	// The edits below follow what the unit graph widget does for each action
+	{
+		UCRRecoilUnitGraph* UnitGraph = MakeChangeTestUnitGraph(false);
+		const FCRUnitGraphState BeforeState = CaptureUnitGraphState(*UnitGraph);
+
+		FCRRecoilUnitGraphChange Change(*UnitGraph, {});
+		const uint32 UnitID = UnitGraph->AddUnit(FVector2f(0.f, 2.5f));
+		Change.RecordAfter(*UnitGraph, MakeArrayView(&UnitID, 1));
+		TestUndoRedo(*this, TEXT("Add"), *UnitGraph, Change, BeforeState);
+	}
+
+	for (const bool bInRearrangeOrder : { true, false })
+	{
+		UCRRecoilUnitGraph* UnitGraph = MakeChangeTestUnitGraph(bInRearrangeOrder);
+		const FCRUnitGraphState BeforeState = CaptureUnitGraphState(*UnitGraph);
+
+		FCRRecoilUnitGraphChange Change(*UnitGraph, {}, true);
+		UnitGraph->RearrangeUnits();
+		const uint32 UnitID = UnitGraph->AddUnitSorted(FVector2f(0.f, 2.5f));
+		Change.RecordAfter(*UnitGraph, MakeArrayView(&UnitID, 1));
+		TestUndoRedo(*this, bInRearrangeOrder ? TEXT("Sorted add") : TEXT("Sorted add that rearranges"), *UnitGraph, Change, BeforeState);
+	}
+
+	{
+		UCRRecoilUnitGraph* UnitGraph = MakeChangeTestUnitGraph(false);
+		const FCRUnitGraphState BeforeState = CaptureUnitGraphState(*UnitGraph);
+
+		FCRRecoilUnitGraphChange Change(*UnitGraph, {});
+		TArray<uint32> PastedUnitIDs;
+		for (const FVector2f& Position : PastedPositions)
+		{
+			PastedUnitIDs.Add(UnitGraph->AddUnit(Position));
+		}
+		Change.RecordAfter(*UnitGraph, PastedUnitIDs);
+		TestUndoRedo(*this, TEXT("Paste without auto rearrange"), *UnitGraph, Change, BeforeState);
+	}
+
+	for (const bool bInRearrangeOrder : { true, false })
+	{
+		UCRRecoilUnitGraph* UnitGraph = MakeChangeTestUnitGraph(bInRearrangeOrder);
+		const FCRUnitGraphState BeforeState = CaptureUnitGraphState(*UnitGraph);
+
+		FCRRecoilUnitGraphChange Change(*UnitGraph, {}, true);
+		UnitGraph->RearrangeUnits();
+		const uint32 FirstUnitID = UnitGraph->AddUnitsSorted(PastedPositions);
+
+		TArray<uint32> PastedUnitIDs;
+		for (int32 Index = 0; Index < MakeArrayView(PastedPositions).Num(); ++Index)
+		{
+			PastedUnitIDs.Add(FirstUnitID + Index);
+		}
+		Change.RecordAfter(*UnitGraph, PastedUnitIDs);
+		TestUndoRedo(*this, bInRearrangeOrder ? TEXT("Paste with auto rearrange") : TEXT("Paste with auto rearrange into an unordered graph"), *UnitGraph, Change, BeforeState);
+	}
+
+	{
+		UCRRecoilUnitGraph* UnitGraph = MakeChangeTestUnitGraph(false);
+		const FCRUnitGraphState BeforeState = CaptureUnitGraphState(*UnitGraph);
+
+		// First, a middle and the last unit
+		const TArray<uint32> RemovedIDs = { UnitGraph->GetUnitAt(0).ID, UnitGraph->GetUnitAt(3).ID, UnitGraph->GetUnitAt(UnitGraph->GetUnitCount() - 1).ID };
+		FCRRecoilUnitGraphChange Change(*UnitGraph, RemovedIDs);
+		UnitGraph->RemoveUnits(RemovedIDs);
+		Change.RecordAfter(*UnitGraph);
+		TestUndoRedo(*this, TEXT("Delete"), *UnitGraph, Change, BeforeState);
+	}
+
+	{
+		UCRRecoilUnitGraph* UnitGraph = MakeChangeTestUnitGraph(true);
+		const FCRUnitGraphState BeforeState = CaptureUnitGraphState(*UnitGraph);
+
+		// Drags the two lowest units above all others, with auto rearrange they move to the end of the shot order
+		FCRRecoilUnitSelection Selection;
+		Selection.AddSelection(UnitGraph->GetUnitAt(0).ID);
+		Selection.AddSelection(UnitGraph->GetUnitAt(1).ID);
+
+		FCRUnitGraphMoveUnitsDelayedDrag MoveDrag(UnitGraph, Selection, FVector2f::ZeroVector, FVector2f::ZeroVector, EKeys::LeftMouseButton, true);
+		for (int32 MoveIndex = 0; MoveIndex < 4; ++MoveIndex)
+		{
+			MoveDrag.ApplyMovement(Selection, FVector2f(0.1f, 3.f));
+			UnitGraph->MarkUnitsModified();
+			UnitGraph->RepairUnitOrder();
+		}
+		TestTrue(TEXT("The move drag reorders the units"), UnitGraph->GetUnitAt(0).ID != BeforeState.RecoilUnits[0].ID);
+
+		// Taken from the drag, whose destructor would otherwise store it in the editor's undo history
+		const TUniquePtr<FCRRecoilUnitGraphChange> Change = MoveTemp(MoveDrag.PendingChange);
+		Change->RecordAfter(*UnitGraph);
+		TestUndoRedo(*this, TEXT("Move drag"), *UnitGraph, *Change, BeforeState);
+	}
+	return true;
+}
+
+#endif
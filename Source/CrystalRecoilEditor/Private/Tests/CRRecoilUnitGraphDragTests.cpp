@@ -0,0 +1,134 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Tests/CRRecoilEditorTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "CRRecoilTestUtils.h"
+#include "Editor/CRRecoilUnitGraphWidgetDragOperations.h"
+
+namespace CrystalRecoilEditor::Tests
+{
+	constexpr int32 DragTestUnitCount = 2000;
+	constexpr int32 DragTestMouseMoves = 500;
+
+	// Moved units stay in their rows, so auto rearrange has nothing to do until the test moves one on purpose
+	const FVector2f DragTestMovement(0.01f, 0.f);
+
+	// Unit positions keyed by ID, to compare graphs whose unit order changed
+	static TMap<uint32, FVector2f> GetUnitPositionsByID(UCRRecoilUnitGraph& UnitGraph)
+	{
+		TMap<uint32, FVector2f> Positions;
+		for (const FCRRecoilUnit& Unit : UnitGraph.GetRecoilUnits())
+		{
+			Positions.Add(Unit.ID, Unit.Position);
+		}
+		return Positions;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilUnitGraphDragTest, "CrystalRecoil.Editor.UnitGraphDrag", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilUnitGraphDragTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	UCRRecoilUnitGraph* UnitGraph = NewObject<UCRRecoilUnitGraph>(GetTransientPackage(), NAME_None, RF_Transient);
+	UnitGraph->AddUnitsSorted(MakeUnitGridPositions(DragTestUnitCount, 0.5f));
+
+	// Every other unit, a 1k unit selection
+	FCRRecoilUnitSelection Selection;
+	{
+		FCRRecoilUnitSelection::FScopedBatch SelectionBatch(Selection);
+		for (const FCRRecoilUnit& Unit : UnitGraph->GetRecoilUnits())
+		{
+			if (Unit.ID % 2 == 0)
+			{
+				Selection.AddSelection(Unit.ID);
+			}
+		}
+	}
+
+	const TMap<uint32, FVector2f> StartPositions = GetUnitPositionsByID(*UnitGraph);
+	FVector2f TotalMovement = FVector2f::ZeroVector;
+	uint32 ReorderedUnitID = 0;
+	{
+		FCRUnitGraphMoveUnitsDelayedDrag MoveDrag(UnitGraph, Selection, FVector2f::ZeroVector, FVector2f::ZeroVector, EKeys::LeftMouseButton, false);
+
+		// The first mouse move resolves the selection to unit indices
+		MoveDrag.ApplyMovement(Selection, DragTestMovement);
+		TotalMovement += DragTestMovement;
+		const int32* ResolvedIndices = MoveDrag.SelectedUnitIndices.Indices.GetData();
+
+		int32 AllocationCount = 0;
+		double DragSeconds = 0.0;
+		{
+			CrystalRecoil::Tests::FCRScopedAllocationCounter AllocationCounter;
+			const double StartSeconds = FPlatformTime::Seconds();
+			for (int32 MoveIndex = 0; MoveIndex < DragTestMouseMoves; ++MoveIndex)
+			{
+				MoveDrag.ApplyMovement(Selection, DragTestMovement);
+			}
+			DragSeconds = FPlatformTime::Seconds() - StartSeconds;
+			AllocationCount = AllocationCounter.GetAllocationCount();
+		}
+		TotalMovement += DragTestMovement * DragTestMouseMoves;
+
+		AddInfo(FString::Printf(TEXT("Move drag of %d selected units: %.2f us per mouse move"), Selection.GetNum(), DragSeconds * 1e6 / DragTestMouseMoves));
+		TestEqual(TEXT("Heap allocations while dragging"), AllocationCount, 0);
+		TestTrue(TEXT("The selection is resolved once per drag"), MoveDrag.SelectedUnitIndices.Indices.GetData() == ResolvedIndices && MoveDrag.SelectedUnitIndices.Indices.Num() == Selection.GetNum());
+
+		// Reorder the graph mid drag, the next mouse move has to re-resolve and still move the selected units
+		FCRRecoilUnit& ReorderedUnit = UnitGraph->GetRecoilUnits()[0];
+		ReorderedUnitID = ReorderedUnit.ID;
+		ReorderedUnit.Position.Y += 1000.f;
+		UnitGraph->MarkUnitsModified();
+		const uint32 OrderRevision = UnitGraph->GetUnitOrderRevision();
+		UnitGraph->RepairUnitOrder();
+		TestNotEqual(TEXT("Moving a unit past its neighbours changes the unit order"), UnitGraph->GetUnitOrderRevision(), OrderRevision);
+
+		MoveDrag.ApplyMovement(Selection, DragTestMovement);
+		TotalMovement += DragTestMovement;
+
+		// Ending the drag would push an undo entry for this transient graph into the editor's undo history
+		MoveDrag.PendingChange.Reset();
+	}
+
+	bool bPositionsMatch = true;
+	for (const TPair<uint32, FVector2f>& UnitPosition : GetUnitPositionsByID(*UnitGraph))
+	{
+		if (UnitPosition.Key == ReorderedUnitID)
+		{
+			continue;
+		}
+
+		FVector2f ExpectedPosition = StartPositions[UnitPosition.Key];
+		if (Selection.IsUnitSelected(static_cast<int32>(UnitPosition.Key)))
+		{
+			ExpectedPosition += TotalMovement;
+		}
+		bPositionsMatch &= UnitPosition.Value.Equals(ExpectedPosition, 1e-3f);
+	}
+	TestTrue(TEXT("Only the selected units moved, by the whole drag, across the reorder"), bPositionsMatch);
+
+	// Scaling writes through the same resolved indices
+	{
+		const FCRRecoilUnit& BaseUnit = *UnitGraph->GetUnitByID(Selection.GetSelection()[0]);
+		FCRUnitGraphScaleUnitsDelayedDrag ScaleDrag(UnitGraph, Selection, BaseUnit.Position, FVector2f::ZeroVector, EKeys::LeftMouseButton);
+		ScaleDrag.ApplyScaling(Selection, 1.01f);
+
+		CrystalRecoil::Tests::FCRScopedAllocationCounter AllocationCounter;
+		for (int32 MoveIndex = 0; MoveIndex < DragTestMouseMoves; ++MoveIndex)
+		{
+			ScaleDrag.ApplyScaling(Selection, 1.f + MoveIndex * 0.001f);
+		}
+		TestEqual(TEXT("Heap allocations while scaling"), AllocationCounter.GetAllocationCount(), 0);
+
+		ScaleDrag.PendingChange.Reset();
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,84 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Tests/CRRecoilEditorTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+namespace CrystalRecoilEditor::Tests
+{
+	constexpr int32 PaintPerfTestUnitCount = 10000;
+	constexpr int32 PaintPerfTestWarmUpPaints = 5;
+	constexpr int32 PaintPerfTestMeasuredPaints = 30;
+
+	// Average milliseconds per full widget paint
+	static double MeasurePaintTime(FCRUnitGraphEditorTestContext& TestContext)
+	{
+		for (int32 PaintIndex = 0; PaintIndex < PaintPerfTestWarmUpPaints; ++PaintIndex)
+		{
+			TestContext.Paint();
+		}
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		for (int32 PaintIndex = 0; PaintIndex < PaintPerfTestMeasuredPaints; ++PaintIndex)
+		{
+			TestContext.Paint();
+		}
+		return (FPlatformTime::Seconds() - StartSeconds) * 1000.0 / PaintPerfTestMeasuredPaints;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilUnitGraphPaintPerfTest, "CrystalRecoil.Perf.UnitGraphPaint", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FCRRecoilUnitGraphPaintPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	/**
+	* Dense enough that zoom to fit keeps every unit on screen, the worst case for the paint
+	* That framing is zoomed in past the LODs that merge nearby unselected units, so both paints below draw every unit
+	*/
+	FCRUnitGraphEditorTestContext TestContext(MakeUnitGridPositions(PaintPerfTestUnitCount, 0.25f));
+	FCRRecoilUnitSelection& Selection = TestContext.GetSelection();
+
+	const double UnselectedPaintMs = MeasurePaintTime(TestContext);
+	const int32 UnselectedDrawElements = TestContext.GetWidget().GetUnitDrawElementCount();
+
+	// Selecting half of the units in one batch must notify listeners (the details panels) once
+	int32 SelectionChangedCount = 0;
+	const FDelegateHandle SelectionChangedHandle = Selection.OnSelectionChanged.AddLambda([&SelectionChangedCount]()
+	{
+		++SelectionChangedCount;
+	});
+	{
+		FCRRecoilUnitSelection::FScopedBatch SelectionBatch(Selection);
+		const TArray<FCRRecoilUnit>& Units = TestContext.GetUnitGraph()->GetRecoilUnits();
+		for (int32 UnitIndex = 0; UnitIndex < Units.Num(); UnitIndex += 2)
+		{
+			Selection.AddSelection(Units[UnitIndex].ID);
+		}
+	}
+	Selection.OnSelectionChanged.Remove(SelectionChangedHandle);
+
+	TestEqual(TEXT("Selected units"), Selection.GetNum(), PaintPerfTestUnitCount / 2);
+	TestEqual(TEXT("Selection change notifications of a batched selection"), SelectionChangedCount, 1);
+
+	const double SelectedPaintMs = MeasurePaintTime(TestContext);
+	const int32 SelectedDrawElements = TestContext.GetWidget().GetUnitDrawElementCount();
+	AddInfo(FString::Printf(TEXT("%d units: %.3f ms per paint unselected, %.3f ms with half of them selected, %d draw elements"), PaintPerfTestUnitCount, UnselectedPaintMs, SelectedPaintMs, SelectedDrawElements));
+
+	// Selected units are never merged, so equal counts show neither paint merged any, and the timings compare the same work
+	TestTrue(TEXT("Every unit is drawn"), UnselectedDrawElements > PaintPerfTestUnitCount);
+	if (TestEqual(TEXT("Selecting units doesn't change what is drawn"), SelectedDrawElements, UnselectedDrawElements))
+	{
+		// Selection lookups are constant time, so painting a large selection costs about the same as painting none
+		TestTrue(TEXT("Painting a large selection doesn't scale with the selection size"), SelectedPaintMs < UnselectedPaintMs * 2.0 + 1.0);
+	}
+
+	Selection.ClearSelection();
+	return true;
+}
+
+#endif
@@ -0,0 +1,221 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Algo/Sort.h"
+#include "Math/RandomStream.h"
+#include "UObject/Package.h"
+#include "Data/CRRecoilUnitGraph.h"
+
+namespace CrystalRecoilEditor::Tests
+{
+	constexpr int32 UnitOrderTestRounds = 50;
+
+	/**
+	* Reference order written independently of the graph: exact position compare, then ID
+	* Sorting with it is unambiguous since no two units share an ID
+	*/
+	static bool IsBeforeInReferenceOrder(const FCRRecoilUnit& A, const FCRRecoilUnit& B, const ECRRecoilUnitGraphRearrangePolicy Policy)
+	{
+		switch (Policy)
+		{
+		case ECRRecoilUnitGraphRearrangePolicy::AscendByY:
+			return A.Position.Y != B.Position.Y ? A.Position.Y < B.Position.Y : A.ID < B.ID;
+		case ECRRecoilUnitGraphRearrangePolicy::DescendByY:
+			return A.Position.Y != B.Position.Y ? A.Position.Y > B.Position.Y : A.ID < B.ID;
+		case ECRRecoilUnitGraphRearrangePolicy::AscendByX:
+			return A.Position.X != B.Position.X ? A.Position.X < B.Position.X : A.ID < B.ID;
+		default:
+			return A.Position.X != B.Position.X ? A.Position.X > B.Position.X : A.ID < B.ID;
+		}
+	}
+
+	/**
+	* Random position on a coarse grid, so many units tie exactly
+	* Every few units it is nudged by less than the old 0.001 tolerance, the case that used to break transitivity
+	*/
+	static FVector2f MakeRandomUnitPosition(FRandomStream& RandomStream)
+	{
+		FVector2f Position(RandomStream.RandRange(-8, 8) * 0.5f, RandomStream.RandRange(-8, 8) * 0.5f);
+		if (RandomStream.RandRange(0, 3) == 0)
+		{
+			Position += FVector2f(RandomStream.FRandRange(-0.0009f, 0.0009f), RandomStream.FRandRange(-0.0009f, 0.0009f));
+		}
+		return Position;
+	}
+
+	static TArray<FCRRecoilUnit> SortByReferenceOrder(TArray<FCRRecoilUnit> Units, const ECRRecoilUnitGraphRearrangePolicy Policy)
+	{
+		Algo::Sort(Units, [Policy](const FCRRecoilUnit& A, const FCRRecoilUnit& B)
+		{
+			return IsBeforeInReferenceOrder(A, B, Policy);
+		});
+		return Units;
+	}
+
+	// Units compare equal by ID only, this also checks the positions
+	static bool HaveSameUnits(TConstArrayView<FCRRecoilUnit> A, TConstArrayView<FCRRecoilUnit> B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < A.Num(); ++Index)
+		{
+			if (A[Index].ID != B[Index].ID || A[Index].Position != B[Index].Position)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static TArray<uint32> GetUnitIDs(const UCRRecoilUnitGraph& UnitGraph)
+	{
+		TArray<uint32> IDs;
+		for (int32 Index = 0; Index < UnitGraph.GetUnitCount(); ++Index)
+		{
+			IDs.Add(UnitGraph.GetUnitAt(Index).ID);
+		}
+		return IDs;
+	}
+
+	// Same notification the details panel sends after editing the unit array
+	static void NotifyUnitsEdited(UCRRecoilUnitGraph& UnitGraph)
+	{
+		FPropertyChangedEvent PropertyChangedEvent(UCRRecoilUnitGraph::StaticClass()->FindPropertyByName(TEXT("RecoilUnits")));
+		UnitGraph.PostEditChangeProperty(PropertyChangedEvent);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilUnitGraphOrderTest, "CrystalRecoil.Editor.UnitGraphOrder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilUnitGraphOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	const ECRRecoilUnitGraphRearrangePolicy Policies[] = {
+		ECRRecoilUnitGraphRearrangePolicy::AscendByY,
+		ECRRecoilUnitGraphRearrangePolicy::DescendByY,
+		ECRRecoilUnitGraphRearrangePolicy::AscendByX,
+		ECRRecoilUnitGraphRearrangePolicy::DescendByX
+	};
+
+	FRandomStream RandomStream(1337);
+	for (const ECRRecoilUnitGraphRearrangePolicy Policy : Policies)
+	{
+		for (int32 Round = 0; Round < UnitOrderTestRounds; ++Round)
+		{
+			UCRRecoilUnitGraph* UnitGraph = NewObject<UCRRecoilUnitGraph>(GetTransientPackage());
+			UnitGraph->RearrangePolicy = Policy;
+
+			const int32 SingleUnitCount = RandomStream.RandRange(0, 40);
+			for (int32 UnitIndex = 0; UnitIndex < SingleUnitCount; ++UnitIndex)
+			{
+				UnitGraph->AddUnitSorted(MakeRandomUnitPosition(RandomStream));
+			}
+			if (!TestTrue(FString::Printf(TEXT("AddUnitSorted matches a full sort (policy %d, round %d)"), static_cast<int32>(Policy), Round),
+				HaveSameUnits(UnitGraph->GetRecoilUnits(), SortByReferenceOrder(UnitGraph->GetRecoilUnits(), Policy))))
+			{
+				return false;
+			}
+
+			TArray<FVector2f> BatchPositions;
+			const int32 BatchUnitCount = RandomStream.RandRange(0, 40);
+			for (int32 UnitIndex = 0; UnitIndex < BatchUnitCount; ++UnitIndex)
+			{
+				BatchPositions.Add(MakeRandomUnitPosition(RandomStream));
+			}
+			UnitGraph->AddUnitsSorted(BatchPositions);
+			if (!TestTrue(FString::Printf(TEXT("AddUnitsSorted matches a full sort (policy %d, round %d)"), static_cast<int32>(Policy), Round),
+				HaveSameUnits(UnitGraph->GetRecoilUnits(), SortByReferenceOrder(UnitGraph->GetRecoilUnits(), Policy))))
+			{
+				return false;
+			}
+
+			// Moves a few units like a drag would, then repairs the order in place
+			TArray<FCRRecoilUnit>& Units = UnitGraph->GetRecoilUnits();
+			const int32 MovedUnitCount = Units.IsEmpty() ? 0 : RandomStream.RandRange(1, 4);
+			for (int32 MoveIndex = 0; MoveIndex < MovedUnitCount; ++MoveIndex)
+			{
+				Units[RandomStream.RandRange(0, Units.Num() - 1)].Position = MakeRandomUnitPosition(RandomStream);
+			}
+			UnitGraph->MarkUnitsModified();
+
+			const TArray<FCRRecoilUnit> ExpectedUnits = SortByReferenceOrder(Units, Policy);
+			UnitGraph->RepairUnitOrder();
+			if (!TestTrue(FString::Printf(TEXT("RepairUnitOrder matches a full sort (policy %d, round %d)"), static_cast<int32>(Policy), Round), HaveSameUnits(UnitGraph->GetRecoilUnits(), ExpectedUnits)))
+			{
+				return false;
+			}
+			TestTrue(TEXT("IsInRearrangeOrder after repair"), UnitGraph->IsInRearrangeOrder());
+
+			// A full rearrange of an ordered graph must not move anything
+			UnitGraph->RearrangeUnits();
+			TestTrue(TEXT("RearrangeUnits keeps a repaired graph unchanged"), HaveSameUnits(UnitGraph->GetRecoilUnits(), ExpectedUnits));
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilUnitGraphIDTest, "CrystalRecoil.Editor.UnitGraphIDs", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilUnitGraphIDTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	UCRRecoilUnitGraph* UnitGraph = NewObject<UCRRecoilUnitGraph>(GetTransientPackage());
+	for (int32 UnitIndex = 0; UnitIndex < 4; ++UnitIndex)
+	{
+		UnitGraph->AddUnit(FVector2f(0.f, UnitIndex + 1.f));
+	}
+
+	// Duplicating an array element in the details panel copies its ID: [0, 1, 2, 3, 3]
+	TArray<FCRRecoilUnit>& Units = UnitGraph->GetRecoilUnits();
+	FCRRecoilUnit DuplicatedUnit = Units.Last();
+	DuplicatedUnit.Position.Y += 1.f;
+	Units.Add(DuplicatedUnit);
+	NotifyUnitsEdited(*UnitGraph);
+
+	TestTrue(TEXT("The duplicate gets the next free ID"), GetUnitIDs(*UnitGraph) == TArray<uint32>({ 0, 1, 2, 3, 4 }));
+	TestEqual(TEXT("The first occurrence keeps the duplicated ID"), UnitGraph->GetUnitAt(UnitGraph->GetUnitIndexByID(3)).Position.Y, 4.f);
+	TestEqual(TEXT("The repaired unit is found by its new ID"), UnitGraph->GetUnitAt(UnitGraph->GetUnitIndexByID(4)).Position.Y, 5.f);
+	TestEqual(TEXT("NextID moves past the repaired ID"), UnitGraph->GetNextID(), 5u);
+
+	// A hand edited ID above NextID must not be handed out again to a later duplicate: [0, 1, 9, 9, 3, 4]
+	Units[2].ID = 9;
+	FCRRecoilUnit EditedDuplicate = Units[2];
+	EditedDuplicate.Position.Y = 3.5f;
+	Units.Insert(EditedDuplicate, 3);
+	NotifyUnitsEdited(*UnitGraph);
+
+	const TArray<uint32> RepairedIDs = GetUnitIDs(*UnitGraph);
+	TestEqual(TEXT("No unit is lost by the repair"), RepairedIDs.Num(), 6);
+	TestEqual(TEXT("The repair leaves no duplicate IDs"), TSet<uint32>(MakeArrayView(RepairedIDs)).Num(), RepairedIDs.Num());
+	TestTrue(TEXT("The duplicate of a hand edited ID is placed past it"), RepairedIDs.Contains(10u));
+	TestEqual(TEXT("NextID is past every ID"), UnitGraph->GetNextID(), 11u);
+
+	// RemoveUnits takes the IDs in any order, ignores unknown ones and keeps the order of the rest
+	UnitGraph->RemoveUnits({ RepairedIDs[4], 1234u, RepairedIDs[1], RepairedIDs[4] });
+
+	TArray<uint32> ExpectedIDs = RepairedIDs;
+	ExpectedIDs.RemoveAt(4);
+	ExpectedIDs.RemoveAt(1);
+	TestTrue(TEXT("RemoveUnits removes exactly the given units and keeps the order of the rest"), GetUnitIDs(*UnitGraph) == ExpectedIDs);
+	TestEqual(TEXT("Removed units are no longer found by ID"), UnitGraph->GetUnitIndexByID(RepairedIDs[1]), INDEX_NONE);
+	TestEqual(TEXT("Remaining units are found at their new index"), UnitGraph->GetUnitIndexByID(ExpectedIDs.Last()), ExpectedIDs.Num() - 1);
+
+	UnitGraph->RemoveUnits({});
+	TestTrue(TEXT("Removing no units changes nothing"), GetUnitIDs(*UnitGraph) == ExpectedIDs);
+
+	UnitGraph->RemoveUnits(ExpectedIDs);
+	TestEqual(TEXT("Removing every unit empties the graph"), UnitGraph->GetUnitCount(), 0);
+	TestEqual(TEXT("Removing every unit restarts ID assignment"), UnitGraph->GetNextID(), 0u);
+	return true;
+}
+
+#endif
@@ -0,0 +1,194 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Algo/Sort.h"
+#include "Math/RandomStream.h"
+#include "UObject/Package.h"
+#include "Data/CRRecoilUnitGraph.h"
+#include "Widget/CRRecoilUnitSpatialGrid.h"
+
+namespace CrystalRecoilEditor::Tests
+{
+	constexpr int32 SpatialGridTestUnitCount = 300;
+	constexpr int32 SpatialGridTestEditRounds = 20;
+	constexpr int32 SpatialGridTestQueriesPerRound = 40;
+
+	// Continuous positions, so two units practically never tie for closest
+	static FVector2f MakeRandomGridPosition(FRandomStream& RandomStream, const float Extent)
+	{
+		return FVector2f(RandomStream.FRandRange(-Extent, Extent), RandomStream.FRandRange(-Extent, Extent));
+	}
+
+	// Reference FindClosestUnit over every unit, returns the squared distance of the closest hit or -1
+	static float FindClosestDistanceSquared(const UCRRecoilUnitGraph& UnitGraph, const FVector2f& Point, const float HalfExtent)
+	{
+		float ClosestDistanceSquared = -1.f;
+		for (int32 Index = 0; Index < UnitGraph.GetUnitCount(); ++Index)
+		{
+			const FVector2f Delta = UnitGraph.GetUnitAt(Index).Position - Point;
+			if (FMath::Abs(Delta.X) <= HalfExtent && FMath::Abs(Delta.Y) <= HalfExtent && (ClosestDistanceSquared < 0.f || Delta.SizeSquared() < ClosestDistanceSquared))
+			{
+				ClosestDistanceSquared = Delta.SizeSquared();
+			}
+		}
+		return ClosestDistanceSquared;
+	}
+
+	static TArray<int32> QueryBoxSorted(const FCRRecoilUnitSpatialGrid& Grid, const FBox2f& Box)
+	{
+		TArray<int32> UnitIDs;
+		Grid.QueryBox(Box, UnitIDs);
+		Algo::Sort(UnitIDs);
+		return UnitIDs;
+	}
+
+	static TArray<int32> QueryBoxReference(const UCRRecoilUnitGraph& UnitGraph, const FBox2f& Box)
+	{
+		TArray<int32> UnitIDs;
+		for (int32 Index = 0; Index < UnitGraph.GetUnitCount(); ++Index)
+		{
+			if (Box.IsInsideOrOn(UnitGraph.GetUnitAt(Index).Position))
+			{
+				UnitIDs.Add(static_cast<int32>(UnitGraph.GetUnitAt(Index).ID));
+			}
+		}
+		Algo::Sort(UnitIDs);
+		return UnitIDs;
+	}
+
+	/**
+	* Runs random point and box queries against the grid and a brute force scan of the graph
+	* Box sizes go from a fraction of a cell to far past the pattern, which walks the occupied cells instead of the covered ones
+	*/
+	static bool CheckQueries(FAutomationTestBase& Test, const FCRRecoilUnitSpatialGrid& Grid, const UCRRecoilUnitGraph& UnitGraph, FRandomStream& RandomStream, const TCHAR* GridName)
+	{
+		for (int32 Query = 0; Query < SpatialGridTestQueriesPerRound; ++Query)
+		{
+			const FVector2f Point = MakeRandomGridPosition(RandomStream, 12.f);
+			const float HalfExtent = RandomStream.FRandRange(0.05f, 2.f);
+
+			const int32 ClosestID = Grid.FindClosestUnit(Point, HalfExtent);
+			const float ExpectedDistanceSquared = FindClosestDistanceSquared(UnitGraph, Point, HalfExtent);
+			if (ExpectedDistanceSquared < 0.f)
+			{
+				if (!Test.TestEqual(FString::Printf(TEXT("%s finds no unit where there is none"), GridName), ClosestID, INDEX_NONE))
+				{
+					return false;
+				}
+				continue;
+			}
+
+			const int32 ClosestIndex = ClosestID != INDEX_NONE ? UnitGraph.GetUnitIndexByID(static_cast<uint32>(ClosestID)) : INDEX_NONE;
+			if (!Test.TestTrue(FString::Printf(TEXT("%s finds an existing unit"), GridName), ClosestIndex != INDEX_NONE)
+				|| !Test.TestEqual(FString::Printf(TEXT("%s finds the closest unit"), GridName), (UnitGraph.GetUnitAt(ClosestIndex).Position - Point).SizeSquared(), ExpectedDistanceSquared))
+			{
+				return false;
+			}
+		}
+
+		for (int32 Query = 0; Query < SpatialGridTestQueriesPerRound; ++Query)
+		{
+			const float MaxExtent = Query % 4 == 0 ? 1000.f : 4.f;
+			const FVector2f Corner = MakeRandomGridPosition(RandomStream, 12.f);
+			const FBox2f Box(Corner, Corner + FVector2f(RandomStream.FRandRange(0.01f, MaxExtent), RandomStream.FRandRange(0.01f, MaxExtent)));
+			if (!Test.TestTrue(FString::Printf(TEXT("%s box query matches a full scan"), GridName), QueryBoxSorted(Grid, Box) == QueryBoxReference(UnitGraph, Box)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilUnitSpatialGridTest, "CrystalRecoil.Editor.UnitSpatialGrid", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilUnitSpatialGridTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoilEditor::Tests;
+
+	FRandomStream RandomStream(4242);
+	UCRRecoilUnitGraph* UnitGraph = NewObject<UCRRecoilUnitGraph>(GetTransientPackage());
+
+	FCRRecoilUnitSpatialGrid EmptyGrid;
+	EmptyGrid.Rebuild(*UnitGraph);
+	TestEqual(TEXT("An empty grid finds nothing"), EmptyGrid.FindClosestUnit(FVector2f::ZeroVector, 1.f), INDEX_NONE);
+
+	for (int32 UnitIndex = 0; UnitIndex < SpatialGridTestUnitCount; ++UnitIndex)
+	{
+		UnitGraph->AddUnit(MakeRandomGridPosition(RandomStream, 10.f));
+	}
+
+	FCRRecoilUnitSpatialGrid IncrementalGrid;
+	IncrementalGrid.Rebuild(*UnitGraph);
+	TestTrue(TEXT("A rebuilt grid is synced"), IncrementalGrid.IsSyncedWith(*UnitGraph));
+	if (!CheckQueries(*this, IncrementalGrid, *UnitGraph, RandomStream, TEXT("The rebuilt grid")))
+	{
+		return false;
+	}
+
+	// Mirrors random edits like the widget does, some of them moving units out past the bounds the cell size was picked for
+	for (int32 Round = 0; Round < SpatialGridTestEditRounds; ++Round)
+	{
+		for (int32 Edit = 0; Edit < 10; ++Edit)
+		{
+			const int32 EditKind = RandomStream.RandRange(0, 2);
+			if (EditKind == 0 || UnitGraph->GetUnitCount() == 0)
+			{
+				const FVector2f Position = MakeRandomGridPosition(RandomStream, 10.f);
+				IncrementalGrid.AddUnit(static_cast<uint32>(UnitGraph->AddUnit(Position)), Position);
+				continue;
+			}
+
+			const uint32 ID = UnitGraph->GetUnitAt(RandomStream.RandRange(0, UnitGraph->GetUnitCount() - 1)).ID;
+			if (EditKind == 1)
+			{
+				const FVector2f Position = MakeRandomGridPosition(RandomStream, 12.f);
+				UnitGraph->GetUnitByID(ID)->Position = Position;
+				UnitGraph->MarkUnitsModified();
+				IncrementalGrid.MoveUnit(ID, Position);
+			}
+			else
+			{
+				UnitGraph->RemoveUnit(ID);
+				IncrementalGrid.RemoveUnit(ID);
+			}
+		}
+
+		TestFalse(TEXT("Graph edits unsync the grid"), IncrementalGrid.IsSyncedWith(*UnitGraph));
+		IncrementalGrid.MarkSynced(*UnitGraph);
+		TestTrue(TEXT("MarkSynced syncs the grid"), IncrementalGrid.IsSyncedWith(*UnitGraph));
+
+		FCRRecoilUnitSpatialGrid RebuiltGrid;
+		RebuiltGrid.Rebuild(*UnitGraph);
+
+		// Same query stream for both grids, so they are compared on identical queries
+		FRandomStream IncrementalQueries(Round);
+		FRandomStream RebuiltQueries(Round);
+		if (!CheckQueries(*this, IncrementalGrid, *UnitGraph, IncrementalQueries, TEXT("The incrementally updated grid"))
+			|| !CheckQueries(*this, RebuiltGrid, *UnitGraph, RebuiltQueries, TEXT("The grid rebuilt after the edits")))
+		{
+			return false;
+		}
+	}
+
+	// Moving within a cell only updates the stored position, which queries must see
+	const FCRRecoilUnit& Unit = UnitGraph->GetUnitAt(0);
+	const FVector2f NudgedPosition = Unit.Position + FVector2f(0.001f, 0.f);
+	const uint32 UnitID = Unit.ID;
+	UnitGraph->GetUnitByID(UnitID)->Position = NudgedPosition;
+	IncrementalGrid.MoveUnit(UnitID, NudgedPosition);
+	TArray<int32> NudgedHits;
+	IncrementalGrid.QueryBox(FBox2f(NudgedPosition, NudgedPosition), NudgedHits);
+	TestTrue(TEXT("A unit nudged within its cell is found at its new position"), NudgedHits.Contains(static_cast<int32>(UnitID)));
+
+	IncrementalGrid.RemoveUnit(UnitID);
+	IncrementalGrid.RemoveUnit(UnitID);
+	TestNotEqual(TEXT("A removed unit is no longer found"), IncrementalGrid.FindClosestUnit(NudgedPosition, 0.0001f), static_cast<int32>(UnitID));
+	return true;
+}
+
+#endif
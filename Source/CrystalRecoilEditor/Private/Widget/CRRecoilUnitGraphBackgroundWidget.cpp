@@ -1,6 +1,7 @@
 ﻿// Copyright CrystalVapor 2026, All rights reserved.
 
 #include "Widget/CRRecoilUnitGraphBackgroundWidget.h"
+#include "Algo/BinarySearch.h"
 
 FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer::FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer()
 {
@@ -30,15 +31,15 @@ float FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer::GetZoomAmount(int32
 
 int32 FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer::GetNearestZoomLevel(float ZoomAmount) const
 {
-	for (int32 ZoomLevelIndex = 0; ZoomLevelIndex < GetNumZoomLevels(); ++ZoomLevelIndex)
-	{
-		if (ZoomAmount <= GetZoomAmount(ZoomLevelIndex))
-		{
-			return ZoomLevelIndex;
-		}
-	}
+	// Zoom levels are sorted by zoom amount
+	const int32 ZoomLevelIndex = Algo::LowerBoundBy(ZoomLevels, ZoomAmount, &FCRZoomLevelEntry::ZoomAmount);
+	return ZoomLevels.IsValidIndex(ZoomLevelIndex) ? ZoomLevelIndex : GetDefaultZoomLevel();
+}
 
-	return GetDefaultZoomLevel();
+int32 FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer::GetFittingZoomLevel(float ZoomAmount) const
+{
+	const int32 FirstLevelAbove = Algo::UpperBoundBy(ZoomLevels, ZoomAmount, &FCRZoomLevelEntry::ZoomAmount);
+	return FMath::Max(FirstLevelAbove - 1, 0);
 }
 
 FText FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer::GetZoomText(int32 InZoomLevel) const
@@ -88,6 +89,24 @@ int32 SCRRecoilUnitGraphBackgroundWidget::GetGridAxisStep() const
 	return FMath::Max(1, FMath::CeilToInt(2.f / GetZoomAmount()));
 }
 
+void SCRRecoilUnitGraphBackgroundWidget::SetZoomLevel(int32 NewZoomLevel)
+{
+	NewZoomLevel = FMath::Clamp(NewZoomLevel, 0, ZoomLevels->GetNumZoomLevels() - 1);
+	if (NewZoomLevel == ZoomLevel)
+	{
+		return;
+	}
+
+	ZoomLevel = NewZoomLevel;
+	PostChangedZoom();
+}
+
+const FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer& SCRRecoilUnitGraphBackgroundWidget::GetZoomLevels() const
+{
+	// Always ours, see Construct
+	return static_cast<const FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer&>(*ZoomLevels);
+}
+
 void SCRRecoilUnitGraphBackgroundWidget::SetViewOffset(const FVector2D& Value)
 {
 	ViewOffset = Value;
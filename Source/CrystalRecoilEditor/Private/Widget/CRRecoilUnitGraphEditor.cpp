@@ -4,15 +4,22 @@
 #include "Data/CRRecoilPattern.h"
 #include "Data/CRRecoilUnitGraph.h"
 #include "Editor/CRRecoilPatternEditor.h"
+#include "Editor/CRRecoilUnitGraphChange.h"
 #include "Fonts/FontMeasure.h"
+#include "Containers/LruCache.h"
 #include "Widget/CRRecoilUnitGraphBackgroundWidget.h"
 #include "Misc/StringOutputDevice.h"
 #include "HAL/PlatformApplicationMisc.h"
+#include "CrystalRecoil.h"
+
+DECLARE_CYCLE_STAT(TEXT("Draw Recoil Units"), STAT_CRDrawRecoilUnits, STATGROUP_CrystalRecoil);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Recoil Unit Draw Elements"), STAT_CRRecoilUnitDrawElements, STATGROUP_CrystalRecoil);
 
 void SCRRecoilUnitGraphWidget::Construct(const FArguments& InArgs)
 {
     check(InArgs._RecoilPatternEditor)
     RecoilPatternEditor = InArgs._RecoilPatternEditor;
+    AxisLabelCache.Empty(256);
 
     static const FSlateRoundedBoxBrush KeyBorderBrush(FLinearColor(1.f, 1.f, 1.f, 0.07f), 4.f);
     static const FSlateRoundedBoxBrush PanelBackgroundBrush(FLinearColor(0.025f, 0.025f, 0.025f, 0.85f), 6.f);
@@ -166,72 +173,27 @@ void SCRRecoilUnitGraphWidget::SetRecoilUnitGraph(UCRRecoilUnitGraph* InRecoilUn
 
 void SCRRecoilUnitGraphWidget::ZoomToFitAllUnits() const
 {
-	UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
-	if (!CurrentRecoilUnitGraph || CurrentRecoilUnitGraph->GetUnitCount() == 0)
-	{
-		BackgroundWidget->SetViewOffset(BackgroundWidget->GetTickSpaceGeometry().GetLocalSize() * -0.5f / BackgroundWidget->GetZoomAmount());
-		return;
-	}
-
-	// Find bounds of all units in recoil space, always including origin (0,0)
-	FVector2f MinBounds = FVector2f::ZeroVector;
-	FVector2f MaxBounds = FVector2f::ZeroVector;
-
-	for (int32 Index = 0; Index < CurrentRecoilUnitGraph->GetUnitCount(); ++Index)
-	{
-		const FCRRecoilUnit& Unit = CurrentRecoilUnitGraph->GetUnitAt(Index);
-		MinBounds.X = FMath::Min(MinBounds.X, Unit.Position.X);
-		MinBounds.Y = FMath::Min(MinBounds.Y, Unit.Position.Y);
-		MaxBounds.X = FMath::Max(MaxBounds.X, Unit.Position.X);
-		MaxBounds.Y = FMath::Max(MaxBounds.Y, Unit.Position.Y);
-	}
-
-	// Convert to graph space and resolve min/max since Y is flipped
-	const FVector2f MinGraphCandidate = RecoilCoordsToGraphCoords(MinBounds);
-	const FVector2f MaxGraphCandidate = RecoilCoordsToGraphCoords(MaxBounds);
-	const FVector2f MinGraph = FVector2f(FMath::Min(MinGraphCandidate.X, MaxGraphCandidate.X), FMath::Min(MinGraphCandidate.Y, MaxGraphCandidate.Y));
-	const FVector2f MaxGraph = FVector2f(FMath::Max(MinGraphCandidate.X, MaxGraphCandidate.X), FMath::Max(MinGraphCandidate.Y, MaxGraphCandidate.Y));
-
-	// Add padding for visual clearance
-	const FVector2f SizeGraph = MaxGraph - MinGraph;
-	const float UnitDrawSize = CurrentRecoilUnitGraph->UnitDrawSize;
-	const FVector2f Padding = FVector2f(UnitDrawSize * 3.f + SizeGraph.X * 0.04f, UnitDrawSize * 3.f + SizeGraph.Y * 0.04f);
-	const FVector2f PaddedSizeGraph = SizeGraph + Padding * 2.f;
-	const FVector2f CenterGraph = (MinGraph + MaxGraph) * 0.5f;
+	int32 TargetZoomLevel;
+	FVector2D TargetCenterGraph;
+	ComputeZoomToFit(TargetZoomLevel, TargetCenterGraph);
+	SetViewCenterAndZoomLevel(TargetCenterGraph, TargetZoomLevel);
+}
 
-	// Find closest zoom level to fit all units
-	const FVector2f WidgetSize = BackgroundWidget->GetTickSpaceGeometry().GetLocalSize();
-	const float TargetZoom = FMath::Min(WidgetSize.X / PaddedSizeGraph.X, WidgetSize.Y / PaddedSizeGraph.Y);
+void SCRRecoilUnitGraphWidget::AnimateZoomToFitAllUnits()
+{
+	StopZoomToFitAnimation();
 
-	for (int32 Index = 0; Index < 40; ++Index)
-	{
-		BackgroundWidget->ChangeZoomLevel(-1, FVector2f::ZeroVector, false);
-	}
+	FCRZoomToFitAnimation Animation;
+	ComputeZoomToFit(Animation.TargetZoomLevel, Animation.TargetCenterGraph);
 
-	float SmallestDifference = FMath::Abs(BackgroundWidget->GetZoomAmount() - TargetZoom);
-	for (int32 Index = 0; Index < 40; ++Index)
-	{
-		BackgroundWidget->ChangeZoomLevel(1, FVector2f::ZeroVector, false);
-		const float Difference = FMath::Abs(BackgroundWidget->GetZoomAmount() - TargetZoom);
-		if (Difference <= SmallestDifference)
-		{
-			SmallestDifference = Difference;
-		}
-		else
-		{
-			BackgroundWidget->ChangeZoomLevel(-1, FVector2f::ZeroVector, false);
-			break;
-		}
-	}
+	const FVector2D WidgetSize = BackgroundWidget->GetTickSpaceGeometry().GetLocalSize();
+	Animation.StartZoomAmount = BackgroundWidget->GetZoomAmount();
+	Animation.StartCenterGraph = BackgroundWidget->GetViewOffset() + WidgetSize * 0.5 / Animation.StartZoomAmount;
+	Animation.TargetZoomAmount = BackgroundWidget->GetZoomLevels().GetZoomAmount(Animation.TargetZoomLevel);
+	Animation.StartTime = FSlateApplication::Get().GetCurrentTime();
+	ZoomToFitAnimation = Animation;
 
-	if (BackgroundWidget->GetZoomAmount() > TargetZoom)
-	{
-		BackgroundWidget->ChangeZoomLevel(-1, FVector2f::ZeroVector, false);
-	}
-
-	const float ActualZoom = BackgroundWidget->GetZoomAmount();
-	const FVector2f ViewportCenter = WidgetSize * 0.5f;
-	BackgroundWidget->SetViewOffset(FVector2D(CenterGraph.X - ViewportCenter.X / ActualZoom, CenterGraph.Y - ViewportCenter.Y / ActualZoom));
+	ZoomToFitTimerHandle = RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SCRRecoilUnitGraphWidget::TickZoomToFitAnimation));
 }
 
 int32 SCRRecoilUnitGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
@@ -249,8 +211,9 @@ int32 SCRRecoilUnitGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry&
 	}
 
 	SCompoundWidget::OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+	UpdateOverlayLayout();
 	DrawOrigin(OutDrawElements, AllottedGeometry, LayerId);
-	DrawRecoilUnits(OutDrawElements, AllottedGeometry, LayerId);
+	DrawRecoilUnits(OutDrawElements, AllottedGeometry, MyCullingRect, LayerId);
 	DrawGridAxisNumbers(OutDrawElements, AllottedGeometry, LayerId);
 	DrawSelectionBox(OutDrawElements, AllottedGeometry, LayerId);
 	return LayerId;
@@ -258,6 +221,7 @@ int32 SCRRecoilUnitGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry&
 
 FReply SCRRecoilUnitGraphWidget::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
+	StopZoomToFitAnimation();
 	SelectionDrag.Reset();
 
 	const FVector2f MousePanelLocation = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
@@ -284,13 +248,14 @@ FReply SCRRecoilUnitGraphWidget::OnMouseButtonDown(const FGeometry& MyGeometry,
 		}
 		else
 		{
+			FCRRecoilUnitSelection::FScopedBatch SelectionBatch(CurrentRecoilUnitSelection);
 			if (!MouseEvent.IsControlDown() && !CurrentRecoilUnitSelection.IsUnitSelected(LastLeftMouseDownFoundUnitID))
 			{
 				CurrentRecoilUnitSelection.ClearSelection();
 			}
 
 			CurrentRecoilUnitSelection.AddSelection(LastLeftMouseDownFoundUnitID);
-			MoveUnitsDrag = FCRUnitGraphMoveUnitsDelayedDrag(GetUnitGraph(), CurrentRecoilUnitSelection, GetUnitGraph()->GetUnitByID(LastLeftMouseDownFoundUnitID)->Position, MousePanelLocation, EKeys::LeftMouseButton);
+			MoveUnitsDrag = FCRUnitGraphMoveUnitsDelayedDrag(GetUnitGraph(), CurrentRecoilUnitSelection, GetUnitGraph()->GetUnitByID(LastLeftMouseDownFoundUnitID)->Position, MousePanelLocation, EKeys::LeftMouseButton, IsAutoRearrangeEnabled());
 		}
 	}
 
@@ -378,6 +343,8 @@ FReply SCRRecoilUnitGraphWidget::OnMouseMove(const FGeometry& MyGeometry, const
 			MoveUnitsDrag->LastRecoilCoordsLocation = SnappedNewRecoilLocation;
 		}
 
+		UpdateSpatialGridForSelection();
+
 		TryAutoRearrangeUnits();
 		RecoilPatternEditor->RefreshUnitPosition();
 	}
@@ -390,6 +357,7 @@ FReply SCRRecoilUnitGraphWidget::OnMouseMove(const FGeometry& MyGeometry, const
 		const float NewScale = ScaleVector.Size() / ScaleUnitsDrag->NormalVectorSizePanel;
 		const FCRRecoilUnitSelection& RecoilUnitSelection = GetRecoilUnitSelection();
 		ScaleUnitsDrag->ApplyScaling(RecoilUnitSelection, NewScale);
+		UpdateSpatialGridForSelection();
 	}
 
 	return SCompoundWidget::OnMouseMove(MyGeometry, MouseEvent);
@@ -397,6 +365,7 @@ FReply SCRRecoilUnitGraphWidget::OnMouseMove(const FGeometry& MyGeometry, const
 
 FReply SCRRecoilUnitGraphWidget::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
+	StopZoomToFitAnimation();
 	return BackgroundWidget->OnMouseWheel(MyGeometry, MouseEvent);
 }
 
@@ -423,14 +392,16 @@ FReply SCRRecoilUnitGraphWidget::OnKeyUp(const FGeometry& MyGeometry, const FKey
 void SCRRecoilUnitGraphWidget::DrawOrigin(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, const int32 BaseLayerID) const
 {
 	const UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
-	const FVector2f OriginPanelCoords = BackgroundWidget->GraphCoordToPanelCoord(FVector2f::ZeroVector);
+	const FVector2f OriginPanelCoords = CachedOriginPanelCoords;
 	const FVector2f OriginDrawSize = FVector2f(CurrentRecoilUnitGraph->OriginDrawSize);
 	const FVector2f OriginDrawOffset = OriginDrawSize * 0.5f;
 	FSlateDrawElement::MakeBox(OutDrawElements, BaseLayerID + CrystalRecoilEditor::EEditorLayerOffset::OriginLayer, AllottedGeometry.ToPaintGeometry(OriginDrawSize, FSlateLayoutTransform(OriginPanelCoords - OriginDrawOffset)), FAppStyle::GetBrush("Plus"), ESlateDrawEffect::None, FLinearColor::White.CopyWithNewOpacity(CurrentRecoilUnitGraph->OriginOpacity));
 }
 
-void SCRRecoilUnitGraphWidget::DrawRecoilUnits(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, int32 BaseLayerID) const
+void SCRRecoilUnitGraphWidget::DrawRecoilUnits(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, int32 BaseLayerID) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_CRDrawRecoilUnits);
+
 	const UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
 	const int32 UnitCount = CurrentRecoilUnitGraph->GetUnitCount();
 	const FVector2f UnitDrawSize = FVector2f(CurrentRecoilUnitGraph->UnitDrawSize);
@@ -440,46 +411,88 @@ void SCRRecoilUnitGraphWidget::DrawRecoilUnits(FSlateWindowElementList& OutDrawE
 	const int32 UnitNumberLayerID = BaseLayerID + CrystalRecoilEditor::EEditorLayerOffset::RecoilUnitNumbersLayer;
 	const SCRRecoilUnitGraphBackgroundWidget* CurrentBackgroundWidget = this->BackgroundWidget.Get();
 	const FSlateFontInfo NumberFontInfo = FCoreStyle::GetDefaultFontStyle("Regular", CurrentRecoilUnitGraph->UnitNumbersFontSize);
-	const bool bDrawUnitNumbers = CurrentRecoilUnitGraph->bDrawUnitNumbers && CurrentBackgroundWidget->GetCurrentLOD() >= EGraphRenderingLOD::MediumDetail;
+	const EGraphRenderingLOD::Type CurrentLOD = CurrentBackgroundWidget->GetCurrentLOD();
+	const bool bDrawUnitNumbers = CurrentRecoilUnitGraph->bDrawUnitNumbers && CurrentLOD >= EGraphRenderingLOD::MediumDetail;
+	const FSlateBrush* UnitBrush = FAppStyle::GetBrush("Icons.FilledCircle");
+	int32 DrawElementCount = 0;
+
+	// Culling rect in panel space, grown by half a unit so partially visible units still draw
+	const FVector2f HalfUnitDrawSize = UnitDrawSize * 0.5f;
+	const FVector2f CullingTopLeft = FVector2f(AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetTopLeft())) - HalfUnitDrawSize;
+	const FVector2f CullingBottomRight = FVector2f(AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetBottomRight())) + HalfUnitDrawSize;
+	const FSlateRect PanelCullingRect(CullingTopLeft.X, CullingTopLeft.Y, CullingBottomRight.X, CullingBottomRight.Y);
+
+	UnitPanelPositions.Reset(UnitCount);
+	for (int32 Index = 0; Index < UnitCount; ++Index)
+	{
+		UnitPanelPositions.Add(CurrentBackgroundWidget->GraphCoordToPanelCoord(RecoilCoordsToGraphCoords(CurrentRecoilUnitGraph->GetUnitAt(Index).Position)));
+	}
 
-	// First pass: Draw all lines
-	for (int32 Index = 1; Index < UnitCount; ++Index)
+	// First pass: All connecting lines as a single polyline, Slate clips the off-screen parts
+	if (UnitCount > 1)
 	{
-		const FCRRecoilUnit& RecoilUnit = CurrentRecoilUnitGraph->GetUnitAt(Index);
-		const FCRRecoilUnit& PreviousRecoilUnit = CurrentRecoilUnitGraph->GetUnitAt(Index - 1);
+		FSlateDrawElement::MakeLines(OutDrawElements, UnitLinesLayerID, AllottedGeometry.ToPaintGeometry(), UnitPanelPositions, ESlateDrawEffect::None, FLinearColor::White.CopyWithNewOpacity(CurrentRecoilUnitGraph->UnitLinesOpacity), true, 1.f);
+		++DrawElementCount;
+	}
 
-		const FVector2f RecoilUnitCenterGraphLocation = RecoilCoordsToGraphCoords(RecoilUnit.Position);
-		const FVector2f PreviousRecoilUnitCenterGraphLocation = RecoilCoordsToGraphCoords(PreviousRecoilUnit.Position);
+	// Zoomed far out, units closer than half their size overlap into one blob, so only the first one per screen cell is drawn
+	const bool bCollapseClusters = CurrentLOD <= EGraphRenderingLOD::LowDetail;
+	OccupiedClusterCells.Reset();
 
-		const FVector2f PreviousRecoilUnitCenterPanelLocation = CurrentBackgroundWidget->GraphCoordToPanelCoord(PreviousRecoilUnitCenterGraphLocation);
-		const FVector2f RecoilUnitCenterPanelLocation = CurrentBackgroundWidget->GraphCoordToPanelCoord(RecoilUnitCenterGraphLocation);
+	if (bDrawUnitNumbers && (CachedUnitNumbers.Num() < UnitCount || CachedUnitNumbersFontInfo != NumberFontInfo))
+	{
+		if (CachedUnitNumbersFontInfo != NumberFontInfo)
+		{
+			CachedUnitNumbers.Reset();
+			CachedUnitNumbersFontInfo = NumberFontInfo;
+		}
 
-		FSlateDrawElement::MakeLines(OutDrawElements, UnitLinesLayerID, AllottedGeometry.ToPaintGeometry(), {PreviousRecoilUnitCenterPanelLocation, RecoilUnitCenterPanelLocation}, ESlateDrawEffect::None, FLinearColor::White.CopyWithNewOpacity(CurrentRecoilUnitGraph->UnitLinesOpacity), true, 1.f);
+		const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+		for (int32 Index = CachedUnitNumbers.Num(); Index < UnitCount; ++Index)
+		{
+			FString NumberString = FString::FromInt(Index);
+			const FVector2f TextSize = FontMeasure->Measure(NumberString, NumberFontInfo);
+			CachedUnitNumbers.Add({ MoveTemp(NumberString), TextSize });
+		}
 	}
 
-	// Second pass: Draw all units
+	// Second pass: Draw visible units
 	for (int32 Index = 0; Index < UnitCount; ++Index)
 	{
-		const FCRRecoilUnit& RecoilUnit = CurrentRecoilUnitGraph->GetUnitAt(Index);
-		const FVector2f RecoilUnitCenterGraphLocation = RecoilCoordsToGraphCoords(RecoilUnit.Position);
-		const FVector2f RecoilUnitCenterPanelLocation = CurrentBackgroundWidget->GraphCoordToPanelCoord(RecoilUnitCenterGraphLocation);
-		const FVector2f RecoilUnitDrawPanelLocation = RecoilUnitCenterPanelLocation - UnitDrawSize * 0.5f;
-		const bool bIsSelected = UnitSelection.IsUnitSelected(RecoilUnit.ID);
+		const FVector2f RecoilUnitCenterPanelLocation = UnitPanelPositions[Index];
+		if (!PanelCullingRect.ContainsPoint(RecoilUnitCenterPanelLocation))
+		{
+			continue;
+		}
+
+		const bool bIsSelected = UnitSelection.IsUnitSelected(CurrentRecoilUnitGraph->GetUnitAt(Index).ID);
+		if (bCollapseClusters && !bIsSelected)
+		{
+			const FIntPoint ClusterCell(FMath::FloorToInt32(RecoilUnitCenterPanelLocation.X / HalfUnitDrawSize.X), FMath::FloorToInt32(RecoilUnitCenterPanelLocation.Y / HalfUnitDrawSize.Y));
+			bool bCellOccupied = false;
+			OccupiedClusterCells.Add(ClusterCell, &bCellOccupied);
+			if (bCellOccupied)
+			{
+				continue;
+			}
+		}
+
+		const FVector2f RecoilUnitDrawPanelLocation = RecoilUnitCenterPanelLocation - HalfUnitDrawSize;
 		const FLinearColor& UnitColor = bIsSelected ? FLinearColor(0.004f, 0.238f, 1.f) : FLinearColor::White;
 
 		// Draw Unit
-		FSlateDrawElement::MakeBox(OutDrawElements, UnitLayerID, AllottedGeometry.ToPaintGeometry(UnitDrawSize, FSlateLayoutTransform(RecoilUnitDrawPanelLocation)), FAppStyle::GetBrush("Icons.FilledCircle"), ESlateDrawEffect::None, UnitColor);
+		FSlateDrawElement::MakeBox(OutDrawElements, UnitLayerID, AllottedGeometry.ToPaintGeometry(UnitDrawSize, FSlateLayoutTransform(RecoilUnitDrawPanelLocation)), UnitBrush, ESlateDrawEffect::None, UnitColor);
+		++DrawElementCount;
 
 		// Draw Numbers centered inside units
 		if (bDrawUnitNumbers)
 		{
-			const FString NumberString = FString::FromInt(Index);
-			const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
-			const FVector2f TextSize = FontMeasure->Measure(NumberString, NumberFontInfo);
-			const FVector2f TextOffset = (UnitDrawSize - TextSize) * 0.5f;
+			const FCRCachedUnitNumber& UnitNumber = CachedUnitNumbers[Index];
+			const FVector2f TextOffset = (UnitDrawSize - UnitNumber.TextSize) * 0.5f;
 			const FLinearColor NumberColor = bIsSelected ? FLinearColor::White : FLinearColor::Black;
 
-			FSlateDrawElement::MakeText(OutDrawElements, UnitNumberLayerID, AllottedGeometry.ToPaintGeometry(FSlateLayoutTransform(RecoilUnitDrawPanelLocation + TextOffset)), NumberString, NumberFontInfo, ESlateDrawEffect::None, NumberColor);
+			FSlateDrawElement::MakeText(OutDrawElements, UnitNumberLayerID, AllottedGeometry.ToPaintGeometry(FSlateLayoutTransform(RecoilUnitDrawPanelLocation + TextOffset)), UnitNumber.Text, NumberFontInfo, ESlateDrawEffect::None, NumberColor);
+			++DrawElementCount;
 		}
 	}
 
@@ -494,29 +507,49 @@ void SCRRecoilUnitGraphWidget::DrawRecoilUnits(FSlateWindowElementList& OutDrawE
 		for (int32 Index = 0; Index < UnitCount; ++Index)
 		{
 			const FCRRecoilUnit& RecoilUnit = CurrentRecoilUnitGraph->GetUnitAt(Index);
-			if (!UnitSelection.IsUnitSelected(RecoilUnit.ID))
+			const FVector2f UnitCenterPanelLocation = UnitPanelPositions[Index];
+			if (!UnitSelection.IsUnitSelected(RecoilUnit.ID) || !PanelCullingRect.ContainsPoint(UnitCenterPanelLocation))
 			{
 				continue;
 			}
 
-			const FVector2f UnitCenterPanelLocation = CurrentBackgroundWidget->GraphCoordToPanelCoord(RecoilCoordsToGraphCoords(RecoilUnit.Position));
 			const FString LabelText = FString::Printf(TEXT("%.2f, %.2f"), RecoilUnit.Position.X, RecoilUnit.Position.Y);
 			const FVector2f LabelSize = FontMeasure->Measure(LabelText, LabelFontInfo);
 			const FVector2f LabelPosition(UnitCenterPanelLocation.X + LabelOffsetX, UnitCenterPanelLocation.Y - LabelSize.Y * 0.5f);
 
 			FSlateDrawElement::MakeText(OutDrawElements, DragLabelLayerID, AllottedGeometry.ToPaintGeometry(FSlateLayoutTransform(LabelPosition)), LabelText, LabelFontInfo, ESlateDrawEffect::None, FLinearColor::Gray);
+			++DrawElementCount;
 		}
 	}
+
+	UnitDrawElementCount = DrawElementCount;
+	SET_DWORD_STAT(STAT_CRRecoilUnitDrawElements, DrawElementCount);
 }
 
-void SCRRecoilUnitGraphWidget::DrawGridAxisNumbers(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, const int32 BaseLayerID) const
+int32 SCRRecoilUnitGraphWidget::GetUnitDrawElementCount() const
+{
+	return UnitDrawElementCount;
+}
+
+void SCRRecoilUnitGraphWidget::UpdateOverlayLayout() const
 {
-	const FVector2D LocalSize = GetTickSpaceGeometry().GetLocalSize();
+	const FCROverlayLayoutKey LayoutKey{ BackgroundWidget->GetViewOffset(), BackgroundWidget->GetZoomAmount(), GetTickSpaceGeometry().GetLocalSize() };
+	if (CachedOverlayLayoutKey.IsSet() && CachedOverlayLayoutKey.GetValue() == LayoutKey)
+	{
+		// Idle frames and unit edits don't move the origin or the axis numbers
+		return;
+	}
+
+	CachedOverlayLayoutKey = LayoutKey;
+	CachedOriginPanelCoords = BackgroundWidget->GraphCoordToPanelCoord(FVector2f::ZeroVector);
+	CachedAxisLabels.Reset();
+
+	const FVector2D LocalSize = LayoutKey.LocalSize;
 	const int32 GridAxisStep = BackgroundWidget->GetGridAxisStep();
 	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
 	const FSlateFontInfo NumberFontInfo = FCoreStyle::GetDefaultFontStyle("Regular", 10);
-	const float Zoom = BackgroundWidget->GetZoomAmount();
-	const FVector2D ViewOffset = BackgroundWidget->GetViewOffset();
+	const float Zoom = LayoutKey.Zoom;
+	const FVector2D ViewOffset = LayoutKey.ViewOffset;
 
 	// Compute the exact visible grid number range from the viewport bounds - panel X = [0, W] maps to graph X = [ViewOffset.X, ViewOffset.X + W / Zoom]
 	const int32 XGridStart = FMath::FloorToInt(ViewOffset.X / ScaleFromRecoilCoordsToGraphCoords / GridAxisStep) * GridAxisStep;
@@ -526,16 +559,28 @@ void SCRRecoilUnitGraphWidget::DrawGridAxisNumbers(FSlateWindowElementList& OutD
 
 	for (int32 GridNum = XGridStart; GridNum <= XGridEnd; GridNum += GridAxisStep)
 	{
-		DrawSingleGridAxisNumber(GridNum, true, NumberFontInfo, FontMeasure, AllottedGeometry, OutDrawElements, BaseLayerID);
+		LayoutSingleGridAxisNumber(GridNum, true, NumberFontInfo, FontMeasure);
 	}
 
 	for (int32 GridNum = YGridStart; GridNum <= YGridEnd; GridNum += GridAxisStep)
 	{
-		DrawSingleGridAxisNumber(GridNum, false, NumberFontInfo, FontMeasure, AllottedGeometry, OutDrawElements, BaseLayerID);
+		LayoutSingleGridAxisNumber(GridNum, false, NumberFontInfo, FontMeasure);
 	}
 }
 
-void SCRRecoilUnitGraphWidget::DrawSingleGridAxisNumber(const int32 GridLineNumber, const bool bXAxis, const FSlateFontInfo& NumberFontInfo, const TSharedRef<FSlateFontMeasure>& FontMeasure, const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 BaseLayerID) const
+void SCRRecoilUnitGraphWidget::DrawGridAxisNumbers(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, const int32 BaseLayerID) const
+{
+	const FSlateFontInfo NumberFontInfo = FCoreStyle::GetDefaultFontStyle("Regular", 10);
+	const int32 GridCoordinateLayerID = BaseLayerID + CrystalRecoilEditor::EEditorLayerOffset::GridCoordinateLayer;
+
+	for (const FCRGridAxisLabel& Label : CachedAxisLabels)
+	{
+		const FPaintGeometry TextPaintGeometry = AllottedGeometry.ToPaintGeometry(Label.Metrics->TextSize, FSlateLayoutTransform(Label.Position));
+		FSlateDrawElement::MakeText(OutDrawElements, GridCoordinateLayerID, TextPaintGeometry, Label.Metrics->Text, NumberFontInfo, ESlateDrawEffect::None, Label.Color);
+	}
+}
+
+void SCRRecoilUnitGraphWidget::LayoutSingleGridAxisNumber(const int32 GridLineNumber, const bool bXAxis, const FSlateFontInfo& NumberFontInfo, const TSharedRef<FSlateFontMeasure>& FontMeasure) const
 {
 	const FVector2d GridLineNumberGraphCoords = bXAxis ? FVector2d(GridLineNumber * ScaleFromRecoilCoordsToGraphCoords, 0.f) : FVector2d(0.f, GridLineNumber * ScaleFromRecoilCoordsToGraphCoords);
 	FVector2f GridLineNumberPanelCoords = BackgroundWidget->GraphCoordToPanelCoord(GridLineNumberGraphCoords);
@@ -559,23 +604,35 @@ void SCRRecoilUnitGraphWidget::DrawSingleGridAxisNumber(const int32 GridLineNumb
 
 	// Negate Y-axis numbers so positive values appear at the top (like a math graph),
 	// making upward recoil display as positive values instead of using screen coordinates
-	const FString GridTickText = bXAxis ? FString::FromInt(GridLineNumber) : FString::FromInt(-GridLineNumber);
-	const FLinearColor GridTickTextColor = GridLineNumber == 0 ? FLinearColor::White : FLinearColor::White.CopyWithNewOpacity(0.65f);
-	const FVector2d GridTickTextSize = FontMeasure->Measure(GridTickText, NumberFontInfo);
+	const int32 DisplayedNumber = bXAxis ? GridLineNumber : -GridLineNumber;
+	const TPair<int32, uint32> CacheKey(DisplayedNumber, GetTypeHash(NumberFontInfo));
+
+	TSharedPtr<const FCRGridAxisLabelMetrics> Metrics;
+	if (const TSharedPtr<const FCRGridAxisLabelMetrics>* CachedMetrics = AxisLabelCache.FindAndTouch(CacheKey))
+	{
+		Metrics = *CachedMetrics;
+	}
+	else
+	{
+		FString GridTickText = FString::FromInt(DisplayedNumber);
+		const FVector2f GridTickTextSize = FontMeasure->Measure(GridTickText, NumberFontInfo);
+		Metrics = MakeShared<const FCRGridAxisLabelMetrics>(FCRGridAxisLabelMetrics{ MoveTemp(GridTickText), GridTickTextSize });
+		AxisLabelCache.Add(CacheKey, Metrics);
+	}
+
 	FVector2f GridTickDrawnPosition = GridLineNumberPanelCoords;
 
 	if (bXAxis)
 	{
-		GridTickDrawnPosition.X -= GridTickTextSize.X * 0.5f;
+		GridTickDrawnPosition.X -= Metrics->TextSize.X * 0.5f;
 	}
 	else
 	{
-		GridTickDrawnPosition.Y -= GridTickTextSize.Y * 0.5f;
+		GridTickDrawnPosition.Y -= Metrics->TextSize.Y * 0.5f;
 	}
 
-	const FSlateLayoutTransform TextTransform = FSlateLayoutTransform(GridTickDrawnPosition);
-	const FPaintGeometry TextPaintGeometry = AllottedGeometry.ToPaintGeometry(GridTickTextSize, TextTransform);
-	FSlateDrawElement::MakeText(OutDrawElements, BaseLayerID + CrystalRecoilEditor::EEditorLayerOffset::GridCoordinateLayer, TextPaintGeometry, GridTickText, NumberFontInfo, ESlateDrawEffect::None, GridTickTextColor);
+	const FLinearColor GridTickTextColor = GridLineNumber == 0 ? FLinearColor::White : FLinearColor::White.CopyWithNewOpacity(0.65f);
+	CachedAxisLabels.Add({ Metrics, GridTickDrawnPosition, GridTickTextColor });
 }
 
 void SCRRecoilUnitGraphWidget::DrawSelectionBox(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, const int32 BaseLayerID) const
@@ -593,20 +650,24 @@ void SCRRecoilUnitGraphWidget::AddUnitUnderCursor() const
 {
 	UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
 	FScopedTransaction Transaction(NSLOCTEXT("SCRRecoilUnitGraphWidget", "AddUnitUnderCursor", "Add Unit Under Cursor"));
-	CurrentRecoilUnitGraph->Modify();
+	TUniquePtr<FCRRecoilUnitGraphChange> Change = MakeUnique<FCRRecoilUnitGraphChange>(*CurrentRecoilUnitGraph, TConstArrayView<uint32>(), IsAutoRearrangeEnabled());
 
 	const FVector2f CurrentMouseRecoilLocation = GraphCoordsToRecoilCoords(BackgroundWidget->PanelCoordToGraphCoord(CurrentMousePanelPosition));
-	CurrentRecoilUnitGraph->AddUnit(CurrentMouseRecoilLocation);
+	const uint32 UnitID = AddUnitToGraph(CurrentRecoilUnitGraph, CurrentMouseRecoilLocation, IsAutoRearrangeEnabled());
 
-	TryAutoRearrangeUnits();
+	Change->RecordAfter(*CurrentRecoilUnitGraph, MakeArrayView(&UnitID, 1));
+	FCRRecoilUnitGraphChange::StoreUndo(*CurrentRecoilUnitGraph, MoveTemp(Change));
 }
 
 void SCRRecoilUnitGraphWidget::AddUnit(const FVector2f& RecoilLocation) const
 {
 	UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
 	FScopedTransaction Transaction(NSLOCTEXT("SCRRecoilUnitGraphWidget", "AddUnit", "Add Unit"));
-	CurrentRecoilUnitGraph->Modify();
-	CurrentRecoilUnitGraph->AddUnit(RecoilLocation);
+	TUniquePtr<FCRRecoilUnitGraphChange> Change = MakeUnique<FCRRecoilUnitGraphChange>(*CurrentRecoilUnitGraph, TConstArrayView<uint32>());
+	const uint32 UnitID = AddUnitToGraph(CurrentRecoilUnitGraph, RecoilLocation);
+
+	Change->RecordAfter(*CurrentRecoilUnitGraph, MakeArrayView(&UnitID, 1));
+	FCRRecoilUnitGraphChange::StoreUndo(*CurrentRecoilUnitGraph, MoveTemp(Change));
 }
 
 void SCRRecoilUnitGraphWidget::CopySelectedUnits() const
@@ -638,14 +699,50 @@ void SCRRecoilUnitGraphWidget::PasteUnits() const
 	UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
 	const FVector2f CurrentMouseRecoilLocation = GraphCoordsToRecoilCoords(BackgroundWidget->PanelCoordToGraphCoord(CurrentMousePanelPosition));
 	FScopedTransaction Transaction(NSLOCTEXT("SCRRecoilUnitGraphWidget", "PasteUnits", "Paste Units"));
-	CurrentRecoilUnitGraph->Modify();
+	TUniquePtr<FCRRecoilUnitGraphChange> Change = MakeUnique<FCRRecoilUnitGraphChange>(*CurrentRecoilUnitGraph, TConstArrayView<uint32>(), IsAutoRearrangeEnabled());
+	TArray<uint32> PastedUnitIDs;
+	PastedUnitIDs.Reserve(CopiedData.RecoilUnitLocations.Num());
 
-	for (const FVector2f& Location : CopiedData.RecoilUnitLocations)
+	if (!IsAutoRearrangeEnabled())
 	{
-		CurrentRecoilUnitGraph->AddUnit(Location + CurrentMouseRecoilLocation);
+		for (const FVector2f& Location : CopiedData.RecoilUnitLocations)
+		{
+			PastedUnitIDs.Add(AddUnitToGraph(CurrentRecoilUnitGraph, Location + CurrentMouseRecoilLocation));
+		}
 	}
+	else
+	{
+		TArray<FVector2f> PastedLocations;
+		PastedLocations.Reserve(CopiedData.RecoilUnitLocations.Num());
+		for (const FVector2f& Location : CopiedData.RecoilUnitLocations)
+		{
+			PastedLocations.Add(Location + CurrentMouseRecoilLocation);
+		}
+
+		const bool bSpatialGridWasSynced = SpatialGrid.IsSyncedWith(*CurrentRecoilUnitGraph);
+
+		// Cheap when the units are already ordered, covers graphs that were edited with auto rearrange turned off
+		CurrentRecoilUnitGraph->RearrangeUnits();
+		const uint32 FirstUnitID = CurrentRecoilUnitGraph->AddUnitsSorted(PastedLocations);
 
-	TryAutoRearrangeUnits();
+		// Pasted units get consecutive IDs in clipboard order
+		for (int32 Index = 0; Index < PastedLocations.Num(); ++Index)
+		{
+			PastedUnitIDs.Add(FirstUnitID + Index);
+			if (bSpatialGridWasSynced)
+			{
+				SpatialGrid.AddUnit(FirstUnitID + Index, PastedLocations[Index]);
+			}
+		}
+
+		if (bSpatialGridWasSynced)
+		{
+			SpatialGrid.MarkSynced(*CurrentRecoilUnitGraph);
+		}
+	}
+
+	Change->RecordAfter(*CurrentRecoilUnitGraph, PastedUnitIDs);
+	FCRRecoilUnitGraphChange::StoreUndo(*CurrentRecoilUnitGraph, MoveTemp(Change));
 }
 
 void SCRRecoilUnitGraphWidget::DeleteUnits() const
@@ -653,14 +750,26 @@ void SCRRecoilUnitGraphWidget::DeleteUnits() const
 	FCRRecoilUnitSelection& CurrentUnitSelection = GetRecoilUnitSelection();
 	UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
 	FScopedTransaction Transaction(NSLOCTEXT("SCRRecoilUnitGraphWidget", "DeleteUnits", "Delete Units"));
-	CurrentRecoilUnitGraph->Modify();
 
-	TArray<int32> SelectedUnitIDs = CurrentUnitSelection.GetSelection();
-	const int32 UnitSelectionCount = SelectedUnitIDs.Num();
+	const TArray<int32>& SelectedUnitIDs = CurrentUnitSelection.GetSelection();
+	const bool bSpatialGridWasSynced = SpatialGrid.IsSyncedWith(*CurrentRecoilUnitGraph);
+
+	TArray<uint32> UnitIDsToRemove;
+	UnitIDsToRemove.Reserve(SelectedUnitIDs.Num());
+	for (const int32 UnitID : SelectedUnitIDs)
+	{
+		UnitIDsToRemove.Add(UnitID);
+		SpatialGrid.RemoveUnit(UnitID);
+	}
 
-	for (int32 Index = 0; Index < UnitSelectionCount; ++Index)
+	TUniquePtr<FCRRecoilUnitGraphChange> Change = MakeUnique<FCRRecoilUnitGraphChange>(*CurrentRecoilUnitGraph, UnitIDsToRemove);
+	CurrentRecoilUnitGraph->RemoveUnits(UnitIDsToRemove);
+	Change->RecordAfter(*CurrentRecoilUnitGraph);
+	FCRRecoilUnitGraphChange::StoreUndo(*CurrentRecoilUnitGraph, MoveTemp(Change));
+
+	if (bSpatialGridWasSynced)
 	{
-		CurrentRecoilUnitGraph->RemoveUnit(SelectedUnitIDs[Index]);
+		SpatialGrid.MarkSynced(*CurrentRecoilUnitGraph);
 	}
 
 	CurrentUnitSelection.ClearSelection();
@@ -726,51 +835,188 @@ FVector2f SCRRecoilUnitGraphWidget::GraphCoordsToRecoilCoords(FVector2f GraphCoo
 int32 SCRRecoilUnitGraphWidget::FindUnitByScreenLocation(const FVector2f& ScreenLocation) const
 {
 	const UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
-	const int32 UnitCount = CurrentRecoilUnitGraph->GetUnitCount();
-	const FVector2f UnitDrawSize = FVector2f(CurrentRecoilUnitGraph->UnitDrawSize);
 
-	for (int32 Index = 0; Index < UnitCount; ++Index)
+	// Units are drawn at a fixed panel size, so their hit box in recoil space shrinks as the view zooms in
+	const float HalfExtent = CurrentRecoilUnitGraph->UnitDrawSize * 0.5f / (BackgroundWidget->GetZoomAmount() * ScaleFromRecoilCoordsToGraphCoords);
+	const FVector2f RecoilLocation = GraphCoordsToRecoilCoords(BackgroundWidget->PanelCoordToGraphCoord(ScreenLocation));
+	return GetSpatialGrid().FindClosestUnit(RecoilLocation, HalfExtent);
+}
+
+void SCRRecoilUnitGraphWidget::SelectUnitsInPanelCoordsRect(const FSlateRect& SelectionRect) const
+{
+	FCRRecoilUnitSelection& UnitSelection = GetRecoilUnitSelection();
+
+	// Only the two corners are converted, Y flips between panel and recoil space so min/max are resolved afterwards
+	const FVector2f RecoilCornerA = GraphCoordsToRecoilCoords(BackgroundWidget->PanelCoordToGraphCoord(FVector2f(SelectionRect.GetTopLeft())));
+	const FVector2f RecoilCornerB = GraphCoordsToRecoilCoords(BackgroundWidget->PanelCoordToGraphCoord(FVector2f(SelectionRect.GetBottomRight())));
+	const FBox2f RecoilBox(RecoilCornerA.ComponentMin(RecoilCornerB), RecoilCornerA.ComponentMax(RecoilCornerB));
+
+	TArray<int32> UnitsInRect;
+	GetSpatialGrid().QueryBox(RecoilBox, UnitsInRect);
+
+	// Grid order is arbitrary, keep the selection order stable
+	UnitsInRect.Sort();
+
+	UnitSelection.SetSelection(UnitsInRect);
+}
+
+const FCRRecoilUnitSpatialGrid& SCRRecoilUnitGraphWidget::GetSpatialGrid() const
+{
+	const UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
+	if (!SpatialGrid.IsSyncedWith(*CurrentRecoilUnitGraph))
 	{
-		const FCRRecoilUnit& RecoilUnit = CurrentRecoilUnitGraph->GetUnitAt(Index);
-		const FVector2f RecoilUnitCenterGraphLocation = RecoilCoordsToGraphCoords(RecoilUnit.Position);
-		const FVector2f RecoilUnitCenterPanelLocation = BackgroundWidget->GraphCoordToPanelCoord(RecoilUnitCenterGraphLocation);
-		const FSlateRect UnitRect(RecoilUnitCenterPanelLocation - UnitDrawSize * 0.5f, RecoilUnitCenterPanelLocation + UnitDrawSize * 0.5f);
+		SpatialGrid.Rebuild(*CurrentRecoilUnitGraph);
+	}
+	return SpatialGrid;
+}
 
-		if (UnitRect.ContainsPoint(ScreenLocation))
+uint32 SCRRecoilUnitGraphWidget::AddUnitToGraph(UCRRecoilUnitGraph* UnitGraph, const FVector2f& RecoilLocation, const bool bKeepOrder) const
+{
+	const bool bSpatialGridWasSynced = SpatialGrid.IsSyncedWith(*UnitGraph);
+
+	if (bKeepOrder)
+	{
+		// Cheap when the units are already ordered, covers graphs that were edited with auto rearrange turned off
+		UnitGraph->RearrangeUnits();
+	}
+	const uint32 UnitID = bKeepOrder ? UnitGraph->AddUnitSorted(RecoilLocation) : UnitGraph->AddUnit(RecoilLocation);
+
+	if (bSpatialGridWasSynced)
+	{
+		SpatialGrid.AddUnit(UnitID, RecoilLocation);
+		SpatialGrid.MarkSynced(*UnitGraph);
+	}
+	return UnitID;
+}
+
+void SCRRecoilUnitGraphWidget::UpdateSpatialGridForSelection() const
+{
+	UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
+	if (!SpatialGrid.IsSyncedWith(*CurrentRecoilUnitGraph))
+	{
+		// Next query rebuilds it anyway
+		return;
+	}
+
+	// Runs on every drag event, so look units up in place rather than through GetSelectedRecoilUnits' temporary array
+	for (const int32 UnitID : GetRecoilUnitSelection().GetSelection())
+	{
+		const int32 UnitIndex = CurrentRecoilUnitGraph->GetUnitIndexByID(UnitID);
+		if (UnitIndex != INDEX_NONE)
 		{
-			return RecoilUnit.ID;
+			SpatialGrid.MoveUnit(UnitID, CurrentRecoilUnitGraph->GetUnitAt(UnitIndex).Position);
 		}
 	}
-	return INDEX_NONE;
 }
 
-void SCRRecoilUnitGraphWidget::SelectUnitsInPanelCoordsRect(const FSlateRect& SelectionRect) const
+bool SCRRecoilUnitGraphWidget::IsAutoRearrangeEnabled() const
 {
-	const UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
-	FCRRecoilUnitSelection& UnitSelection = GetRecoilUnitSelection();
+	return RecoilPatternEditor && RecoilPatternEditor->bEnableAutoRearrangeUnits;
+}
+
+void SCRRecoilUnitGraphWidget::TryAutoRearrangeUnits() const
+{
+	if (RecoilUnitGraph.IsValid() && IsAutoRearrangeEnabled())
+	{
+		// Only the dragged units are out of place, so shifting them is cheaper than a full sort
+		RecoilUnitGraph->RepairUnitOrder();
+	}
+}
+
+void SCRRecoilUnitGraphWidget::ComputeZoomToFit(int32& OutZoomLevel, FVector2D& OutCenterGraph) const
+{
+	const FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer& ZoomLevels = BackgroundWidget->GetZoomLevels();
+	UCRRecoilUnitGraph* CurrentRecoilUnitGraph = GetUnitGraph();
+	if (!CurrentRecoilUnitGraph || CurrentRecoilUnitGraph->GetUnitCount() == 0)
+	{
+		// Keep the current zoom and center the origin
+		OutZoomLevel = ZoomLevels.GetNearestZoomLevel(BackgroundWidget->GetZoomAmount());
+		OutCenterGraph = FVector2D::ZeroVector;
+		return;
+	}
+
+	// Find bounds of all units in recoil space, always including origin (0,0)
+	FVector2f MinBounds = FVector2f::ZeroVector;
+	FVector2f MaxBounds = FVector2f::ZeroVector;
 
 	for (int32 Index = 0; Index < CurrentRecoilUnitGraph->GetUnitCount(); ++Index)
 	{
-		const FCRRecoilUnit& RecoilUnit = CurrentRecoilUnitGraph->GetUnitAt(Index);
-		const FVector2f RecoilUnitCenterGraphLocation = RecoilCoordsToGraphCoords(RecoilUnit.Position);
-		const FVector2f RecoilUnitCenterPanelLocation = BackgroundWidget->GraphCoordToPanelCoord(RecoilUnitCenterGraphLocation);
+		const FCRRecoilUnit& Unit = CurrentRecoilUnitGraph->GetUnitAt(Index);
+		MinBounds.X = FMath::Min(MinBounds.X, Unit.Position.X);
+		MinBounds.Y = FMath::Min(MinBounds.Y, Unit.Position.Y);
+		MaxBounds.X = FMath::Max(MaxBounds.X, Unit.Position.X);
+		MaxBounds.Y = FMath::Max(MaxBounds.Y, Unit.Position.Y);
+	}
 
-		if (SelectionRect.ContainsPoint(RecoilUnitCenterPanelLocation))
-		{
-			UnitSelection.AddSelection(RecoilUnit.ID);
-		}
-		else
-		{
-			UnitSelection.RemoveSelection(RecoilUnit.ID);
-		}
+	// Convert to graph space and resolve min/max since Y is flipped
+	const FVector2f MinGraphCandidate = RecoilCoordsToGraphCoords(MinBounds);
+	const FVector2f MaxGraphCandidate = RecoilCoordsToGraphCoords(MaxBounds);
+	const FVector2f MinGraph = FVector2f(FMath::Min(MinGraphCandidate.X, MaxGraphCandidate.X), FMath::Min(MinGraphCandidate.Y, MaxGraphCandidate.Y));
+	const FVector2f MaxGraph = FVector2f(FMath::Max(MinGraphCandidate.X, MaxGraphCandidate.X), FMath::Max(MinGraphCandidate.Y, MaxGraphCandidate.Y));
+
+	// Add padding for visual clearance
+	const FVector2f SizeGraph = MaxGraph - MinGraph;
+	const float UnitDrawSize = CurrentRecoilUnitGraph->UnitDrawSize;
+	const FVector2f Padding = FVector2f(UnitDrawSize * 3.f + SizeGraph.X * 0.04f, UnitDrawSize * 3.f + SizeGraph.Y * 0.04f);
+	const FVector2f PaddedSizeGraph = SizeGraph + Padding * 2.f;
+
+	// Largest zoom level that still fits everything
+	const FVector2f WidgetSize = BackgroundWidget->GetTickSpaceGeometry().GetLocalSize();
+	const float TargetZoom = FMath::Min(WidgetSize.X / PaddedSizeGraph.X, WidgetSize.Y / PaddedSizeGraph.Y);
+
+	OutZoomLevel = ZoomLevels.GetFittingZoomLevel(TargetZoom);
+	OutCenterGraph = FVector2D((MinGraph + MaxGraph) * 0.5f);
+}
+
+void SCRRecoilUnitGraphWidget::SetViewCenterAndZoomLevel(const FVector2D& CenterGraph, const int32 NewZoomLevel) const
+{
+	BackgroundWidget->SetZoomLevel(NewZoomLevel);
+
+	const float ActualZoom = BackgroundWidget->GetZoomAmount();
+	const FVector2D ViewportCenter = BackgroundWidget->GetTickSpaceGeometry().GetLocalSize() * 0.5;
+	BackgroundWidget->SetViewOffset(CenterGraph - ViewportCenter / ActualZoom);
+}
+
+EActiveTimerReturnType SCRRecoilUnitGraphWidget::TickZoomToFitAnimation(double InCurrentTime, float InDeltaTime)
+{
+	constexpr double AnimationDuration = 0.25;
+
+	if (!ZoomToFitAnimation.IsSet())
+	{
+		ZoomToFitTimerHandle.Reset();
+		return EActiveTimerReturnType::Stop;
 	}
+
+	const FCRZoomToFitAnimation& Animation = ZoomToFitAnimation.GetValue();
+	const float Alpha = FMath::Clamp(static_cast<float>((InCurrentTime - Animation.StartTime) / AnimationDuration), 0.f, 1.f);
+	const float EasedAlpha = FMath::InterpEaseInOut(0.f, 1.f, Alpha, 2.f);
+	const FVector2D CenterGraph = FMath::Lerp(Animation.StartCenterGraph, Animation.TargetCenterGraph, static_cast<double>(EasedAlpha));
+
+	// Zoom only has discrete levels, step through the ones between start and target
+	const int32 CurrentZoomLevel = Alpha < 1.f
+		? BackgroundWidget->GetZoomLevels().GetFittingZoomLevel(FMath::Lerp(Animation.StartZoomAmount, Animation.TargetZoomAmount, EasedAlpha))
+		: Animation.TargetZoomLevel;
+	SetViewCenterAndZoomLevel(CenterGraph, CurrentZoomLevel);
+	Invalidate(EInvalidateWidgetReason::Paint);
+
+	if (Alpha < 1.f)
+	{
+		return EActiveTimerReturnType::Continue;
+	}
+
+	ZoomToFitAnimation.Reset();
+	ZoomToFitTimerHandle.Reset();
+	return EActiveTimerReturnType::Stop;
 }
 
-void SCRRecoilUnitGraphWidget::TryAutoRearrangeUnits() const
+void SCRRecoilUnitGraphWidget::StopZoomToFitAnimation()
 {
-	if (RecoilPatternEditor && RecoilUnitGraph.IsValid() && RecoilPatternEditor->bEnableAutoRearrangeUnits)
+	ZoomToFitAnimation.Reset();
+
+	if (const TSharedPtr<FActiveTimerHandle> TimerHandle = ZoomToFitTimerHandle)
 	{
-		RecoilUnitGraph->RearrangeUnits();
+		UnRegisterActiveTimer(TimerHandle.ToSharedRef());
+		ZoomToFitTimerHandle.Reset();
 	}
 }
 
@@ -0,0 +1,183 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "Widget/CRRecoilUnitSpatialGrid.h"
+#include "Data/CRRecoilUnitGraph.h"
+
+namespace
+{
+	constexpr float MinCellSize = 0.1f;
+	constexpr float MaxCellSize = 16.f;
+
+	// Aim for a couple of units per cell on average
+	constexpr float UnitsPerCell = 2.f;
+}
+
+template <typename FunctionType>
+void FCRRecoilUnitSpatialGrid::ForEachEntryInCells(const FIntPoint& MinCell, const FIntPoint& MaxCell, FunctionType&& Function) const
+{
+	// When zoomed far out or marqueeing past the pattern, the range covers more cells than exist, so walk the occupied ones instead
+	const int64 CoveredCellCount = (static_cast<int64>(MaxCell.X) - MinCell.X + 1) * (static_cast<int64>(MaxCell.Y) - MinCell.Y + 1);
+	if (CoveredCellCount > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<FEntry>>& Cell : Cells)
+		{
+			if (Cell.Key.X >= MinCell.X && Cell.Key.X <= MaxCell.X && Cell.Key.Y >= MinCell.Y && Cell.Key.Y <= MaxCell.Y)
+			{
+				for (const FEntry& Entry : Cell.Value)
+				{
+					Function(Entry);
+				}
+			}
+		}
+		return;
+	}
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			if (const TArray<FEntry>* Entries = Cells.Find(FIntPoint(CellX, CellY)))
+			{
+				for (const FEntry& Entry : *Entries)
+				{
+					Function(Entry);
+				}
+			}
+		}
+	}
+}
+
+void FCRRecoilUnitSpatialGrid::Rebuild(const UCRRecoilUnitGraph& UnitGraph)
+{
+	Reset();
+
+	const int32 UnitCount = UnitGraph.GetUnitCount();
+	if (UnitCount > 0)
+	{
+		FBox2f Bounds(ForceInit);
+		for (int32 Index = 0; Index < UnitCount; ++Index)
+		{
+			Bounds += UnitGraph.GetUnitAt(Index).Position;
+		}
+
+		const FVector2f Extent = Bounds.GetSize().ComponentMax(FVector2f(MinCellSize));
+		CellSize = FMath::Clamp(FMath::Sqrt(Extent.X * Extent.Y * UnitsPerCell / UnitCount), MinCellSize, MaxCellSize);
+
+		UnitCells.Reserve(UnitCount);
+		for (int32 Index = 0; Index < UnitCount; ++Index)
+		{
+			const FCRRecoilUnit& Unit = UnitGraph.GetUnitAt(Index);
+			AddUnit(Unit.ID, Unit.Position);
+		}
+	}
+
+	MarkSynced(UnitGraph);
+}
+
+void FCRRecoilUnitSpatialGrid::Reset()
+{
+	Cells.Reset();
+	UnitCells.Reset();
+	SyncedGraph.Reset();
+}
+
+bool FCRRecoilUnitSpatialGrid::IsSyncedWith(const UCRRecoilUnitGraph& UnitGraph) const
+{
+	return SyncedGraph.Get() == &UnitGraph && SyncedRevision == UnitGraph.GetUnitsRevision();
+}
+
+void FCRRecoilUnitSpatialGrid::MarkSynced(const UCRRecoilUnitGraph& UnitGraph)
+{
+	SyncedGraph = &UnitGraph;
+	SyncedRevision = UnitGraph.GetUnitsRevision();
+}
+
+void FCRRecoilUnitSpatialGrid::AddUnit(const uint32 ID, const FVector2f& Position)
+{
+	const FIntPoint Cell = GetCell(Position);
+	Cells.FindOrAdd(Cell).Add({ ID, Position });
+	UnitCells.Add(ID, Cell);
+}
+
+void FCRRecoilUnitSpatialGrid::RemoveUnit(const uint32 ID)
+{
+	FIntPoint Cell;
+	if (!UnitCells.RemoveAndCopyValue(ID, Cell))
+	{
+		return;
+	}
+
+	TArray<FEntry>& Entries = Cells.FindChecked(Cell);
+	Entries.RemoveAllSwap([ID](const FEntry& Entry) { return Entry.ID == ID; });
+	if (Entries.IsEmpty())
+	{
+		Cells.Remove(Cell);
+	}
+}
+
+void FCRRecoilUnitSpatialGrid::MoveUnit(const uint32 ID, const FVector2f& NewPosition)
+{
+	const FIntPoint* OldCell = UnitCells.Find(ID);
+	if (!OldCell)
+	{
+		AddUnit(ID, NewPosition);
+		return;
+	}
+
+	if (*OldCell == GetCell(NewPosition))
+	{
+		// Same cell, only the stored position changes
+		for (FEntry& Entry : Cells.FindChecked(*OldCell))
+		{
+			if (Entry.ID == ID)
+			{
+				Entry.Position = NewPosition;
+				break;
+			}
+		}
+		return;
+	}
+
+	RemoveUnit(ID);
+	AddUnit(ID, NewPosition);
+}
+
+int32 FCRRecoilUnitSpatialGrid::FindClosestUnit(const FVector2f& Point, const float HalfExtent) const
+{
+	int32 ClosestID = INDEX_NONE;
+	float ClosestDistanceSquared = TNumericLimits<float>::Max();
+
+	ForEachEntryInCells(GetCell(Point - FVector2f(HalfExtent)), GetCell(Point + FVector2f(HalfExtent)), [&](const FEntry& Entry)
+	{
+		const FVector2f Delta = Entry.Position - Point;
+		if (FMath::Abs(Delta.X) > HalfExtent || FMath::Abs(Delta.Y) > HalfExtent)
+		{
+			return;
+		}
+
+		const float DistanceSquared = Delta.SizeSquared();
+		if (DistanceSquared < ClosestDistanceSquared)
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestID = static_cast<int32>(Entry.ID);
+		}
+	});
+
+	return ClosestID;
+}
+
+void FCRRecoilUnitSpatialGrid::QueryBox(const FBox2f& Box, TArray<int32>& OutUnitIDs) const
+{
+	ForEachEntryInCells(GetCell(Box.Min), GetCell(Box.Max), [&Box, &OutUnitIDs](const FEntry& Entry)
+	{
+		if (Box.IsInsideOrOn(Entry.Position))
+		{
+			OutUnitIDs.Add(static_cast<int32>(Entry.ID));
+		}
+	});
+}
+
+FIntPoint FCRRecoilUnitSpatialGrid::GetCell(const FVector2f& Position) const
+{
+	return FIntPoint(FMath::FloorToInt32(Position.X / CellSize), FMath::FloorToInt32(Position.Y / CellSize));
+}
@@ -0,0 +1,27 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AnimGraphNode_SkeletalControlBase.h"
+#include "Animation/AnimNode_CRRecoilKick.h"
+#include "AnimGraphNode_CRRecoilKick.generated.h"
+
+UCLASS()
+class CRYSTALRECOILEDITOR_API UAnimGraphNode_CRRecoilKick : public UAnimGraphNode_SkeletalControlBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+
+	virtual FText GetTooltipText() const override;
+
+protected:
+	virtual FText GetControllerDescription() const override;
+
+	virtual const FAnimNode_SkeletalControlBase* GetNode() const override { return &Node; }
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FAnimNode_CRRecoilKick Node;
+};
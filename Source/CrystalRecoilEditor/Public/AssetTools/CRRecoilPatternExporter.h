@@ -0,0 +1,20 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Exporters/Exporter.h"
+#include "UObject/ObjectMacros.h"
+#include "CRRecoilPatternExporter.generated.h"
+
+// Exports recoil patterns to the interchange formats, the format is picked from the requested file extension
+UCLASS()
+class CRYSTALRECOILEDITOR_API UCRRecoilPatternExporter : public UExporter
+{
+	GENERATED_BODY()
+
+public:
+	UCRRecoilPatternExporter();
+
+	virtual bool ExportBinary(UObject* Object, const TCHAR* Type, FArchive& Ar, FFeedbackContext* Warn, int32 FileIndex = 0, uint32 PortFlags = 0) override;
+};
@@ -0,0 +1,27 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Factories/Factory.h"
+#include "UObject/ObjectMacros.h"
+#include "CRRecoilPatternImportFactory.generated.h"
+
+/**
+* Imports recoil patterns from the interchange formats (.crpattern, .json, .csv), see FCRRecoilPatternInterchange.
+* Importing a file over an existing pattern of the same name updates that asset in place, there is no tracked source file to reimport from.
+*/
+UCLASS(HideCategories = Object)
+class CRYSTALRECOILEDITOR_API UCRRecoilPatternImportFactory : public UFactory
+{
+	GENERATED_BODY()
+
+public:
+	UCRRecoilPatternImportFactory();
+
+	virtual bool FactoryCanImport(const FString& Filename) override;
+
+	virtual UObject* FactoryCreateBinary(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags, UObject* Context, const TCHAR* Type, const uint8*& Buffer, const uint8* BufferEnd, FFeedbackContext* Warn) override;
+
+	virtual FText GetToolTip() const override;
+};
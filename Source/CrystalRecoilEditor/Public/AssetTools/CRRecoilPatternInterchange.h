@@ -0,0 +1,110 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCRRecoilPattern;
+enum class ERecoilPatternEndBehavior : uint8;
+enum class ERecoilMotionModel : uint8;
+enum class ERecoilPatternIndexing : uint8;
+
+enum class ECRRecoilPatternInterchangeFormat : uint8
+{
+	// Compact versioned little-endian binary (.crpattern)
+	Binary,
+
+	// Human readable JSON (.json)
+	Json,
+
+	// Spreadsheet friendly "Key,Value" parameter rows followed by "X,Y" unit rows (.csv)
+	Csv
+};
+
+/**
+* Everything the interchange formats carry for one recoil pattern.
+* Files are parsed into this first, so a malformed file never leaves a half-imported asset behind.
+*/
+struct FCRRecoilPatternInterchangeData
+{
+	// Starts from the pattern's current values, so fields missing from a file keep what the asset already has
+	void ReadFromPattern(const UCRRecoilPattern& Pattern);
+
+	void ApplyToPattern(UCRRecoilPattern& Pattern) const;
+
+	ERecoilMotionModel MotionModel = {};
+	float SpringFrequency = 0.f;
+	float SpringDampingRatio = 0.f;
+	float UpliftSpeed = 0.f;
+	float RecoveryDelay = 0.f;
+	float InitialRecoverySpeed = 0.f;
+	float MaxRecoverySpeed = 0.f;
+	float RecoveryAcceleration = 0.f;
+	float RecoveryCancelThreshold = 0.f;
+	ERecoilPatternIndexing PatternIndexing = {};
+	float ReferenceFireInterval = 0.f;
+	ERecoilPatternEndBehavior PatternEndBehavior = {};
+	int32 CustomRecoilRestartIndex = 0;
+	FVector2f RandomXRange = FVector2f::ZeroVector;
+	FVector2f RandomYRange = FVector2f::ZeroVector;
+	TArray<FVector2f> UnitPositions;
+};
+
+/**
+* Reads and writes recoil patterns in the external interchange formats used by balancing tools.
+* Parsing works directly on the file bytes (no FString or ImportText round-trip), so batch imports stay cheap.
+*/
+class CRYSTALRECOILEDITOR_API FCRRecoilPatternInterchange
+{
+public:
+	// Written little-endian, so files start with the bytes "RCRP"
+	static constexpr uint32 BinaryMagic = 0x50524352;
+
+	// 2: adds MotionModel, SpringFrequency and SpringDampingRatio
+	// 3: adds PatternIndexing and ReferenceFireInterval
+	static constexpr uint16 BinaryVersion = 3;
+
+	// No flag bits are defined yet, files with any set are rejected
+	static constexpr uint16 BinaryKnownFlags = 0;
+
+	static constexpr int32 JsonVersion = 1;
+
+	// Written after CsvSignature as "v<N>"
+	static constexpr int32 CsvVersion = 1;
+
+	// Files written by Export start with this line, and CSV imports require it so generic spreadsheets aren't picked up by accident
+	static constexpr const ANSICHAR* CsvSignature = "# CrystalRecoil Pattern";
+
+	static TOptional<ECRRecoilPatternInterchangeFormat> FormatFromExtension(FStringView Extension);
+
+	static const TCHAR* GetExtension(const ECRRecoilPatternInterchangeFormat Format);
+
+	// Checks the leading bytes of a file for the signature of the given format
+	static bool HasSignature(const ECRRecoilPatternInterchangeFormat Format, TConstArrayView<uint8> LeadingBytes);
+
+	static bool Parse(const ECRRecoilPatternInterchangeFormat Format, TConstArrayView<uint8> Data, FCRRecoilPatternInterchangeData& InOutData, FString& OutError);
+
+	// Fails without writing anything when a value is NaN or infinite, JSON has no spelling for those and they would not parse back
+	static bool Write(const ECRRecoilPatternInterchangeFormat Format, const FCRRecoilPatternInterchangeData& Data, TArray<uint8>& OutBytes, FString& OutError);
+
+	// Parses Data and, on success, replaces the pattern's parameters and units
+	// Only calls Modify() on the pattern and its unit graph, so the import is undoable when the caller has a transaction open
+	static bool ImportIntoPattern(const ECRRecoilPatternInterchangeFormat Format, TConstArrayView<uint8> Data, UCRRecoilPattern& Pattern, FString& OutError);
+
+	static bool ExportPattern(const ECRRecoilPatternInterchangeFormat Format, const UCRRecoilPattern& Pattern, TArray<uint8>& OutBytes, FString& OutError);
+
+private:
+	static bool ParseBinary(TConstArrayView<uint8> Data, FCRRecoilPatternInterchangeData& InOutData, FString& OutError);
+
+	static bool ParseJson(TConstArrayView<uint8> Data, FCRRecoilPatternInterchangeData& InOutData, FString& OutError);
+
+	static bool ParseCsv(TConstArrayView<uint8> Data, FCRRecoilPatternInterchangeData& InOutData, FString& OutError);
+
+	static bool ValidateForWrite(const FCRRecoilPatternInterchangeData& Data, FString& OutError);
+
+	static void WriteBinary(const FCRRecoilPatternInterchangeData& Data, TArray<uint8>& OutBytes);
+
+	static void WriteJson(const FCRRecoilPatternInterchangeData& Data, TArray<uint8>& OutBytes);
+
+	static void WriteCsv(const FCRRecoilPatternInterchangeData& Data, TArray<uint8>& OutBytes);
+};
@@ -0,0 +1,29 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "UObject/ObjectMacros.h"
+#include "CRRecoilPatternCommandlet.generated.h"
+
+/**
+* Validates and bakes every recoil pattern asset, then writes a JSON report
+* The report also lists patterns that are identical copies of each other and the baked data memory shared between them at runtime
+* Returns a non-zero exit code if any pattern fails validation, so it can gate a cook
+*
+* Usage: UnrealEditor-Cmd <Project> -run=CRRecoilPattern [-Path=/Game/Weapons] [-Report=<File>] [-Save]
+*   -Path   Only scan patterns under this content path (default: everything)
+*   -Report Where to write the report (default: Saved/CrystalRecoil/RecoilPatternReport.json)
+*   -Save   Save patterns whose baked runtime data changed
+*/
+UCLASS()
+class CRYSTALRECOILEDITOR_API UCRRecoilPatternCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCRRecoilPatternCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,25 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "UObject/ObjectMacros.h"
+#include "CRRecoilPatternImportCommandlet.generated.h"
+
+/**
+* Batch imports every interchange file (.crpattern, .json, .csv) under a directory into recoil pattern assets.
+* Existing assets with the same name are updated in place.
+*
+* Usage: UnrealEditor-Cmd <Project> -run=CRRecoilPatternImport -Source=<Directory> -Dest=/Game/<Path>
+*/
+UCLASS()
+class CRYSTALRECOILEDITOR_API UCRRecoilPatternImportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCRRecoilPatternImportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
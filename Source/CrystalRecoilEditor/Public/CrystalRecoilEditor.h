@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogCrystalRecoilEditor, Log, All);
+
 class FCRAssetTypeActions_RecoilPattern;
 
 class FCrystalRecoilEditorModule : public IModuleInterface
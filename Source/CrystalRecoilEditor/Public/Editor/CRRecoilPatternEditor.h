@@ -11,6 +11,21 @@ class UCRRecoilPattern;
 class FCRRecoilUnitSelection
 {
 public:
+	/**
+	* Collects selection edits made while in scope into a single OnSelectionChanged broadcast
+	* Scopes nest, only the outermost one broadcasts, and only if the selection actually changed
+	*/
+	class FScopedBatch : public FNoncopyable
+	{
+	public:
+		explicit FScopedBatch(FCRRecoilUnitSelection& InSelection);
+
+		~FScopedBatch();
+
+	private:
+		FCRRecoilUnitSelection& Selection;
+	};
+
 	void AddSelection(const int32 UnitID);
 
 	void AddSelection(const TArray<int32>& UnitsArray);
@@ -19,6 +34,9 @@ public:
 
 	void RemoveSelection(const int32 UnitID);
 
+	// Replaces the whole selection, broadcasting once if it differs from the current one
+	void SetSelection(const TArray<int32>& UnitsArray);
+
 	void ClearSelection();
 
 	const TArray<int32>& GetSelection() const;
@@ -34,7 +52,19 @@ public:
 	FSimpleMulticastDelegate OnSelectionChanged;
 
 protected:
+	void AddSelectionInternal(const int32 UnitID);
+
+	void NotifySelectionChanged();
+
+	// Selection order, GetSelection()[0] is the unit shown in the details panel
 	TArray<int32> SelectedUnits;
+
+	// Mirrors SelectedUnits for constant time lookups while painting
+	TSet<int32> SelectedUnitSet;
+
+	int32 BatchDepth = 0;
+
+	bool bPendingSelectionChanged = false;
 };
 
 class CRYSTALRECOILEDITOR_API FCRRecoilPatternEditor : public FAssetEditorToolkit
@@ -90,6 +120,8 @@ public:
 
 	TSharedRef<SWidget> GetMenuContent_UnitsSnapping();
 
+	TSharedRef<SWidget> GetMenuContent_ZoomViewToFit();
+
 	void Command_RemoveUnit() const;
 
 	void Command_SelectAll();
@@ -118,6 +150,9 @@ public:
 
 	bool bEnableGridSnapping = true;
 
+	// Off by default, Zoom View to Fit then frames the units instantly like other editor viewports
+	bool bAnimateZoomToFit = false;
+
 	float GridSnappingValue = 0.1f;
 
 protected:
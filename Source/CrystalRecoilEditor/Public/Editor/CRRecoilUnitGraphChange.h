@@ -0,0 +1,52 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Change.h"
+#include "Data/CRRecoilUnitGraph.h"
+
+/**
+* Undo record for unit graph edits that stores only the units an edit touched, with their index and position before and after.
+* Modify() would snapshot the whole unit array instead, so undo memory and end-of-edit cost no longer grow with the pattern size.
+* Create it before editing, call RecordAfter once done, then StoreUndo inside a transaction.
+*/
+class CRYSTALRECOILEDITOR_API FCRRecoilUnitGraphChange : public FCommandChange
+{
+public:
+	/**
+	* Captures the touched units as they are before the edit
+	* bMayRearrange: the edit may re-sort units, if they aren't in rearrange order yet every unit is recorded since a full sort moves untouched units too
+	*/
+	FCRRecoilUnitGraphChange(const UCRRecoilUnitGraph& UnitGraph, TConstArrayView<uint32> InTouchedIDs, const bool bMayRearrange = false);
+
+	// Captures the touched units after the edit, AddedIDs are the units the edit created
+	void RecordAfter(const UCRRecoilUnitGraph& UnitGraph, TConstArrayView<uint32> AddedIDs = {});
+
+	bool HasChanges() const;
+
+	// Hands the change to the current transaction and dirties the package
+	static void StoreUndo(UCRRecoilUnitGraph& UnitGraph, TUniquePtr<FCRRecoilUnitGraphChange> Change);
+
+	// FCommandChange interface
+	virtual void Apply(UObject* Object) override;
+
+	virtual void Revert(UObject* Object) override;
+
+	virtual FString ToString() const override;
+	// End of FCommandChange interface
+
+private:
+	// Collects the existing units among IDs with their index, in index order
+	static void CaptureUnits(const UCRRecoilUnitGraph& UnitGraph, TConstArrayView<uint32> IDs, TArray<TPair<int32, FCRRecoilUnit>>& OutUnits);
+
+	TArray<uint32> TouchedIDs;
+
+	TArray<TPair<int32, FCRRecoilUnit>> BeforeUnits;
+
+	TArray<TPair<int32, FCRRecoilUnit>> AfterUnits;
+
+	uint32 BeforeNextID = 0;
+
+	uint32 AfterNextID = 0;
+};
@@ -5,11 +5,25 @@
 #include "CoreMinimal.h"
 #include "CRRecoilPatternEditor.h"
 #include "Data/CRRecoilUnitGraph.h"
+#include "Editor/CRRecoilUnitGraphChange.h"
 #include "Framework/DelayedDrag.h"
 
 class FCRRecoilUnitSelection;
 class UCRRecoilUnitGraph;
 
+/**
+* Indices of the selected units, in selection order, resolved once when a drag starts
+* Drags write positions through it on every mouse move, it is only resolved again if the graph's unit order changed
+*/
+struct FCRUnitGraphDragUnitIndices
+{
+	const TArray<int32>& Resolve(const UCRRecoilUnitGraph& UnitGraph, const FCRRecoilUnitSelection& UnitSelection);
+
+	TArray<int32> Indices;
+
+	TOptional<uint32> ResolvedOrderRevision;
+};
+
 class FCRUnitGraphViewDelayedDrag : public FDelayedDrag
 {
 public:
@@ -49,11 +63,17 @@ class FCRUnitGraphScaleUnitsDelayedDrag
 public:
 	FCRUnitGraphScaleUnitsDelayedDrag(UCRRecoilUnitGraph* UnitGraph, const FCRRecoilUnitSelection& UnitSelection, const FVector2f InInitialRecoilLocation, const FVector2f InInitialPosition, const FKey& InEffectiveKey);
 
+	FCRUnitGraphScaleUnitsDelayedDrag(FCRUnitGraphScaleUnitsDelayedDrag&&) = default;
+
+	// Stores the undo record, if the units changed
 	~FCRUnitGraphScaleUnitsDelayedDrag();
 
 	void ApplyScaling(const FCRRecoilUnitSelection& RecoilUnitSelection, float NewScale);
 
-	TArray<FCRRecoilUnit> CachedRecoilUnits;
+	FCRUnitGraphDragUnitIndices SelectedUnitIndices;
+
+	// Selected units as they were when the drag started, null once moved from
+	TUniquePtr<FCRRecoilUnitGraphChange> PendingChange;
 
 	UCRRecoilUnitGraph* CachedUnitGraph;
 
@@ -73,13 +93,19 @@ public:
 class FCRUnitGraphMoveUnitsDelayedDrag : public FDelayedDrag
 {
 public:
-	FCRUnitGraphMoveUnitsDelayedDrag(UCRRecoilUnitGraph* UnitGraph, const FCRRecoilUnitSelection& UnitSelection, const FVector2f InInitialRecoilLocation, const FVector2f InInitialPosition, const FKey& InEffectiveKey);
+	FCRUnitGraphMoveUnitsDelayedDrag(UCRRecoilUnitGraph* UnitGraph, const FCRRecoilUnitSelection& UnitSelection, const FVector2f InInitialRecoilLocation, const FVector2f InInitialPosition, const FKey& InEffectiveKey, const bool bAutoRearrange);
 
+	FCRUnitGraphMoveUnitsDelayedDrag(FCRUnitGraphMoveUnitsDelayedDrag&&) = default;
+
+	// Stores the undo record, if the units changed
 	~FCRUnitGraphMoveUnitsDelayedDrag();
 
-	void ApplyMovement(const FCRRecoilUnitSelection& UnitSelection, const FVector2f& Movement) const;
+	void ApplyMovement(const FCRRecoilUnitSelection& UnitSelection, const FVector2f& Movement);
+
+	FCRUnitGraphDragUnitIndices SelectedUnitIndices;
 
-	TArray<FCRRecoilUnit> CachedRecoilUnits;
+	// Selected units as they were when the drag started, null once moved from
+	TUniquePtr<FCRRecoilUnitGraphChange> PendingChange;
 
 	UCRRecoilUnitGraph* CachedUnitGraph;
 
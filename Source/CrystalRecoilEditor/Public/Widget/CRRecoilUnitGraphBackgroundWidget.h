@@ -29,6 +29,9 @@ struct FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer : public FZoomLevel
 
 	virtual int32 GetNearestZoomLevel(float ZoomAmount) const override;
 
+	// Returns the largest zoom level that doesn't zoom in past ZoomAmount, or the furthest zoomed out level
+	int32 GetFittingZoomLevel(float ZoomAmount) const;
+
 	virtual FText GetZoomText(int32 InZoomLevel) const override;
 
 	virtual int32 GetNumZoomLevels() const override;
@@ -57,6 +60,11 @@ public:
 
 	using SNodePanel::ChangeZoomLevel;
 
+	// Jumps straight to a zoom level without anchoring, unlike ChangeZoomLevel which steps around a location
+	void SetZoomLevel(int32 NewZoomLevel);
+
+	const FCRRecoilUnitGraphBackgroundWidgetZoomLevelsContainer& GetZoomLevels() const;
+
 	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
 
 	// Returns the view offset that is zoomed with zoom amount, and based in the center of the view
@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
+#include "Containers/LruCache.h"
 #include "Editor/CRRecoilUnitGraphWidgetDragOperations.h"
+#include "Widget/CRRecoilUnitSpatialGrid.h"
 #include "CRRecoilUnitGraphEditor.generated.h"
 
 class FCRRecoilUnitSelection;
@@ -67,13 +69,19 @@ public:
 	virtual FReply OnKeyUp(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
 	// End of SWidget interface
 
+	// Recomputes the origin and axis number placement, only when the view offset, zoom or size changed since the last paint
+	void UpdateOverlayLayout() const;
+
 	void DrawOrigin(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, const int32 BaseLayerID) const;
 
-	void DrawRecoilUnits(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, int32 BaseLayerID) const;
+	void DrawRecoilUnits(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, int32 BaseLayerID) const;
+
+	// Draw elements the last DrawRecoilUnits made, the value STAT_CRRecoilUnitDrawElements reports
+	int32 GetUnitDrawElementCount() const;
 
 	void DrawGridAxisNumbers(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, const int32 BaseLayerID) const;
 
-	void DrawSingleGridAxisNumber(const int32 GridLineNumber, const bool bXAxis, const FSlateFontInfo& NumberFontInfo, const TSharedRef<FSlateFontMeasure>& FontMeasure, const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 BaseLayerID) const;
+	void LayoutSingleGridAxisNumber(const int32 GridLineNumber, const bool bXAxis, const FSlateFontInfo& NumberFontInfo, const TSharedRef<FSlateFontMeasure>& FontMeasure) const;
 
 	void DrawSelectionBox(FSlateWindowElementList& OutDrawElements, const FGeometry& AllottedGeometry, const int32 BaseLayerID) const;
 
@@ -83,6 +91,9 @@ public:
 
 	void ZoomToFitAllUnits() const;
 
+	// Eases the view towards the ZoomToFitAllUnits framing, driven by an active timer
+	void AnimateZoomToFitAllUnits();
+
 	void CopySelectedUnits() const;
 
 	void PasteUnits() const;
@@ -108,8 +119,31 @@ protected:
 
 	void SelectUnitsInPanelCoordsRect(const FSlateRect& SelectionRect) const;
 
+	// Returns the spatial grid, rebuilding it first if the graph changed behind the widget's back
+	const FCRRecoilUnitSpatialGrid& GetSpatialGrid() const;
+
+	// Adds a unit to the graph and mirrors it into the spatial grid without a rebuild
+	// bKeepOrder inserts it at its rearrange policy position instead of appending it
+	uint32 AddUnitToGraph(UCRRecoilUnitGraph* UnitGraph, const FVector2f& RecoilLocation, const bool bKeepOrder = false) const;
+
+	// Mirrors the current positions of the selected units into the spatial grid, used while dragging
+	void UpdateSpatialGridForSelection() const;
+
+	bool IsAutoRearrangeEnabled() const;
+
+	// Restores unit order after a drag moved units around, when auto rearrange is enabled
 	void TryAutoRearrangeUnits() const;
 
+	// Finds the zoom level and graph space view center that frame all units, straight from their bounds
+	void ComputeZoomToFit(int32& OutZoomLevel, FVector2D& OutCenterGraph) const;
+
+	// Applies a zoom level and moves the view so CenterGraph is in the middle of it
+	void SetViewCenterAndZoomLevel(const FVector2D& CenterGraph, const int32 NewZoomLevel) const;
+
+	EActiveTimerReturnType TickZoomToFitAnimation(double InCurrentTime, float InDeltaTime);
+
+	void StopZoomToFitAnimation();
+
 	int32 ScaleFromRecoilCoordsToGraphCoords = 16;
 
 	TWeakObjectPtr<UCRRecoilUnitGraph> RecoilUnitGraph;
@@ -133,4 +167,72 @@ protected:
 	FVector2f CurrentMousePanelPosition;
 
 	mutable bool bNeedZoomToFit = false;
+
+	struct FCRZoomToFitAnimation
+	{
+		FVector2D StartCenterGraph;
+		FVector2D TargetCenterGraph;
+		float StartZoomAmount;
+		float TargetZoomAmount;
+		int32 TargetZoomLevel;
+		double StartTime;
+	};
+
+	TOptional<FCRZoomToFitAnimation> ZoomToFitAnimation;
+
+	TSharedPtr<FActiveTimerHandle> ZoomToFitTimerHandle;
+
+	mutable FCRRecoilUnitSpatialGrid SpatialGrid;
+
+	struct FCRCachedUnitNumber
+	{
+		FString Text;
+		FVector2f TextSize;
+	};
+
+	// Unit number strings and their measured size per shot index, only depends on the font
+	mutable TArray<FCRCachedUnitNumber> CachedUnitNumbers;
+
+	mutable FSlateFontInfo CachedUnitNumbersFontInfo;
+
+	// Paint scratch buffers, kept around to avoid per-frame allocations
+	mutable TArray<FVector2f> UnitPanelPositions;
+
+	mutable TSet<FIntPoint> OccupiedClusterCells;
+
+	mutable int32 UnitDrawElementCount = 0;
+
+	struct FCROverlayLayoutKey
+	{
+		FVector2D ViewOffset;
+		float Zoom;
+		FVector2D LocalSize;
+
+		bool operator==(const FCROverlayLayoutKey& Other) const
+		{
+			return ViewOffset == Other.ViewOffset && Zoom == Other.Zoom && LocalSize == Other.LocalSize;
+		}
+	};
+
+	struct FCRGridAxisLabelMetrics
+	{
+		FString Text;
+		FVector2f TextSize;
+	};
+
+	struct FCRGridAxisLabel
+	{
+		TSharedPtr<const FCRGridAxisLabelMetrics> Metrics;
+		FVector2f Position;
+		FLinearColor Color;
+	};
+
+	// Measured axis numbers keyed by (number, font hash), so panning back and forth doesn't re-measure
+	mutable TLruCache<TPair<int32, uint32>, TSharedPtr<const FCRGridAxisLabelMetrics>> AxisLabelCache;
+
+	mutable TArray<FCRGridAxisLabel> CachedAxisLabels;
+
+	mutable FVector2f CachedOriginPanelCoords = FVector2f::ZeroVector;
+
+	mutable TOptional<FCROverlayLayoutKey> CachedOverlayLayoutKey;
 };
@@ -0,0 +1,59 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCRRecoilUnitGraph;
+
+/**
+* Uniform grid over unit positions in recoil space, used by the graph widget for hit testing and marquee selection
+* Queries only convert the query shape into recoil space and visit the cells it overlaps, instead of projecting every unit to the panel
+* Kept in sync incrementally by the widget's own edits, and rebuilt when UCRRecoilUnitGraph::GetUnitsRevision says someone else touched the units
+*/
+class FCRRecoilUnitSpatialGrid
+{
+public:
+	void Rebuild(const UCRRecoilUnitGraph& UnitGraph);
+
+	void Reset();
+
+	bool IsSyncedWith(const UCRRecoilUnitGraph& UnitGraph) const;
+
+	// Marks the grid as up to date after the caller mirrored the graph changes with AddUnit / RemoveUnit / MoveUnit
+	void MarkSynced(const UCRRecoilUnitGraph& UnitGraph);
+
+	void AddUnit(const uint32 ID, const FVector2f& Position);
+
+	void RemoveUnit(const uint32 ID);
+
+	void MoveUnit(const uint32 ID, const FVector2f& NewPosition);
+
+	// Returns the ID of the unit closest to Point whose square of HalfExtent around its center contains Point, or INDEX_NONE
+	int32 FindClosestUnit(const FVector2f& Point, const float HalfExtent) const;
+
+	// Appends the IDs of all units whose center is inside Box
+	void QueryBox(const FBox2f& Box, TArray<int32>& OutUnitIDs) const;
+
+protected:
+	struct FEntry
+	{
+		uint32 ID;
+		FVector2f Position;
+	};
+
+	FIntPoint GetCell(const FVector2f& Position) const;
+
+	template <typename FunctionType>
+	void ForEachEntryInCells(const FIntPoint& MinCell, const FIntPoint& MaxCell, FunctionType&& Function) const;
+
+	TMap<FIntPoint, TArray<FEntry>> Cells;
+
+	TMap<uint32, FIntPoint> UnitCells;
+
+	float CellSize = 1.f;
+
+	TWeakObjectPtr<const UCRRecoilUnitGraph> SyncedGraph;
+
+	uint32 SyncedRevision = 0;
+};
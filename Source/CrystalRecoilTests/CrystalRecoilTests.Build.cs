@@ -0,0 +1,21 @@
+﻿using UnrealBuildTool;
+
+public class CrystalRecoilTests : ModuleRules
+{
+	public CrystalRecoilTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		// Automation tests and the helpers they share, editor only so test code never ships in the runtime modules
+		PublicDependencyModuleNames.AddRange([
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"CrystalRecoil"
+		]);
+
+		PrivateDependencyModuleNames.AddRange([
+			"CrystalRecoilCore"
+		]);
+	}
+}
@@ -0,0 +1,132 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Components/CRRecoilSpreadComponent.h"
+#include "Data/CRRecoilModifier.h"
+
+namespace CrystalRecoil::Tests
+{
+	constexpr float AllocationTestFrameTime = 1.f / 60.f;
+
+	// Enough shots to run past the end of both patterns, so the end behaviors are measured too
+	constexpr int32 AllocationTestShotCount = 40;
+	constexpr int32 AllocationTestFramesPerShot = 6;
+	constexpr int32 AllocationTestRecoveryFrames = 300;
+
+	static FRuntimeFloatCurve MakeConstantCurve(const float Value)
+	{
+		FRuntimeFloatCurve Curve;
+		Curve.GetRichCurve()->AddKey(0.f, Value);
+		return Curve;
+	}
+
+	struct FCRScriptedBurstResult
+	{
+		float PeakPitchOffset = 0.f;
+		float PeakHeat = 0.f;
+	};
+
+	/**
+	* One scripted burst followed by recovery and heat cooldown
+	* Mixes whole shots, partial shots and direct pattern reads, and records a rollback snapshot every frame
+	*/
+	static FCRScriptedBurstResult RunScriptedBurst(FCRRecoilTestWorld& TestWorld, UCRRecoilSpreadComponent* SpreadComponent, const UCRRecoilPattern* Pattern, int32& Frame)
+	{
+		// The spread overrides are protected, shots go through the base class like gameplay code does
+		UCRRecoilComponent* Component = SpreadComponent;
+		const float StartPitch = TestWorld.GetPlayerController()->GetControlRotation().Pitch;
+
+		FCRScriptedBurstResult Result;
+		FCRRecoilRandomStream RandomStream(7);
+		int32 PatternShotIndex = 0;
+
+		const auto TickFrame = [&]()
+		{
+			TestWorld.Tick(Component, AllocationTestFrameTime);
+			Component->RecordStateSnapshot(Frame++);
+
+			const float PitchOffset = FRotator::NormalizeAxis(TestWorld.GetPlayerController()->GetControlRotation().Pitch - StartPitch);
+			Result.PeakPitchOffset = FMath::Max(Result.PeakPitchOffset, FMath::Abs(PitchOffset));
+			Result.PeakHeat = FMath::Max(Result.PeakHeat, SpreadComponent->GetRecoilHeat());
+		};
+
+		Component->StartShooting();
+		for (int32 ShotIndex = 0; ShotIndex < AllocationTestShotCount; ++ShotIndex)
+		{
+			if (ShotIndex % 4 == 3)
+			{
+				Component->ApplyShotAdvance(0.5f);
+			}
+			else
+			{
+				Component->ApplyShot();
+			}
+			Pattern->ConsumeShot(PatternShotIndex, RandomStream);
+
+			for (int32 FrameIndex = 0; FrameIndex < AllocationTestFramesPerShot; ++FrameIndex)
+			{
+				TickFrame();
+			}
+		}
+
+		for (int32 FrameIndex = 0; FrameIndex < AllocationTestRecoveryFrames; ++FrameIndex)
+		{
+			TickFrame();
+		}
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilSteadyStateAllocationTest, "CrystalRecoil.Runtime.SteadyStateAllocations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilSteadyStateAllocationTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	FCRRecoilTestWorld TestWorld;
+
+	UCRRecoilPattern* Pattern = MakeTestPattern(24);
+	UCRRecoilPattern* BlendedPattern = MakeTestPattern(16, 0.8f);
+	BlendedPattern->PatternEndBehavior = ERecoilPatternEndBehavior::Random;
+
+	UCRRecoilSpreadComponent* Component = TestWorld.SpawnRecoilComponent<UCRRecoilSpreadComponent>(Pattern, [](UCRRecoilSpreadComponent& SpreadComponent)
+	{
+		SetPropertyValue(&SpreadComponent, TEXT("StateHistorySize"), 32);
+		SetPropertyValue(&SpreadComponent, TEXT("ShotToHeatCurve"), MakeConstantCurve(5.f));
+		SetPropertyValue(&SpreadComponent, TEXT("HeatToSpreadAngleCurve"), MakeConstantCurve(1.f));
+		SetPropertyValue(&SpreadComponent, TEXT("HeatToCooldownPerSecondCurve"), MakeConstantCurve(50.f));
+	});
+
+	FCRRecoilModifier Modifier;
+	Modifier.AxisScale = FVector2D(0.8, 1.2);
+	Modifier.Rotation = 5.f;
+	Modifier.HeatMultiplier = 1.5f;
+	Component->AddRecoilModifier(Modifier);
+	Component->SetPatternBlendWeight(BlendedPattern, 0.5f);
+
+	// The first burst may still grow engine containers (tick function sets, delegate lists), only the second one is measured
+	int32 Frame = 0;
+	RunScriptedBurst(TestWorld, Component, Pattern, Frame);
+
+	FCRScriptedBurstResult Result;
+	int32 AllocationCount = 0;
+	{
+		FCRScopedAllocationCounter AllocationCounter;
+		Result = RunScriptedBurst(TestWorld, Component, Pattern, Frame);
+		AllocationCount = AllocationCounter.GetAllocationCount();
+	}
+
+	TestEqual(TEXT("Heap allocations during a steady-state burst"), AllocationCount, 0);
+
+	// Guards against the script silently doing nothing (e.g. no local controller), which would also allocate nothing
+	TestTrue(TEXT("The burst moved the aim"), Result.PeakPitchOffset > 1.f);
+	TestTrue(TEXT("The burst added heat"), Result.PeakHeat > 0.f);
+	TestEqual(TEXT("Heat cooled down after the burst"), Component->GetRecoilHeat(), 0.f);
+	return true;
+}
+
+#endif
@@ -0,0 +1,81 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Data/CRRecoilPatternBakedData.h"
+
+namespace CrystalRecoil::Tests
+{
+	constexpr int32 BakedDataTestShotCount = 30;
+
+	// The deltas BakeRuntimeData produces, editor builds read them from the live graph
+	static TArray<FVector2f> GetShotDeltas(const UCRRecoilPattern& Pattern)
+	{
+		TArray<FVector2f> ShotDeltas;
+		for (int32 ShotIndex = 0; ShotIndex <= Pattern.GetMaxShotIndex(); ++ShotIndex)
+		{
+			ShotDeltas.Add(Pattern.GetShotDelta(ShotIndex));
+		}
+		return ShotDeltas;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilSharedBakedDataTest, "CrystalRecoil.Runtime.SharedBakedData", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilSharedBakedDataTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	FCRRecoilPatternBakedDataRegistry& Registry = FCRRecoilPatternBakedDataRegistry::Get();
+	const SIZE_T MemorySavedBefore = Registry.GetMemorySaved();
+
+	// Two copies of one pattern (e.g. two weapon skins) and a different one
+	UCRRecoilPattern* Pattern = MakeTestPattern(BakedDataTestShotCount);
+	UCRRecoilPattern* PatternCopy = MakeTestPattern(BakedDataTestShotCount);
+	UCRRecoilPattern* OtherPattern = MakeTestPattern(BakedDataTestShotCount, 0.8f);
+	const TArray<FVector2f> ShotDeltas = GetShotDeltas(*Pattern);
+	const TArray<FVector2f> OtherShotDeltas = GetShotDeltas(*OtherPattern);
+
+	// What cooked builds do on load
+	Pattern->ShareBakedData();
+	PatternCopy->ShareBakedData();
+	OtherPattern->ShareBakedData();
+
+	TestTrue(TEXT("Identical patterns share one baked data"), Pattern->SharesBakedDataWith(*PatternCopy));
+	TestFalse(TEXT("Different patterns don't share baked data"), Pattern->SharesBakedDataWith(*OtherPattern));
+	TestEqual(TEXT("Sharing saves one copy of the baked data"), Registry.GetMemorySaved() - MemorySavedBefore, Pattern->GetBakedDataSize());
+	TestTrue(TEXT("The pattern reads its deltas from the shared data"), Pattern->GetBakedDataSize() > 0);
+
+	// A hash collision: same units hash, different deltas
+	const uint64 UnitsHash = Pattern->ComputeUnitsHash();
+	TSharedPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe> Colliding = Registry.Intern(UnitsHash, TArray<FVector2f>(OtherShotDeltas));
+	TSharedPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe> Matching = Registry.Intern(UnitsHash, TArray<FVector2f>(ShotDeltas));
+
+	TestTrue(TEXT("A colliding hash gets its own copy"), Colliding != Matching);
+	TestTrue(TEXT("The colliding copy holds its own deltas"), Colliding->ShotDeltas == OtherShotDeltas);
+	TestTrue(TEXT("The collision doesn't replace the shared entry"), Matching->ShotDeltas == ShotDeltas);
+	TestEqual(TEXT("Only the matching intern counts as saved memory"), Registry.GetMemorySaved() - MemorySavedBefore, 2 * Pattern->GetBakedDataSize());
+
+	Registry.Release(Colliding);
+	Registry.Release(Matching);
+	TestFalse(TEXT("Release resets the pointer"), Colliding.IsValid() || Matching.IsValid());
+
+	// What garbage collection does, the last release also drops the registry entry
+	for (UCRRecoilPattern* DestroyedPattern : { Pattern, PatternCopy, OtherPattern })
+	{
+		DestroyedPattern->MarkAsGarbage();
+		DestroyedPattern->ConditionalBeginDestroy();
+	}
+	TestEqual(TEXT("Saved memory returns to where it was once the patterns are gone"), Registry.GetMemorySaved(), MemorySavedBefore);
+
+	// Nothing is left to share with, so this becomes the new entry
+	TSharedPtr<const FCRRecoilPatternBakedData, ESPMode::ThreadSafe> Reinterned = Registry.Intern(UnitsHash, TArray<FVector2f>(OtherShotDeltas));
+	TestEqual(TEXT("A new entry saves nothing"), Registry.GetMemorySaved(), MemorySavedBefore);
+	Registry.Release(Reinterned);
+	return true;
+}
+
+#endif
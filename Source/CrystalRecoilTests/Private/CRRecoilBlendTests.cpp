@@ -0,0 +1,53 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+namespace CrystalRecoil::Tests
+{
+	static UCRRecoilPattern* MakeTimeIndexedTestPattern(const int32 ShotCount)
+	{
+		UCRRecoilPattern* Pattern = MakeTestPattern(ShotCount);
+		Pattern->PatternIndexing = ERecoilPatternIndexing::FiringTime;
+		Pattern->ReferenceFireInterval = 0.1f;
+		return Pattern;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilMixedIndexingBlendTest, "CrystalRecoil.Runtime.MixedIndexingBlend", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilMixedIndexingBlendTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	FCRRecoilTestWorld TestWorld;
+
+	UCRRecoilPattern* ShotIndexedPattern = MakeTestPattern(12);
+	UCRRecoilPattern* ShotIndexedVariant = MakeTestPattern(12, 0.8f);
+	UCRRecoilPattern* TimeIndexedPattern = MakeTimeIndexedTestPattern(12);
+	UCRRecoilPattern* TimeIndexedVariant = MakeTimeIndexedTestPattern(16);
+
+	UCRRecoilComponent* Component = TestWorld.SpawnRecoilComponent(ShotIndexedPattern);
+
+	Component->SetPatternBlendWeight(ShotIndexedVariant, 1.f, true);
+	TestEqual(TEXT("A pattern with the same indexing blends in"), Component->GetPatternBlendWeight(ShotIndexedVariant), 1.f);
+
+	AddExpectedError(TEXT("shot and time indexed patterns don't mix"), EAutomationExpectedErrorFlags::Contains, 1);
+	Component->SetPatternBlendWeight(TimeIndexedVariant, 1.f, true);
+	TestEqual(TEXT("A time indexed pattern is not blended into a shot indexed one"), Component->GetPatternBlendWeight(TimeIndexedVariant), 0.f);
+
+	// Switching the recoil pattern's indexing drops the blends that no longer match, matching ones stay
+	AddExpectedError(TEXT("its indexing doesn't match the new recoil pattern"), EAutomationExpectedErrorFlags::Contains, 1);
+	Component->SetRecoilPattern(TimeIndexedPattern);
+	TestEqual(TEXT("The shot indexed blend is dropped"), Component->GetPatternBlendWeight(ShotIndexedVariant), 0.f);
+
+	Component->SetPatternBlendWeight(TimeIndexedVariant, 0.5f, true);
+	Component->SetRecoilPattern(MakeTimeIndexedTestPattern(8));
+	TestEqual(TEXT("A blend with matching indexing survives a pattern switch"), Component->GetPatternBlendWeight(TimeIndexedVariant), 0.5f);
+	return true;
+}
+
+#endif
@@ -0,0 +1,79 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CRRecoilMotion.h"
+#include "Data/CRRecoilModifier.h"
+#include "Misc/AutomationTest.h"
+
+namespace CrystalRecoil::Tests
+{
+	static FCRRecoilModifier MakeShotModifier(const FVector2D& AxisScale, const float Rotation, const float MaxShotRecoil = 0.f)
+	{
+		FCRRecoilModifier Modifier;
+		Modifier.AxisScale = AxisScale;
+		Modifier.Rotation = Rotation;
+		Modifier.MaxShotRecoil = MaxShotRecoil;
+		return Modifier;
+	}
+
+	static FVector2f ApplyStack(TConstArrayView<FCRRecoilModifier> Modifiers, const FVector2f& ShotDelta)
+	{
+		FCRCompiledRecoilModifiers Compiled;
+		Compiled.Compile(Modifiers);
+		return Compiled.ApplyToShotDelta(ShotDelta);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilModifierStackTest, "CrystalRecoil.Runtime.ModifierStack", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilModifierStackTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	constexpr float Tolerance = 1.e-5f;
+	const FVector2f ShotDelta(1.f, 0.f);
+
+	FCRCompiledRecoilModifiers Compiled;
+	Compiled.Compile({});
+	TestTrue(TEXT("An empty stack is the identity"), Compiled.bIdentity);
+	Compiled.Compile({ FCRRecoilModifier() });
+	TestTrue(TEXT("A neutral modifier is the identity"), Compiled.bIdentity);
+
+	// Scale then rotate: (1, 0) -> (2, 0) -> (0, 2). Rotate then scale: (1, 0) -> (0, 1) -> (0, 1)
+	const FCRRecoilModifier DoubleHorizontal = MakeShotModifier(FVector2D(2.0, 1.0), 0.f);
+	const FCRRecoilModifier QuarterTurn = MakeShotModifier(FVector2D::UnitVector, 90.f);
+	TestTrue(TEXT("Each modifier transforms the output of the previous one"), ApplyStack({ DoubleHorizontal, QuarterTurn }, ShotDelta).Equals(FVector2f(0.f, 2.f), Tolerance));
+	TestTrue(TEXT("Reordering the stack changes the result"), ApplyStack({ QuarterTurn, DoubleHorizontal }, ShotDelta).Equals(FVector2f(0.f, 1.f), Tolerance));
+
+	// A cap of 2 ahead of a 3x scale still caps the final shot, it isn't scaled past the cap by later modifiers
+	const FCRRecoilModifier CapTwo = MakeShotModifier(FVector2D::UnitVector, 0.f, 2.f);
+	const FCRRecoilModifier CapFive = MakeShotModifier(FVector2D::UnitVector, 0.f, 5.f);
+	const FCRRecoilModifier TripleBoth = MakeShotModifier(FVector2D(3.0, 3.0), 0.f);
+	TestTrue(TEXT("The cap applies after the whole stack"), ApplyStack({ CapTwo, TripleBoth }, ShotDelta).Equals(FVector2f(2.f, 0.f), Tolerance));
+	TestTrue(TEXT("The cap applies after the whole stack when it comes last"), ApplyStack({ TripleBoth, CapTwo }, ShotDelta).Equals(FVector2f(2.f, 0.f), Tolerance));
+	TestTrue(TEXT("The smallest cap wins"), ApplyStack({ CapTwo, CapFive, TripleBoth }, ShotDelta).Equals(FVector2f(2.f, 0.f), Tolerance));
+	TestTrue(TEXT("The smallest cap wins in any order"), ApplyStack({ CapFive, TripleBoth, CapTwo }, ShotDelta).Equals(FVector2f(2.f, 0.f), Tolerance));
+	TestTrue(TEXT("Shots under the cap are left alone"), ApplyStack({ CapFive, TripleBoth }, ShotDelta).Equals(FVector2f(3.f, 0.f), Tolerance));
+
+	FCRRecoilModifier FastUplift;
+	FastUplift.UpliftSpeedMultiplier = 2.f;
+	FastUplift.RecoveryMultiplier = 0.5f;
+	FCRRecoilModifier SlowRecovery;
+	SlowRecovery.RecoveryMultiplier = 0.5f;
+
+	Compiled.Compile({ FastUplift, SlowRecovery });
+	TestFalse(TEXT("Parameter multipliers alone make the stack non-identity"), Compiled.bIdentity);
+	TestTrue(TEXT("Parameter-only modifiers leave the shot alone"), Compiled.ApplyToShotDelta(ShotDelta).Equals(ShotDelta, Tolerance));
+
+	FCRRecoilMotionSettings Settings;
+	const FCRRecoilMotionSettings DefaultSettings;
+	Compiled.ApplyToMotionSettings(Settings);
+	TestEqual(TEXT("Uplift speed multipliers multiply"), Settings.UpliftSpeedMultiplier, DefaultSettings.UpliftSpeedMultiplier * 2.f, Tolerance);
+	TestEqual(TEXT("Recovery multipliers multiply"), Settings.InitialRecoverySpeed, DefaultSettings.InitialRecoverySpeed * 0.25f, Tolerance);
+	return true;
+}
+
+#endif
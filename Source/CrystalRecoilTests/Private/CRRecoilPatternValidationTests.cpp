@@ -0,0 +1,93 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include <limits>
+
+namespace CrystalRecoil::Tests
+{
+	constexpr int32 ValidationTestShotCount = 5;
+
+	// Validates Pattern and returns its errors, checking the return value agrees with them
+	static TArray<FString> ValidateTestPattern(FAutomationTestBase& Test, const UCRRecoilPattern& Pattern)
+	{
+		TArray<FString> Errors;
+		const bool bValid = Pattern.ValidatePattern(Errors);
+		Test.TestEqual(TEXT("ValidatePattern returns true exactly when it reports no errors"), bValid, Errors.IsEmpty());
+		return Errors;
+	}
+
+	static bool HasErrorContaining(TConstArrayView<FString> Errors, const TCHAR* Text)
+	{
+		return Errors.ContainsByPredicate([Text](const FString& Error) { return Error.Contains(Text); });
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilPatternValidationTest, "CrystalRecoil.Runtime.PatternValidation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilPatternValidationTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	UCRRecoilPattern* Pattern = MakeTestPattern(ValidationTestShotCount);
+	TestTrue(TEXT("A plain pattern is valid"), ValidateTestPattern(*this, *Pattern).IsEmpty());
+
+	TArray<FString> Errors = { TEXT("Earlier error") };
+	TestTrue(TEXT("Errors from earlier checks don't fail a valid pattern"), Pattern->ValidatePattern(Errors));
+	TestEqual(TEXT("Errors are appended, not replaced"), Errors.Num(), 1);
+
+	TestTrue(TEXT("A pattern without units is invalid"), HasErrorContaining(ValidateTestPattern(*this, *MakeTestPattern(0)), TEXT("no recoil units")));
+
+	// Restart index, only checked when the pattern actually restarts from it
+	Pattern->CustomRecoilRestartIndex = ValidationTestShotCount;
+	TestTrue(TEXT("An out of range restart index is ignored by other end behaviors"), ValidateTestPattern(*this, *Pattern).IsEmpty());
+
+	Pattern->PatternEndBehavior = ERecoilPatternEndBehavior::RestartFromCustomIndex;
+	TestTrue(TEXT("A restart index past the last shot is reported"), HasErrorContaining(ValidateTestPattern(*this, *Pattern), TEXT("CustomRecoilRestartIndex")));
+	Pattern->CustomRecoilRestartIndex = -1;
+	TestTrue(TEXT("A negative restart index is reported"), HasErrorContaining(ValidateTestPattern(*this, *Pattern), TEXT("CustomRecoilRestartIndex")));
+	Pattern->CustomRecoilRestartIndex = Pattern->GetMaxShotIndex();
+	TestTrue(TEXT("Restarting from the last shot is valid"), ValidateTestPattern(*this, *Pattern).IsEmpty());
+	Pattern->CustomRecoilRestartIndex = 0;
+	TestTrue(TEXT("Restarting from the first shot is valid"), ValidateTestPattern(*this, *Pattern).IsEmpty());
+
+	// Duplicate IDs, e.g. from a hand edited array before PostEditChangeProperty repaired it
+	UCRRecoilPattern* DuplicatePattern = MakeTestPattern(ValidationTestShotCount);
+	TArray<FCRRecoilUnit>& DuplicateUnits = DuplicatePattern->GetUnitGraph()->GetRecoilUnits();
+	DuplicateUnits[3].ID = DuplicateUnits[1].ID;
+	const TArray<FString> DuplicateErrors = ValidateTestPattern(*this, *DuplicatePattern);
+	TestEqual(TEXT("One duplicate ID is reported once"), DuplicateErrors.Num(), 1);
+	TestTrue(TEXT("The duplicate is reported at its second occurrence"), HasErrorContaining(DuplicateErrors, TEXT("Unit 3 has duplicate ID")));
+
+	// Non-finite positions
+	UCRRecoilPattern* NaNPattern = MakeTestPattern(ValidationTestShotCount);
+	NaNPattern->GetUnitGraph()->GetRecoilUnits()[2].Position.X = std::numeric_limits<float>::quiet_NaN();
+	NaNPattern->GetUnitGraph()->GetRecoilUnits()[4].Position.Y = std::numeric_limits<float>::infinity();
+	const TArray<FString> NaNErrors = ValidateTestPattern(*this, *NaNPattern);
+	TestTrue(TEXT("A NaN position is reported"), HasErrorContaining(NaNErrors, TEXT("Unit 2 has a non-finite position")));
+	TestTrue(TEXT("An infinite position is reported"), HasErrorContaining(NaNErrors, TEXT("Unit 4 has a non-finite position")));
+
+	// Random ranges
+	UCRRecoilPattern* RangePattern = MakeTestPattern(ValidationTestShotCount);
+	RangePattern->RandomizedRecoil.RandomXRange = FVector2D(1.0, 1.0);
+	RangePattern->RandomizedRecoil.RandomYRange = FVector2D(-1.0, 2.0);
+	TestTrue(TEXT("Equal or ordered random ranges are valid"), ValidateTestPattern(*this, *RangePattern).IsEmpty());
+
+	RangePattern->RandomizedRecoil.RandomXRange = FVector2D(2.0, 1.0);
+	RangePattern->RandomizedRecoil.RandomYRange = FVector2D(3.0, -3.0);
+	const TArray<FString> RangeErrors = ValidateTestPattern(*this, *RangePattern);
+	TestTrue(TEXT("A random X range with min > max is reported"), HasErrorContaining(RangeErrors, TEXT("RandomXRange min")));
+	TestTrue(TEXT("A random Y range with min > max is reported"), HasErrorContaining(RangeErrors, TEXT("RandomYRange min")));
+
+	// Time indexed patterns need a positive reference fire interval
+	UCRRecoilPattern* TimeIndexedPattern = MakeTestPattern(ValidationTestShotCount);
+	TimeIndexedPattern->PatternIndexing = ERecoilPatternIndexing::FiringTime;
+	TimeIndexedPattern->ReferenceFireInterval = 0.f;
+	TestTrue(TEXT("A time indexed pattern without a fire interval is reported"), HasErrorContaining(ValidateTestPattern(*this, *TimeIndexedPattern), TEXT("ReferenceFireInterval")));
+	return true;
+}
+
+#endif
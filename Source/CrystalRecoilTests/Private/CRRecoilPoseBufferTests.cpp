@@ -0,0 +1,83 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Animation/CRRecoilPoseBuffer.h"
+#include "Async/Async.h"
+#include "Misc/AutomationTest.h"
+#include <atomic>
+
+namespace CrystalRecoil::Tests
+{
+	constexpr uint32 PoseBufferTestPublishCount = 200000;
+
+	// Every field derives from the shot count, so a read mixing two publishes is detectable
+	static FCRRecoilPoseOutput MakePoseOutput(const uint32 ShotCount)
+	{
+		FCRRecoilPoseOutput Output;
+		Output.ShotCount = ShotCount;
+		Output.Kick = FVector2f(static_cast<float>(ShotCount), -static_cast<float>(ShotCount));
+		return Output;
+	}
+
+	static bool IsConsistent(const FCRRecoilPoseOutput& Output)
+	{
+		return Output.Kick.X == static_cast<float>(Output.ShotCount) && Output.Kick.Y == -static_cast<float>(Output.ShotCount);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilPoseBufferTest, "CrystalRecoil.Runtime.PoseBuffer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilPoseBufferTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	FCRRecoilPoseBuffer PoseBuffer;
+	TestEqual(TEXT("A fresh buffer reads no shots"), PoseBuffer.Read().ShotCount, 0u);
+	TestTrue(TEXT("A fresh buffer reads no kick"), PoseBuffer.Read().Kick.IsZero());
+
+	// Consecutive publishes land in alternating slots, each read must see the latest one
+	for (uint32 ShotCount = 1; ShotCount <= 3; ++ShotCount)
+	{
+		PoseBuffer.Publish(MakePoseOutput(ShotCount));
+		const FCRRecoilPoseOutput Output = PoseBuffer.Read();
+		TestEqual(TEXT("A read returns the latest publish"), Output.ShotCount, ShotCount);
+		TestTrue(TEXT("A read returns the whole latest publish"), IsConsistent(Output));
+	}
+
+	// Publish as fast as possible while a worker reads, so reads overlap publishes into their slot and have to retry
+	std::atomic<bool> bPublishing = true;
+	TFuture<FString> ReaderResult = Async(EAsyncExecution::Thread, [&PoseBuffer, &bPublishing]() -> FString
+	{
+		uint32 LastShotCount = 0;
+		while (bPublishing.load(std::memory_order_relaxed))
+		{
+			const FCRRecoilPoseOutput Output = PoseBuffer.Read();
+			if (!IsConsistent(Output))
+			{
+				return FString::Printf(TEXT("Torn read: shot %u with kick (%f, %f)"), Output.ShotCount, Output.Kick.X, Output.Kick.Y);
+			}
+			if (Output.ShotCount < LastShotCount)
+			{
+				return FString::Printf(TEXT("Read went back from shot %u to %u"), LastShotCount, Output.ShotCount);
+			}
+			LastShotCount = Output.ShotCount;
+		}
+		return FString();
+	});
+
+	for (uint32 ShotCount = 4; ShotCount <= PoseBufferTestPublishCount; ++ShotCount)
+	{
+		PoseBuffer.Publish(MakePoseOutput(ShotCount));
+	}
+	bPublishing.store(false, std::memory_order_relaxed);
+
+	const FString ReaderError = ReaderResult.Get();
+	TestTrue(FString::Printf(TEXT("Concurrent reads are never torn or out of order%s%s"), ReaderError.IsEmpty() ? TEXT("") : TEXT(": "), *ReaderError), ReaderError.IsEmpty());
+	TestEqual(TEXT("The last publish is read after the writer stops"), PoseBuffer.Read().ShotCount, PoseBufferTestPublishCount);
+	return true;
+}
+
+#endif
@@ -0,0 +1,96 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+namespace CrystalRecoil::Tests
+{
+	constexpr float RollbackTestFrameTime = 1.f / 60.f;
+	constexpr int32 RollbackTestFrameCount = 120;
+	constexpr int32 RollbackTestFramesPerShot = 4;
+
+	// Past the end of the pattern, so the late shots come from the Random end behavior
+	constexpr int32 RollbackTestShotFrames = 80;
+	constexpr int32 RollbackTestRestoreFrame = 30;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilRollbackReplayTest, "CrystalRecoil.Runtime.RollbackReplay", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilRollbackReplayTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	FCRRecoilTestWorld TestWorld;
+	APlayerController* PlayerController = TestWorld.GetPlayerController();
+
+	UCRRecoilPattern* Pattern = MakeTestPattern(6);
+	Pattern->PatternEndBehavior = ERecoilPatternEndBehavior::Random;
+	UCRRecoilPattern* BlendedPattern = MakeTestPattern(6, 0.8f);
+	BlendedPattern->PatternEndBehavior = ERecoilPatternEndBehavior::Random;
+
+	UCRRecoilComponent* Component = TestWorld.SpawnRecoilComponent(Pattern, [](UCRRecoilComponent& RecoilComponent)
+	{
+		SetPropertyValue(&RecoilComponent, TEXT("StateHistorySize"), RollbackTestFrameCount);
+		SetPropertyValue(&RecoilComponent, TEXT("PatternBlendSpeed"), 1.f);
+	});
+
+	FCRRecoilModifier Modifier;
+	Modifier.AxisScale = FVector2D(1.5, 0.7);
+	Modifier.Rotation = 10.f;
+	const int32 ModifierHandle = Component->AddRecoilModifier(Modifier);
+
+	// Still easing in when the rollback frame is recorded
+	Component->SetPatternBlendWeight(BlendedPattern, 0.6f);
+
+	const double StartTime = TestWorld.GetWorld()->GetTimeSeconds();
+	const auto RunFrame = [&](const int32 Frame)
+	{
+		TestWorld.GetWorld()->TimeSeconds = StartTime + (Frame + 1) * RollbackTestFrameTime;
+		if (Frame < RollbackTestShotFrames && Frame % RollbackTestFramesPerShot == 0)
+		{
+			Component->ApplyShot();
+		}
+		FCRRecoilTestWorld::TickAtCurrentTime(*Component, RollbackTestFrameTime);
+		Component->RecordStateSnapshot(Frame);
+		return PlayerController->GetControlRotation();
+	};
+
+	PlayerController->SetControlRotation(FRotator::ZeroRotator);
+	Component->StartShooting();
+
+	TArray<FRotator> RecordedAim;
+	for (int32 Frame = 0; Frame < RollbackTestFrameCount; ++Frame)
+	{
+		RecordedAim.Add(RunFrame(Frame));
+	}
+
+	// Gameplay changes after the rolled back frame, which the snapshot has to undo for the replay
+	Component->RemoveRecoilModifier(ModifierHandle);
+	Component->ClearPatternBlend();
+	Component->SetRandomSeed(1234);
+
+	TestTrue(TEXT("The rollback frame is in the history"), Component->RestoreStateSnapshot(RollbackTestRestoreFrame));
+	PlayerController->SetControlRotation(RecordedAim[RollbackTestRestoreFrame]);
+	TestTrue(TEXT("The cleared blend is restored"), Component->GetPatternBlendWeight(BlendedPattern) > 0.f);
+
+	double PeakPitchOffset = 0.0;
+	for (int32 Frame = RollbackTestRestoreFrame + 1; Frame < RollbackTestFrameCount; ++Frame)
+	{
+		const FRotator ReplayedAim = RunFrame(Frame);
+		PeakPitchOffset = FMath::Max(PeakPitchOffset, FMath::Abs(FRotator::NormalizeAxis(ReplayedAim.Pitch - RecordedAim[RollbackTestRestoreFrame].Pitch)));
+		if (!ReplayedAim.Equals(RecordedAim[Frame], 1e-4f))
+		{
+			AddError(FString::Printf(TEXT("Replay differs at frame %d, recorded %s, replayed %s"), Frame, *RecordedAim[Frame].ToCompactString(), *ReplayedAim.ToCompactString()));
+			break;
+		}
+	}
+
+	// A replay that never moved the aim would match trivially
+	TestTrue(TEXT("The replayed frames kicked the aim"), PeakPitchOffset > 1.0);
+	return true;
+}
+
+#endif
@@ -0,0 +1,151 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Components/CRRecoilSpreadComponent.h"
+#include "Subsystems/CRRecoilTickSubsystem.h"
+
+namespace CrystalRecoil::Tests
+{
+	constexpr float SignificanceTestFrameTime = 1.f / 60.f;
+	constexpr int32 SignificanceTestFrameCount = 120;
+
+	// Not a multiple of the 6 frame throttle interval, so shots land at every point between two throttled updates
+	constexpr int32 SignificanceTestFramesPerShot = 7;
+	constexpr int32 SignificanceTestShotFrames = 90;
+	constexpr int32 SignificanceTestFlushFrame = 40;
+
+	// Long enough for the heat to cool down and the aim to recover, so every shooter's tick turns itself off
+	constexpr int32 SignificanceTestSettleFrames = 600;
+
+	// Constant curves make the heat cooldown exactly linear in the simulated time, so it shows lost or doubled time regardless of the step size
+	constexpr float SignificanceTestHeatPerShot = 10.f;
+	constexpr float SignificanceTestCooldownPerSecond = 20.f;
+
+	static FRuntimeFloatCurve MakeConstantCurve(const float Value)
+	{
+		FRuntimeFloatCurve Curve;
+		Curve.GetRichCurve()->AddKey(0.f, Value);
+		return Curve;
+	}
+
+	static void ConfigureSpread(UCRRecoilSpreadComponent& Component, const bool bUseBatchedTick)
+	{
+		SetPropertyValue(&Component, TEXT("bUseBatchedTick"), bUseBatchedTick);
+		SetPropertyValue(&Component, TEXT("ShotToHeatCurve"), MakeConstantCurve(SignificanceTestHeatPerShot));
+		SetPropertyValue(&Component, TEXT("HeatToSpreadAngleCurve"), MakeConstantCurve(1.f));
+		SetPropertyValue(&Component, TEXT("HeatToCooldownPerSecondCurve"), MakeConstantCurve(SignificanceTestCooldownPerSecond));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilLowSignificanceCatchUpTest, "CrystalRecoil.Runtime.LowSignificanceCatchUp", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCRRecoilLowSignificanceCatchUpTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	FCRRecoilTestWorld TestWorld;
+	UCRRecoilPattern* Pattern = MakeTestPattern(20);
+	UCRRecoilTickSubsystem* TickSubsystem = TestWorld.GetWorld()->GetSubsystem<UCRRecoilTickSubsystem>();
+
+	// Each shooter gets its own player controller, so compensation doesn't see the other shooters' recoil as player input
+	UCRRecoilSpreadComponent* FullRate = TestWorld.SpawnRecoilComponent<UCRRecoilSpreadComponent>(Pattern, [](UCRRecoilSpreadComponent& Component) { ConfigureSpread(Component, false); }, TestWorld.SpawnPlayerController());
+	UCRRecoilSpreadComponent* ThrottledTick = TestWorld.SpawnRecoilComponent<UCRRecoilSpreadComponent>(Pattern, [](UCRRecoilSpreadComponent& Component) { ConfigureSpread(Component, false); }, TestWorld.SpawnPlayerController());
+	UCRRecoilSpreadComponent* Batched = TestWorld.SpawnRecoilComponent<UCRRecoilSpreadComponent>(Pattern, [](UCRRecoilSpreadComponent& Component) { ConfigureSpread(Component, true); }, TestWorld.SpawnPlayerController());
+
+	const TArray<UCRRecoilSpreadComponent*> Components = { FullRate, ThrottledTick, Batched };
+	const TArray<UCRRecoilSpreadComponent*> LowSignificance = { ThrottledTick, Batched };
+	for (UCRRecoilSpreadComponent* Component : Components)
+	{
+		Component->SetMaxRecoilHeat(1000.f);
+
+		// Cools down from the moment of each shot, so it never depends on whether a frame's update ran before or after the shot
+		Component->SetRecoilHeatCoolDownDelay(0.f);
+		Component->GetTargetController()->SetControlRotation(FRotator::ZeroRotator);
+	}
+	for (UCRRecoilSpreadComponent* Component : LowSignificance)
+	{
+		Component->SetRecoilSignificance(ECRRecoilSignificance::Low);
+	}
+
+	const auto CheckSameState = [&](const TCHAR* When)
+	{
+		for (const UCRRecoilSpreadComponent* Component : LowSignificance)
+		{
+			const TCHAR* Name = Component == Batched ? TEXT("batched") : TEXT("throttled tick");
+			TestEqual(FString::Printf(TEXT("The %s heat matches the full rate one %s"), Name, When), Component->GetRecoilHeat(), FullRate->GetRecoilHeat(), 1.e-3f);
+		}
+	};
+
+	for (UCRRecoilSpreadComponent* Component : Components)
+	{
+		Component->StartShooting();
+		Component->ApplyShot();
+	}
+
+	// The engine runs a throttled tick function every LowSignificanceUpdateInterval with all the time since its last run, this does the same by hand
+	const float LowSignificanceUpdateInterval = ThrottledTick->GetComponentTickInterval();
+	double LastThrottledTickTime = TestWorld.GetWorld()->GetTimeSeconds();
+
+	const auto RunFrame = [&]()
+	{
+		TestWorld.Tick(FullRate, SignificanceTestFrameTime);
+		TickSubsystem->Tick(SignificanceTestFrameTime);
+
+		const double Now = TestWorld.GetWorld()->GetTimeSeconds();
+		if (Now - LastThrottledTickTime >= LowSignificanceUpdateInterval - UE_KINDA_SMALL_NUMBER)
+		{
+			FCRRecoilTestWorld::TickAtCurrentTime(*ThrottledTick, static_cast<float>(Now - LastThrottledTickTime));
+			LastThrottledTickTime = Now;
+		}
+	};
+
+	TestTrue(TEXT("The throttled tick runs less often than every frame"), LowSignificanceUpdateInterval > SignificanceTestFrameTime);
+
+	for (int32 Frame = 1; Frame < SignificanceTestFrameCount; ++Frame)
+	{
+		RunFrame();
+
+		// Shots flush the deferred time first, after which the throttled shooters must be exactly where the full rate one is
+		if (Frame < SignificanceTestShotFrames && Frame % SignificanceTestFramesPerShot == 0)
+		{
+			for (UCRRecoilSpreadComponent* Component : Components)
+			{
+				Component->ApplyShot();
+			}
+			CheckSameState(*FString::Printf(TEXT("after the shot at frame %d"), Frame));
+		}
+
+		// Raising the significance catches up as well, e.g. when the player starts spectating the shooter
+		if (Frame == SignificanceTestFlushFrame)
+		{
+			for (UCRRecoilSpreadComponent* Component : LowSignificance)
+			{
+				Component->SetRecoilSignificance(ECRRecoilSignificance::High);
+				Component->SetRecoilSignificance(ECRRecoilSignificance::Low);
+			}
+			CheckSameState(TEXT("after raising the significance"));
+		}
+	}
+
+	TestTrue(TEXT("The heat has not run out before the end of the shots"), FullRate->GetRecoilHeat() > 0.f);
+
+	for (int32 Frame = 0; Frame < SignificanceTestSettleFrames; ++Frame)
+	{
+		RunFrame();
+	}
+
+	TestEqual(TEXT("The heat has cooled down"), FullRate->GetRecoilHeat(), 0.f);
+	TestFalse(TEXT("The full rate shooter has settled"), FullRate->IsComponentTickEnabled());
+	CheckSameState(TEXT("once settled"));
+	for (const UCRRecoilSpreadComponent* Component : LowSignificance)
+	{
+		TestTrue(TEXT("The low significance shooter ends with the same aim as the full rate one"), Component->GetTargetController()->GetControlRotation().Equals(FullRate->GetTargetController()->GetControlRotation(), 1.e-2f));
+	}
+	return true;
+}
+
+#endif
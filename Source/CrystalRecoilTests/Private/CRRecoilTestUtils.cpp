@@ -0,0 +1,177 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/MallocBase.h"
+#include "HAL/PlatformTLS.h"
+#include <atomic>
+
+namespace
+{
+	// Forwards everything to the allocator it was installed over, counting the allocations of one thread while armed
+	class FCRAllocationCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCRAllocationCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			// Shrinking to 0 is a free, anything else may move the block
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			InnerMalloc->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return InnerMalloc->QuantizeSize(Count, Alignment);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return InnerMalloc->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override
+		{
+			InnerMalloc->Trim(bTrimThreadCaches);
+		}
+
+		virtual void SetupTLSCachesOnCurrentThread() override
+		{
+			InnerMalloc->SetupTLSCachesOnCurrentThread();
+		}
+
+		virtual void MarkTLSCachesAsUsedOnCurrentThread() override
+		{
+			InnerMalloc->MarkTLSCachesAsUsedOnCurrentThread();
+		}
+
+		virtual void MarkTLSCachesAsUnusedOnCurrentThread() override
+		{
+			InnerMalloc->MarkTLSCachesAsUnusedOnCurrentThread();
+		}
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		virtual void UpdateStats() override
+		{
+			InnerMalloc->UpdateStats();
+		}
+
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+		{
+			InnerMalloc->GetAllocatorStats(OutStats);
+		}
+
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override
+		{
+			InnerMalloc->DumpAllocatorStats(Ar);
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return InnerMalloc->IsInternallyThreadSafe();
+		}
+
+		virtual bool ValidateHeap() override
+		{
+			return InnerMalloc->ValidateHeap();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return InnerMalloc->GetDescriptiveName();
+		}
+
+		// 0 while no FCRScopedAllocationCounter is in scope
+		std::atomic<uint32> CountedThreadId = 0;
+		std::atomic<int32> AllocationCount = 0;
+
+	private:
+		void CountAllocation()
+		{
+			if (CountedThreadId.load(std::memory_order_relaxed) == FPlatformTLS::GetCurrentThreadId())
+			{
+				AllocationCount.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		FMalloc* InnerMalloc = nullptr;
+	};
+
+	FCRAllocationCountingMalloc& GetAllocationCountingMalloc()
+	{
+		// Never uninstalled or freed, other threads may be inside it at any time
+		static FCRAllocationCountingMalloc* const CountingMalloc = []
+		{
+			FMalloc* InnerMalloc = GMalloc;
+			FCRAllocationCountingMalloc* Proxy = new FCRAllocationCountingMalloc(InnerMalloc);
+
+			// Swapped atomically, threads allocating meanwhile get either allocator and both serve the same heap
+			verify(FPlatformAtomics::InterlockedCompareExchangePointer(reinterpret_cast<void**>(&GMalloc), Proxy, InnerMalloc) == InnerMalloc);
+			return Proxy;
+		}();
+		return *CountingMalloc;
+	}
+}
+
+namespace CrystalRecoil::Tests
+{
+	FCRScopedAllocationCounter::FCRScopedAllocationCounter()
+	{
+		FCRAllocationCountingMalloc& CountingMalloc = GetAllocationCountingMalloc();
+		checkf(CountingMalloc.CountedThreadId.load() == 0, TEXT("FCRScopedAllocationCounter scopes can't be nested"));
+
+		CountingMalloc.AllocationCount.store(0);
+		CountingMalloc.CountedThreadId.store(FPlatformTLS::GetCurrentThreadId());
+	}
+
+	FCRScopedAllocationCounter::~FCRScopedAllocationCounter()
+	{
+		GetAllocationCountingMalloc().CountedThreadId.store(0);
+	}
+
+	int32 FCRScopedAllocationCounter::GetAllocationCount() const
+	{
+		return GetAllocationCountingMalloc().AllocationCount.load();
+	}
+}
+
+#endif
@@ -0,0 +1,121 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformTime.h"
+#include "Subsystems/CRRecoilTickSubsystem.h"
+
+namespace CrystalRecoil::Tests
+{
+	constexpr float TickPerfTestFrameTime = 1.f / 60.f;
+	constexpr int32 TickPerfTestWarmUpFrames = 30;
+	constexpr int32 TickPerfTestMeasuredFrames = 120;
+
+	// Every shooter fires a shot every few frames and restarts its burst every second, so they all stay active
+	constexpr int32 TickPerfTestFramesPerShot = 6;
+	constexpr int32 TickPerfTestFramesPerBurst = 60;
+
+	/**
+	* Average game thread milliseconds per frame to update ShooterCount shooters, own tick or batched
+	* Each shooter gets its own player controller, so compensation doesn't see the other shooters' recoil as player input
+	*/
+	static double MeasureRecoilFrameTime(const int32 ShooterCount, const bool bUseBatchedTick)
+	{
+		FCRRecoilTestWorld TestWorld;
+		UCRRecoilPattern* Pattern = MakeTestPattern(30);
+
+		TArray<UCRRecoilComponent*> Components;
+		Components.Reserve(ShooterCount);
+		for (int32 ShooterIndex = 0; ShooterIndex < ShooterCount; ++ShooterIndex)
+		{
+			Components.Add(TestWorld.SpawnRecoilComponent<UCRRecoilComponent>(Pattern, [bUseBatchedTick](UCRRecoilComponent& Component)
+			{
+				SetPropertyValue(&Component, TEXT("bUseBatchedTick"), bUseBatchedTick);
+			}, TestWorld.SpawnPlayerController()));
+		}
+
+		UCRRecoilTickSubsystem* TickSubsystem = TestWorld.GetWorld()->GetSubsystem<UCRRecoilTickSubsystem>();
+		double MeasuredSeconds = 0.0;
+
+		for (int32 Frame = 0; Frame < TickPerfTestWarmUpFrames + TickPerfTestMeasuredFrames; ++Frame)
+		{
+			// Shots are fired from gameplay code outside of the recoil update, so they aren't part of the measurement
+			for (int32 ShooterIndex = 0; ShooterIndex < ShooterCount; ++ShooterIndex)
+			{
+				// Staggered, so the shots of different shooters don't all land in the same frame
+				const int32 ShooterFrame = Frame + ShooterIndex;
+				if (ShooterFrame % TickPerfTestFramesPerBurst == 0)
+				{
+					Components[ShooterIndex]->StartShooting();
+				}
+				if (ShooterFrame % TickPerfTestFramesPerShot == 0)
+				{
+					Components[ShooterIndex]->ApplyShot();
+				}
+			}
+
+			const double StartSeconds = FPlatformTime::Seconds();
+			if (bUseBatchedTick)
+			{
+				TestWorld.AdvanceTime(TickPerfTestFrameTime);
+				TickSubsystem->Tick(TickPerfTestFrameTime);
+			}
+			else
+			{
+				TestWorld.TickAll(Components, TickPerfTestFrameTime);
+			}
+
+			if (Frame >= TickPerfTestWarmUpFrames)
+			{
+				MeasuredSeconds += FPlatformTime::Seconds() - StartSeconds;
+			}
+		}
+		return MeasuredSeconds * 1000.0 / TickPerfTestMeasuredFrames;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCRRecoilBatchedTickScalingTest, "CrystalRecoil.Perf.BatchedTickScaling", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FCRRecoilBatchedTickScalingTest::RunTest(const FString& Parameters)
+{
+	using namespace CrystalRecoil::Tests;
+
+	const int32 ShooterCounts[] = { 64, 512, 4096 };
+	const int32 NumWorkerThreads = FTaskGraphInterface::Get().GetNumWorkerThreads();
+	AddInfo(FString::Printf(TEXT("Worker threads: %d"), NumWorkerThreads));
+
+	double LargestOwnTickMs = 0.0;
+	double LargestBatchedMs = 0.0;
+	double PreviousBatchedMsPerShooter = 0.0;
+
+	for (const int32 ShooterCount : ShooterCounts)
+	{
+		const double OwnTickMs = MeasureRecoilFrameTime(ShooterCount, false);
+		const double BatchedMs = MeasureRecoilFrameTime(ShooterCount, true);
+		AddInfo(FString::Printf(TEXT("%5d shooters: own tick %.3f ms, batched %.3f ms, speedup %.2fx"), ShooterCount, OwnTickMs, BatchedMs, BatchedMs > 0.0 ? OwnTickMs / BatchedMs : 0.0));
+
+		// The batched update must stay linear in the shooter count, anything worse shows up as a growing cost per shooter
+		const double BatchedMsPerShooter = BatchedMs / ShooterCount;
+		if (PreviousBatchedMsPerShooter > 0.0)
+		{
+			TestTrue(FString::Printf(TEXT("Batched cost per shooter stays flat up to %d shooters"), ShooterCount), BatchedMsPerShooter < PreviousBatchedMsPerShooter * 2.0);
+		}
+		PreviousBatchedMsPerShooter = BatchedMsPerShooter;
+
+		LargestOwnTickMs = OwnTickMs;
+		LargestBatchedMs = BatchedMs;
+	}
+
+	// Only meaningful with enough workers to spread the recoil math over, e.g. the 8-32 core bot soak machines
+	if (NumWorkerThreads >= 4)
+	{
+		TestTrue(TEXT("Batched update beats per component ticks at the largest shooter count"), LargestBatchedMs < LargestOwnTickMs);
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,180 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+#include "Components/CRRecoilComponent.h"
+#include "Data/CRRecoilPattern.h"
+#include "Data/CRRecoilUnitGraph.h"
+
+/**
+* Shared helpers for the CrystalRecoil automation tests
+* Public so the tests of other modules (e.g. CrystalRecoilEditor, CrystalRecoilMass) can drive components the same way
+*/
+namespace CrystalRecoil::Tests
+{
+	// Sets a reflected property by name, used for the EditDefaultsOnly settings that have no runtime setter
+	template <typename ValueType>
+	bool SetPropertyValue(UObject* Object, const FName PropertyName, const ValueType& Value)
+	{
+		const FProperty* Property = Object ? Object->GetClass()->FindPropertyByName(PropertyName) : nullptr;
+		if (!Property || Property->GetElementSize() != sizeof(ValueType))
+		{
+			return false;
+		}
+
+		*Property->ContainerPtrToValuePtr<ValueType>(Object) = Value;
+		return true;
+	}
+
+	/**
+	* Builds a transient pattern from cumulative unit positions and bakes it
+	* Positions are in degrees, X is yaw and Y is pitch like the editor graph
+	*/
+	inline UCRRecoilPattern* MakeTestPattern(TConstArrayView<FVector2f> UnitPositions)
+	{
+		UCRRecoilPattern* Pattern = NewObject<UCRRecoilPattern>(GetTransientPackage());
+		UCRRecoilUnitGraph* UnitGraph = Pattern->GetUnitGraph();
+		for (const FVector2f& UnitPosition : UnitPositions)
+		{
+			UnitGraph->AddUnit(UnitPosition);
+		}
+		Pattern->BakeRuntimeData();
+		return Pattern;
+	}
+
+	// Pattern climbing by StepPitch per shot with a small alternating yaw sway
+	inline UCRRecoilPattern* MakeTestPattern(const int32 ShotCount, const float StepPitch = 0.5f)
+	{
+		TArray<FVector2f> UnitPositions;
+		for (int32 ShotIndex = 0; ShotIndex < ShotCount; ++ShotIndex)
+		{
+			UnitPositions.Add(FVector2f((ShotIndex % 2 == 0 ? 0.1f : -0.1f) * ShotIndex, StepPitch * (ShotIndex + 1)));
+		}
+		return MakeTestPattern(UnitPositions);
+	}
+
+	/**
+	* Minimal game world with a standalone (and so local) player controller
+	* Ticks are driven by hand through Tick() so tests control the exact frame times
+	*/
+	class FCRRecoilTestWorld
+	{
+	public:
+		FCRRecoilTestWorld()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("CrystalRecoilTestWorld"));
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+
+			World->InitializeActorsForPlay(FURL());
+			World->BeginPlay();
+
+			PlayerController = World->SpawnActor<APlayerController>();
+		}
+
+		~FCRRecoilTestWorld()
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		FCRRecoilTestWorld(const FCRRecoilTestWorld&) = delete;
+		FCRRecoilTestWorld& operator=(const FCRRecoilTestWorld&) = delete;
+
+		UWorld* GetWorld() const
+		{
+			return World;
+		}
+
+		APlayerController* GetPlayerController() const
+		{
+			return PlayerController;
+		}
+
+		// Extra local player controller, for tests where shooters must not share a control rotation
+		APlayerController* SpawnPlayerController()
+		{
+			return World->SpawnActor<APlayerController>();
+		}
+
+		/**
+		* Spawns an actor owning a recoil component of the given class, aimed at Controller or else the test player controller
+		* Configure runs before the component is registered, so EditDefaultsOnly settings read by BeginPlay can be set there
+		*/
+		template <typename ComponentType = UCRRecoilComponent>
+		ComponentType* SpawnRecoilComponent(UCRRecoilPattern* Pattern, TFunctionRef<void(ComponentType&)> Configure = [](ComponentType&) {}, AController* Controller = nullptr)
+		{
+			AActor* Owner = World->SpawnActor<AActor>();
+			ComponentType* Component = NewObject<ComponentType>(Owner);
+			Configure(*Component);
+			Component->RegisterComponent();
+			Component->SetTargetController(Controller ? Controller : PlayerController);
+			Component->SetRecoilPattern(Pattern);
+			return Component;
+		}
+
+		// Advances the world clock by DeltaTime and ticks every component of the range whose own tick is enabled
+		template <typename RangeType>
+		void TickAll(const RangeType& Components, const float DeltaTime)
+		{
+			AdvanceTime(DeltaTime);
+			for (UCRRecoilComponent* Component : Components)
+			{
+				TickAtCurrentTime(*Component, DeltaTime);
+			}
+		}
+
+		void Tick(UCRRecoilComponent* Component, const float DeltaTime)
+		{
+			AdvanceTime(DeltaTime);
+			TickAtCurrentTime(*Component, DeltaTime);
+		}
+
+		// Moves the world clock without ticking, e.g. to fire shots at the time stamp of the coming frame
+		void AdvanceTime(const float DeltaTime)
+		{
+			World->TimeSeconds += DeltaTime;
+		}
+
+		// Ticks the component if its own tick is enabled, without moving the world clock
+		static void TickAtCurrentTime(UCRRecoilComponent& Component, const float DeltaTime)
+		{
+			if (Component.IsComponentTickEnabled())
+			{
+				Component.TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+			}
+		}
+
+	private:
+		UWorld* World = nullptr;
+		APlayerController* PlayerController = nullptr;
+	};
+
+	/**
+	* Counts heap allocations made on the constructing thread while in scope
+	* Counting goes through a GMalloc proxy installed on first use and never removed, like the engine's poison and purgatory proxies,
+	* so task graph and render threads allocating while a test starts or ends never see a half swapped or destroyed allocator
+	* Only one counter can be in scope at a time
+	*/
+	class CRYSTALRECOILTESTS_API FCRScopedAllocationCounter : public FNoncopyable
+	{
+	public:
+		FCRScopedAllocationCounter();
+
+		~FCRScopedAllocationCounter();
+
+		int32 GetAllocationCount() const;
+	};
+}
+
+#endif
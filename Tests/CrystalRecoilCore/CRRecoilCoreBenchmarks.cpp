@@ -0,0 +1,151 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilMotion.h"
+#include "CRRecoilShotSequence.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace
+{
+	constexpr float FrameTime = 1.f / 60.f;
+
+	std::vector<FCRRecoilVector> MakeShotDeltas(const int32_t ShotCount)
+	{
+		std::vector<FCRRecoilVector> Deltas;
+		Deltas.reserve(ShotCount);
+		for (int32_t Shot = 0; Shot < ShotCount; ++Shot)
+		{
+			Deltas.emplace_back(0.1f * static_cast<float>(Shot % 7 - 3), 1.f + 0.05f * static_cast<float>(Shot));
+		}
+		return Deltas;
+	}
+
+	std::vector<FCRRecoilVector> MakeShotPositions(const std::vector<FCRRecoilVector>& Deltas)
+	{
+		std::vector<FCRRecoilVector> Positions(1);
+		for (const FCRRecoilVector& Delta : Deltas)
+		{
+			Positions.push_back(Positions.back() + Delta);
+		}
+		return Positions;
+	}
+
+	// One frame of what UCRRecoilComponent::UpdateRecoil does, without the controller
+	void TickMotion(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, const double WorldTime)
+	{
+		FCRRecoilRotation Delta;
+		if (CrystalRecoilCore::SimulateUplift(State, Settings, FrameTime, Delta))
+		{
+			CrystalRecoilCore::CommitUplift(State, Delta);
+		}
+		if (CrystalRecoilCore::SimulateRecovery(State, Settings, FCRRecoilRotation(), FrameTime, WorldTime, Delta) == ECRRecoilRecoveryStep::Recover)
+		{
+			CrystalRecoilCore::CommitRecovery(State, Delta);
+			CrystalRecoilCore::SettleRecovery(State);
+		}
+	}
+}
+
+static void BM_ConsumeShot(benchmark::State& BenchmarkState)
+{
+	const std::vector<FCRRecoilVector> Deltas = MakeShotDeltas(static_cast<int32_t>(BenchmarkState.range(0)));
+	FCRShotSequenceSettings Settings;
+	Settings.EndBehavior = ECRShotSequenceEndBehavior::RestartFromCustomIndex;
+	FCRRecoilRandomStream RandomStream;
+	int32_t ShotIndex = 0;
+
+	for (auto _ : BenchmarkState)
+	{
+		benchmark::DoNotOptimize(CrystalRecoilCore::ConsumeShot(ShotIndex, Deltas.data(), static_cast<int32_t>(Deltas.size()), Settings, RandomStream));
+	}
+	BenchmarkState.SetItemsProcessed(BenchmarkState.iterations());
+}
+BENCHMARK(BM_ConsumeShot)->Arg(30)->Arg(1000);
+
+static void BM_ConsumeShotAdvance(benchmark::State& BenchmarkState)
+{
+	const std::vector<FCRRecoilVector> Positions = MakeShotPositions(MakeShotDeltas(static_cast<int32_t>(BenchmarkState.range(0))));
+	FCRShotSequenceSettings Settings;
+	Settings.EndBehavior = ECRShotSequenceEndBehavior::RestartFromCustomIndex;
+	FCRRecoilRandomStream RandomStream;
+	float ShotPosition = 0.f;
+
+	for (auto _ : BenchmarkState)
+	{
+		benchmark::DoNotOptimize(CrystalRecoilCore::ConsumeShotAdvance(ShotPosition, 0.7f, Positions.data(), static_cast<int32_t>(Positions.size()), Settings, RandomStream));
+	}
+	BenchmarkState.SetItemsProcessed(BenchmarkState.iterations());
+}
+BENCHMARK(BM_ConsumeShotAdvance)->Arg(30)->Arg(1000);
+
+static void BM_BeginShot(benchmark::State& BenchmarkState)
+{
+	FCRRecoilMotionSettings Settings;
+	Settings.Model = static_cast<ECRRecoilMotionModel>(BenchmarkState.range(0));
+	FCRRecoilMotionState State;
+
+	for (auto _ : BenchmarkState)
+	{
+		CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(0.2f, 1.f), 0.f);
+		benchmark::DoNotOptimize(State);
+	}
+	BenchmarkState.SetItemsProcessed(BenchmarkState.iterations());
+}
+BENCHMARK(BM_BeginShot)->ArgName("Model")->Arg(static_cast<int64_t>(ECRRecoilMotionModel::Kinematic))->Arg(static_cast<int64_t>(ECRRecoilMotionModel::Spring));
+
+// A 30 shot burst at 600 RPM followed by recovery, one tick per 60 Hz frame, for every model
+static void BM_BurstAndRecovery(benchmark::State& BenchmarkState)
+{
+	const std::vector<FCRRecoilVector> Deltas = MakeShotDeltas(30);
+	FCRRecoilMotionSettings Settings;
+	Settings.Model = static_cast<ECRRecoilMotionModel>(BenchmarkState.range(0));
+	const FCRShotSequenceSettings SequenceSettings;
+	constexpr int32_t Frames = 120;
+	constexpr int32_t FramesPerShot = 6;
+
+	for (auto _ : BenchmarkState)
+	{
+		FCRRecoilMotionState State;
+		FCRRecoilRandomStream RandomStream;
+		int32_t ShotIndex = 0;
+		CrystalRecoilCore::BeginBurst(State, Settings);
+
+		for (int32_t Frame = 0; Frame < Frames; ++Frame)
+		{
+			const double WorldTime = Frame * FrameTime;
+			if (Frame % FramesPerShot == 0 && Frame / FramesPerShot < static_cast<int32_t>(Deltas.size()))
+			{
+				const FCRRecoilVector ShotDelta = CrystalRecoilCore::ConsumeShot(ShotIndex, Deltas.data(), static_cast<int32_t>(Deltas.size()), SequenceSettings, RandomStream);
+				CrystalRecoilCore::BeginShot(State, Settings, ShotDelta, static_cast<float>(WorldTime));
+			}
+			TickMotion(State, Settings, WorldTime);
+		}
+		benchmark::DoNotOptimize(State);
+	}
+	BenchmarkState.SetItemsProcessed(BenchmarkState.iterations() * Frames);
+}
+BENCHMARK(BM_BurstAndRecovery)->ArgName("Model")->Arg(static_cast<int64_t>(ECRRecoilMotionModel::Kinematic))->Arg(static_cast<int64_t>(ECRRecoilMotionModel::Spring));
+
+// One frame for many shooters mid burst, the per frame cost batched ticking and Mass pay
+static void BM_TickShooters(benchmark::State& BenchmarkState)
+{
+	const FCRRecoilMotionSettings Settings;
+	std::vector<FCRRecoilMotionState> States(static_cast<size_t>(BenchmarkState.range(0)));
+	for (size_t Index = 0; Index < States.size(); ++Index)
+	{
+		CrystalRecoilCore::BeginShot(States[Index], Settings, FCRRecoilVector(0.f, 1.f + 0.001f * static_cast<float>(Index)), 0.f);
+	}
+
+	for (auto _ : BenchmarkState)
+	{
+		for (FCRRecoilMotionState& State : States)
+		{
+			TickMotion(State, Settings, 0.05);
+		}
+		benchmark::ClobberMemory();
+	}
+	BenchmarkState.SetItemsProcessed(BenchmarkState.iterations() * BenchmarkState.range(0));
+}
+BENCHMARK(BM_TickShooters)->RangeMultiplier(10)->Range(10, 10000);
@@ -0,0 +1,337 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+/**
+* Fuzz target for the CrystalRecoilCore math: decodes the input into motion / shot sequence settings and a script of
+* shots, ticks and player input, runs it like UCRRecoilComponent does and aborts on the first broken invariant:
+*   - no NaN or infinite state or output
+*   - rotations stay bounded by the recoil that was fired
+*   - recovery never moves the aim past the pre-shot position
+*   - shot indices and positions stay inside the pattern
+*   - once the shooter stops firing the tick eventually disables itself
+* Built as a libFuzzer target with Clang, otherwise as a standalone random driver (see CMakeLists.txt)
+*/
+
+#include "CRRecoilMotion.h"
+#include "CRRecoilShotSequence.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#define CR_FUZZ_CHECK(Expr) \
+	do \
+	{ \
+		if (!(Expr)) \
+		{ \
+			std::fprintf(stderr, "%s:%d: invariant failed: %s\n", __FILE__, __LINE__, #Expr); \
+			std::abort(); \
+		} \
+	} while (false)
+
+namespace
+{
+	// Reads fuzzer bytes as bounded values, returning the lower bound once the input runs out
+	class FFuzzInput
+	{
+	public:
+		FFuzzInput(const uint8_t* InData, const size_t InSize) : Data(InData), Size(InSize) {}
+
+		bool IsEmpty() const
+		{
+			return Offset >= Size;
+		}
+
+		uint32_t ReadUInt32()
+		{
+			uint32_t Value = 0;
+			for (int32_t Byte = 0; Byte < 4 && Offset < Size; ++Byte)
+			{
+				Value |= static_cast<uint32_t>(Data[Offset++]) << (Byte * 8);
+			}
+			return Value;
+		}
+
+		uint8_t ReadByte()
+		{
+			return Offset < Size ? Data[Offset++] : 0;
+		}
+
+		int32_t ReadInt(const int32_t Min, const int32_t Max)
+		{
+			return Min + static_cast<int32_t>(ReadUInt32() % static_cast<uint32_t>(Max - Min + 1));
+		}
+
+		float ReadFloat(const float Min, const float Max)
+		{
+			return Min + (Max - Min) * (static_cast<float>(ReadUInt32() >> 8) / 16777215.f);
+		}
+
+		// Mostly in range, sometimes one of the values callers have to sanitize
+		float ReadDeltaTime()
+		{
+			switch (ReadByte() % 16)
+			{
+				case 0: return -ReadFloat(0.f, 1.f);
+				case 1: return std::numeric_limits<float>::quiet_NaN();
+				case 2: return std::numeric_limits<float>::infinity();
+				case 3: return 0.f;
+				default: return ReadFloat(0.f, 0.1f);
+			}
+		}
+
+	private:
+		const uint8_t* Data = nullptr;
+		size_t Size = 0;
+		size_t Offset = 0;
+	};
+
+	// Largest shot delta per axis, small enough that a whole script of shots can't wrap a rotation past 180 degrees
+	constexpr float MaxShotDelta = 0.5f;
+	constexpr int32_t MaxShots = 64;
+	constexpr int32_t MaxScriptSteps = 256;
+	constexpr float SettleFrameTime = 1.f / 60.f;
+	constexpr int32_t MaxSettleFrames = 120 * 60;
+	constexpr double Tolerance = 1e-3;
+
+	bool IsFinite(const FCRRecoilMotionState& State)
+	{
+		return !State.RecoilToApply.ContainsNaN() && !State.RecoilToRecover.ContainsNaN() && !State.AccumulatedInputDuringFire.ContainsNaN()
+			&& !State.SpringOffset.ContainsNaN() && !State.SpringVelocity.ContainsNaN() && std::isfinite(State.SpringTime)
+			&& std::isfinite(State.CurrentRecoilSpeed) && std::isfinite(State.CurrentUpliftDeceleration) && std::isfinite(State.CurrentRecoverySpeed)
+			&& std::isfinite(State.LastFireTime);
+	}
+
+	bool IsWithin(const FCRRecoilRotation& Rotation, const double Bound)
+	{
+		return std::abs(Rotation.Pitch) <= Bound && std::abs(Rotation.Yaw) <= Bound;
+	}
+
+	struct FFuzzRun
+	{
+		FCRRecoilMotionSettings Settings;
+		FCRShotSequenceSettings SequenceSettings;
+		std::vector<FCRRecoilVector> ShotDeltas;
+		std::vector<FCRRecoilVector> ShotPositions;
+
+		FCRRecoilMotionState State;
+		FCRRecoilRandomStream RandomStream;
+		int32_t ShotIndex = 0;
+		float ShotPosition = 0.f;
+		double WorldTime = 0.0;
+
+		// Aim relative to where the burst started, and the most recoil the shots fired so far could add up to
+		FCRRecoilRotation Aim;
+		double RecoilBound = 0.0;
+
+		void Shot(const bool bAdvance, const float ShotAdvance)
+		{
+			const int32_t ShotCount = static_cast<int32_t>(ShotDeltas.size());
+			FCRRecoilVector ShotDelta;
+			if (bAdvance)
+			{
+				ShotDelta = CrystalRecoilCore::ConsumeShotAdvance(ShotPosition, ShotAdvance, ShotPositions.data(), static_cast<int32_t>(ShotPositions.size()), SequenceSettings, RandomStream);
+				CR_FUZZ_CHECK(ShotPosition >= 0.f && ShotPosition <= static_cast<float>(ShotCount));
+			}
+			else
+			{
+				ShotDelta = CrystalRecoilCore::ConsumeShot(ShotIndex, ShotDeltas.data(), ShotCount, SequenceSettings, RandomStream);
+				CR_FUZZ_CHECK(ShotIndex >= 0 && ShotIndex < ShotCount);
+			}
+
+			CR_FUZZ_CHECK(!ShotDelta.ContainsNaN());
+
+			// An advance of at most one shot can cross one loop boundary, so it covers at most two shots worth of delta
+			CR_FUZZ_CHECK(std::abs(ShotDelta.X) <= 2.f * MaxShotDelta + Tolerance && std::abs(ShotDelta.Y) <= 2.f * MaxShotDelta + Tolerance);
+			RecoilBound += 2.0 * MaxShotDelta;
+
+			CrystalRecoilCore::BeginShot(State, Settings, ShotDelta, static_cast<float>(WorldTime));
+			CR_FUZZ_CHECK(IsFinite(State));
+		}
+
+		// One UCRRecoilComponent::UpdateRecoil, returns true if the component would disable its tick
+		bool Tick(const float DeltaTime, const FCRRecoilRotation& PlayerInput)
+		{
+			if (std::isfinite(DeltaTime) && DeltaTime > 0.f)
+			{
+				WorldTime += DeltaTime;
+			}
+
+			FCRRecoilRotation DeltaRecoilRotation;
+			if (CrystalRecoilCore::SimulateUplift(State, Settings, DeltaTime, DeltaRecoilRotation))
+			{
+				CR_FUZZ_CHECK(!DeltaRecoilRotation.ContainsNaN());
+				CrystalRecoilCore::CommitUplift(State, DeltaRecoilRotation);
+				Aim += DeltaRecoilRotation;
+			}
+			CR_FUZZ_CHECK(IsFinite(State));
+
+			// Player input moves the aim too, and the recovery debt can at most be paid back by it
+			Aim -= PlayerInput;
+
+			const FCRRecoilRotation RecoilToRecover = State.RecoilToRecover;
+			FCRRecoilRotation DeltaRecoveryRotation;
+			const ECRRecoilRecoveryStep Step = CrystalRecoilCore::SimulateRecovery(State, Settings, PlayerInput, DeltaTime, WorldTime, DeltaRecoveryRotation);
+			CR_FUZZ_CHECK(IsFinite(State));
+
+			bool bDisable = Step == ECRRecoilRecoveryStep::Cancel || Step == ECRRecoilRecoveryStep::Settle;
+			if (Step == ECRRecoilRecoveryStep::Recover)
+			{
+				CR_FUZZ_CHECK(!DeltaRecoveryRotation.ContainsNaN());
+
+				// Recovery pays back the (compensated) debt and never moves past it
+				const FCRRecoilRotation& Debt = State.RecoilToRecover;
+				CR_FUZZ_CHECK(std::abs(DeltaRecoveryRotation.Pitch) <= std::abs(Debt.Pitch) + Tolerance);
+				CR_FUZZ_CHECK(std::abs(DeltaRecoveryRotation.Yaw) <= std::abs(Debt.Yaw) + Tolerance);
+				CR_FUZZ_CHECK(DeltaRecoveryRotation.Pitch * Debt.Pitch <= 0.0 && DeltaRecoveryRotation.Yaw * Debt.Yaw <= 0.0);
+				CR_FUZZ_CHECK(std::abs(Debt.Pitch) <= std::abs(RecoilToRecover.Pitch) + Tolerance && std::abs(Debt.Yaw) <= std::abs(RecoilToRecover.Yaw) + Tolerance);
+
+				CrystalRecoilCore::CommitRecovery(State, DeltaRecoveryRotation);
+				Aim += DeltaRecoveryRotation;
+				bDisable = CrystalRecoilCore::SettleRecovery(State);
+			}
+
+			CR_FUZZ_CHECK(IsWithin(State.RecoilToApply, RecoilBound + Tolerance));
+			CR_FUZZ_CHECK(IsWithin(State.RecoilToRecover, RecoilBound + Tolerance));
+			return bDisable;
+		}
+	};
+
+	void RunFuzzInput(const uint8_t* Data, const size_t Size)
+	{
+		FFuzzInput Input(Data, Size);
+		FFuzzRun Run;
+
+		FCRRecoilMotionSettings& Settings = Run.Settings;
+		Settings.Model = Input.ReadByte() % 2 == 0 ? ECRRecoilMotionModel::Kinematic : ECRRecoilMotionModel::Spring;
+		Settings.UpliftSpeed = Input.ReadFloat(0.f, 1.f);
+		Settings.UpliftSpeedMultiplier = Input.ReadFloat(0.1f, 10.f);
+		Settings.RecoveryDelay = Input.ReadFloat(0.f, 1.f);
+		Settings.InitialRecoverySpeed = Input.ReadFloat(1.f, 50.f);
+		Settings.MaxRecoverySpeed = Input.ReadFloat(1.f, 50.f);
+		Settings.RecoveryAcceleration = Input.ReadFloat(0.f, 500.f);
+		Settings.RecoveryCancelThreshold = Input.ReadByte() % 2 == 0 ? 0.f : Input.ReadFloat(0.f, 10.f);
+		Settings.SpringFrequency = Input.ReadFloat(1.f, 20.f);
+		Settings.SpringDampingRatio = Input.ReadFloat(0.1f, 1.f);
+
+		FCRShotSequenceSettings& SequenceSettings = Run.SequenceSettings;
+		SequenceSettings.EndBehavior = static_cast<ECRShotSequenceEndBehavior>(Input.ReadByte() % 4);
+		SequenceSettings.CustomRestartIndex = Input.ReadInt(-4, MaxShots + 4);
+		SequenceSettings.RandomXRange = FCRRecoilRange{ Input.ReadFloat(-MaxShotDelta, 0.f), Input.ReadFloat(0.f, MaxShotDelta) };
+		SequenceSettings.RandomYRange = FCRRecoilRange{ Input.ReadFloat(-MaxShotDelta, 0.f), Input.ReadFloat(0.f, MaxShotDelta) };
+		SequenceSettings.ReferenceFireInterval = Input.ReadFloat(0.f, 0.5f);
+		Run.RandomStream = FCRRecoilRandomStream(Input.ReadUInt32());
+
+		const int32_t ShotCount = Input.ReadInt(1, MaxShots);
+		Run.ShotPositions.emplace_back();
+		for (int32_t Shot = 0; Shot < ShotCount; ++Shot)
+		{
+			const FCRRecoilVector Delta(Input.ReadFloat(-MaxShotDelta, MaxShotDelta), Input.ReadFloat(-MaxShotDelta, MaxShotDelta));
+			Run.ShotDeltas.push_back(Delta);
+			Run.ShotPositions.push_back(Run.ShotPositions.back() + Delta);
+		}
+
+		CrystalRecoilCore::BeginBurst(Run.State, Settings);
+
+		for (int32_t Step = 0; Step < MaxScriptSteps && !Input.IsEmpty(); ++Step)
+		{
+			switch (Input.ReadByte() % 4)
+			{
+				case 0:
+				{
+					Run.Shot(false, 1.f);
+					break;
+				}
+				case 1:
+				{
+					const float ShotAdvance = CrystalRecoilCore::GetTimeIndexedShotAdvance(SequenceSettings, Run.ShotPosition, Run.State.LastFireTime, Run.WorldTime);
+					CR_FUZZ_CHECK(ShotAdvance >= 0.f && ShotAdvance <= 1.f);
+					Run.Shot(true, ShotAdvance);
+					break;
+				}
+				case 2:
+				{
+					const FCRRecoilRotation PlayerInput(Input.ReadFloat(-1.f, 1.f), Input.ReadFloat(-1.f, 1.f));
+					Run.Tick(Input.ReadDeltaTime(), PlayerInput);
+					break;
+				}
+				default:
+				{
+					Run.Tick(Input.ReadDeltaTime(), FCRRecoilRotation());
+					break;
+				}
+			}
+		}
+
+		// Once the shooter stops firing and aiming the tick has to switch itself off
+		bool bDisabled = false;
+		for (int32_t Frame = 0; Frame < MaxSettleFrames && !bDisabled; ++Frame)
+		{
+			bDisabled = Run.Tick(SettleFrameTime, FCRRecoilRotation());
+		}
+		CR_FUZZ_CHECK(bDisabled);
+	}
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* Data, const size_t Size)
+{
+	RunFuzzInput(Data, Size);
+	return 0;
+}
+
+#if !CRYSTALRECOIL_LIBFUZZER
+#include <fstream>
+#include <iterator>
+#include <random>
+
+// Without libFuzzer: replays the inputs given as files, or runs random inputs: CrystalRecoilCoreFuzzer [-runs=N] [-seed=N] [files...]
+int main(int ArgCount, char** Args)
+{
+	uint32_t Runs = 10000;
+	uint32_t Seed = 1;
+	std::vector<const char*> Files;
+	for (int ArgIndex = 1; ArgIndex < ArgCount; ++ArgIndex)
+	{
+		if (std::strncmp(Args[ArgIndex], "-runs=", 6) == 0)
+		{
+			Runs = static_cast<uint32_t>(std::strtoul(Args[ArgIndex] + 6, nullptr, 10));
+		}
+		else if (std::strncmp(Args[ArgIndex], "-seed=", 6) == 0)
+		{
+			Seed = static_cast<uint32_t>(std::strtoul(Args[ArgIndex] + 6, nullptr, 10));
+		}
+		else
+		{
+			Files.push_back(Args[ArgIndex]);
+		}
+	}
+
+	for (const char* File : Files)
+	{
+		std::ifstream Stream(File, std::ios::binary);
+		const std::vector<uint8_t> Data((std::istreambuf_iterator<char>(Stream)), std::istreambuf_iterator<char>());
+		RunFuzzInput(Data.data(), Data.size());
+	}
+
+	if (!Files.empty())
+	{
+		return 0;
+	}
+
+	std::mt19937 Random(Seed);
+	std::vector<uint8_t> Data;
+	for (uint32_t Run = 0; Run < Runs; ++Run)
+	{
+		Data.resize(Random() % 1024);
+		for (uint8_t& Byte : Data)
+		{
+			Byte = static_cast<uint8_t>(Random());
+		}
+		RunFuzzInput(Data.data(), Data.size());
+	}
+	std::printf("Ran %u random inputs\n", Runs);
+	return 0;
+}
+#endif
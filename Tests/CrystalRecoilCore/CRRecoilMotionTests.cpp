@@ -0,0 +1,314 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilMotion.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+	constexpr float FrameTime = 1.f / 120.f;
+
+	// Runs uplift to completion at a fixed frame rate, returns the applied rotation and the simulated time
+	FCRRecoilRotation RunUplift(FCRRecoilMotionState& State, const FCRRecoilMotionSettings& Settings, float& OutTime)
+	{
+		FCRRecoilRotation Applied;
+		OutTime = 0.f;
+		FCRRecoilRotation Delta;
+		for (int32_t Frame = 0; Frame < 10000 && CrystalRecoilCore::SimulateUplift(State, Settings, FrameTime, Delta); ++Frame)
+		{
+			CrystalRecoilCore::CommitUplift(State, Delta);
+			Applied += Delta;
+			OutTime += FrameTime;
+		}
+		return Applied;
+	}
+
+	FCRRecoilMotionSettings MakeSpringSettings(const float DampingRatio)
+	{
+		FCRRecoilMotionSettings Settings;
+		Settings.Model = ECRRecoilMotionModel::Spring;
+		Settings.SpringFrequency = 4.f;
+		Settings.SpringDampingRatio = DampingRatio;
+		return Settings;
+	}
+}
+
+TEST(CRRecoilMotion, UpliftCoversExactlyTheShotDelta)
+{
+	const FCRRecoilMotionSettings Settings;
+	FCRRecoilMotionState State;
+	CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(1.f, 2.f), 0.f);
+
+	float UpliftTime = 0.f;
+	const FCRRecoilRotation Applied = RunUplift(State, Settings, UpliftTime);
+
+	// X is yaw, Y is pitch with the pitch sign flipped
+	EXPECT_NEAR(Applied.Pitch, -2.0, 1e-4);
+	EXPECT_NEAR(Applied.Yaw, 1.0, 1e-4);
+	EXPECT_TRUE(State.RecoilToApply.IsNearlyZero());
+	EXPECT_NEAR(State.RecoilToRecover.Pitch, -2.0, 1e-4);
+	EXPECT_NEAR(State.RecoilToRecover.Yaw, 1.0, 1e-4);
+}
+
+TEST(CRRecoilMotion, UpliftTakesTheUpliftDuration)
+{
+	FCRRecoilMotionSettings Settings;
+	Settings.UpliftSpeed = 0.f;
+	FCRRecoilMotionState State;
+	CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(0.f, 3.f), 0.f);
+
+	float UpliftTime = 0.f;
+	RunUplift(State, Settings, UpliftTime);
+	EXPECT_NEAR(UpliftTime, CrystalRecoilCore::GetUpliftDuration(Settings.UpliftSpeed), 2.f * FrameTime);
+
+	// Modifiers speed the kick up on top of UpliftSpeed
+	Settings.UpliftSpeedMultiplier = 2.f;
+	FCRRecoilMotionState FastState;
+	CrystalRecoilCore::BeginShot(FastState, Settings, FCRRecoilVector(0.f, 3.f), 0.f);
+	float FastUpliftTime = 0.f;
+	RunUplift(FastState, Settings, FastUpliftTime);
+	EXPECT_NEAR(FastUpliftTime, UpliftTime * 0.5f, 2.f * FrameTime);
+}
+
+TEST(CRRecoilMotion, UpliftDurationIsMonotonicInUpliftSpeed)
+{
+	EXPECT_NEAR(CrystalRecoilCore::GetUpliftDuration(0.f), 0.5f, 1e-6f);
+	EXPECT_NEAR(CrystalRecoilCore::GetUpliftDuration(1.f), 0.025f, 1e-6f);
+	for (float UpliftSpeed = 0.f; UpliftSpeed < 1.f; UpliftSpeed += 0.05f)
+	{
+		EXPECT_GT(CrystalRecoilCore::GetUpliftDuration(UpliftSpeed), CrystalRecoilCore::GetUpliftDuration(UpliftSpeed + 0.05f));
+	}
+}
+
+TEST(CRRecoilMotion, RecoveryReturnsToThePreShotAimWithoutOvershoot)
+{
+	FCRRecoilMotionSettings Settings;
+	Settings.RecoveryDelay = 0.05f;
+	FCRRecoilMotionState State;
+	CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(-1.5f, 4.f), 0.f);
+
+	float WorldTime = 0.f;
+	FCRRecoilRotation Aim = RunUplift(State, Settings, WorldTime);
+
+	bool bSettled = false;
+	for (int32_t Frame = 0; Frame < 10000 && !bSettled; ++Frame)
+	{
+		WorldTime += FrameTime;
+		FCRRecoilRotation Delta;
+		switch (CrystalRecoilCore::SimulateRecovery(State, Settings, FCRRecoilRotation(), FrameTime, WorldTime, Delta))
+		{
+			case ECRRecoilRecoveryStep::Recover:
+			{
+				ASSERT_LE(std::abs(Delta.Pitch), std::abs(State.RecoilToRecover.Pitch) + 1e-4);
+				ASSERT_LE(std::abs(Delta.Yaw), std::abs(State.RecoilToRecover.Yaw) + 1e-4);
+				CrystalRecoilCore::CommitRecovery(State, Delta);
+				Aim += Delta;
+				bSettled = CrystalRecoilCore::SettleRecovery(State);
+				break;
+			}
+			case ECRRecoilRecoveryStep::Settle:
+			{
+				bSettled = true;
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+	}
+
+	EXPECT_TRUE(bSettled);
+	EXPECT_NEAR(Aim.Pitch, 0.0, 1e-3);
+	EXPECT_NEAR(Aim.Yaw, 0.0, 1e-3);
+	EXPECT_FALSE(CrystalRecoilCore::HasPendingMotion(State));
+}
+
+TEST(CRRecoilMotion, RecoveryWaitsForTheRecoveryDelay)
+{
+	FCRRecoilMotionSettings Settings;
+	Settings.RecoveryDelay = 0.5f;
+	FCRRecoilMotionState State;
+	CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(0.f, 1.f), 0.f);
+
+	float WorldTime = 0.f;
+	RunUplift(State, Settings, WorldTime);
+
+	FCRRecoilRotation Delta;
+	EXPECT_EQ(CrystalRecoilCore::SimulateRecovery(State, Settings, FCRRecoilRotation(), FrameTime, 0.4, Delta), ECRRecoilRecoveryStep::None);
+	EXPECT_EQ(CrystalRecoilCore::SimulateRecovery(State, Settings, FCRRecoilRotation(), FrameTime, 0.6, Delta), ECRRecoilRecoveryStep::Recover);
+}
+
+TEST(CRRecoilMotion, RecoveryDebtBelowTheRecoveryToleranceSettles)
+{
+	FCRRecoilMotionSettings Settings;
+	Settings.RecoveryDelay = 0.1f;
+	FCRRecoilMotionState State;
+	State.RecoilToRecover = FCRRecoilRotation(0.0, 0.0006);
+
+	FCRRecoilRotation Delta;
+	EXPECT_EQ(CrystalRecoilCore::SimulateRecovery(State, Settings, FCRRecoilRotation(), FrameTime, 1.0, Delta), ECRRecoilRecoveryStep::Settle);
+	EXPECT_TRUE(State.RecoilToRecover.IsZero());
+}
+
+TEST(CRRecoilMotion, RecoveryIsCancelledWhenThePlayerAimsAway)
+{
+	FCRRecoilMotionSettings Settings;
+	Settings.RecoveryDelay = 0.2f;
+	Settings.RecoveryCancelThreshold = 1.f;
+	FCRRecoilMotionState State;
+	CrystalRecoilCore::BeginBurst(State, Settings);
+	CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(0.f, 1.f), 0.f);
+
+	float WorldTime = 0.f;
+	RunUplift(State, Settings, WorldTime);
+
+	// Sideways input doesn't compensate the pitch debt, but counts as aiming away
+	FCRRecoilRotation Delta;
+	EXPECT_EQ(CrystalRecoilCore::SimulateRecovery(State, Settings, FCRRecoilRotation(0.0, 2.0), FrameTime, 0.1, Delta), ECRRecoilRecoveryStep::None);
+	EXPECT_EQ(CrystalRecoilCore::SimulateRecovery(State, Settings, FCRRecoilRotation(), FrameTime, 0.3, Delta), ECRRecoilRecoveryStep::Cancel);
+	EXPECT_TRUE(State.RecoilToRecover.IsZero());
+}
+
+TEST(CRRecoilMotion, CompensationReducesButNeverFlipsTheRecoveryDebt)
+{
+	FCRRecoilRotation RecoilToRecover(2.0, -1.0);
+
+	CrystalRecoilCore::CompensateRecovery(RecoilToRecover, FCRRecoilRotation(0.5, -0.25));
+	EXPECT_DOUBLE_EQ(RecoilToRecover.Pitch, 1.5);
+	EXPECT_DOUBLE_EQ(RecoilToRecover.Yaw, -0.75);
+
+	// Pulling against the recovery direction, or below the noise threshold, changes nothing
+	CrystalRecoilCore::CompensateRecovery(RecoilToRecover, FCRRecoilRotation(-1.0, 0.005));
+	EXPECT_DOUBLE_EQ(RecoilToRecover.Pitch, 1.5);
+	EXPECT_DOUBLE_EQ(RecoilToRecover.Yaw, -0.75);
+
+	CrystalRecoilCore::CompensateRecovery(RecoilToRecover, FCRRecoilRotation(5.0, -5.0));
+	EXPECT_DOUBLE_EQ(RecoilToRecover.Pitch, 0.0);
+	EXPECT_DOUBLE_EQ(RecoilToRecover.Yaw, 0.0);
+}
+
+TEST(CRRecoilMotion, NonFiniteShotsAreIgnored)
+{
+	const FCRRecoilMotionSettings Settings;
+	FCRRecoilMotionState State;
+	CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(std::numeric_limits<float>::quiet_NaN(), 1.f), 1.f);
+
+	EXPECT_TRUE(State.RecoilToApply.IsZero());
+	EXPECT_EQ(State.LastFireTime, 0.f);
+	EXPECT_FALSE(CrystalRecoilCore::HasPendingMotion(State));
+}
+
+TEST(CRRecoilMotion, InvalidDeltaTimesDoNotMoveTheAim)
+{
+	const FCRRecoilMotionSettings Settings;
+	FCRRecoilMotionState State;
+	CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(0.f, 1.f), 0.f);
+
+	for (const float DeltaTime : { -1.f, std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity() })
+	{
+		FCRRecoilRotation Delta;
+		ASSERT_TRUE(CrystalRecoilCore::SimulateUplift(State, Settings, DeltaTime, Delta));
+		EXPECT_TRUE(Delta.IsZero());
+		EXPECT_FALSE(State.RecoilToApply.ContainsNaN());
+	}
+}
+
+TEST(CRRecoilMotion, SpringPeaksAtTheShotDeltaAndReturnsToRest)
+{
+	for (const float DampingRatio : { 1.f, 0.5f })
+	{
+		const FCRRecoilMotionSettings Settings = MakeSpringSettings(DampingRatio);
+		FCRRecoilMotionState State;
+		CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(0.f, 2.f), 0.f);
+
+		double PeakPitch = 0.0;
+		FCRRecoilRotation Delta;
+		for (int32_t Frame = 0; Frame < 5000 && CrystalRecoilCore::SimulateUplift(State, Settings, 0.001f, Delta); ++Frame)
+		{
+			CrystalRecoilCore::CommitUplift(State, Delta);
+			PeakPitch = std::min(PeakPitch, State.RecoilToRecover.Pitch);
+		}
+
+		EXPECT_NEAR(PeakPitch, -2.0, 0.01) << "DampingRatio " << DampingRatio;
+		EXPECT_FALSE(CrystalRecoilCore::HasPendingMotion(State)) << "DampingRatio " << DampingRatio;
+		EXPECT_TRUE(State.RecoilToRecover.IsNearlyZero()) << "DampingRatio " << DampingRatio;
+	}
+}
+
+TEST(CRRecoilMotion, SpringIsFrameRateIndependent)
+{
+	const FCRRecoilMotionSettings Settings = MakeSpringSettings(0.4f);
+
+	auto RunFor = [&Settings](const float DeltaTime, const int32_t Frames)
+	{
+		FCRRecoilMotionState State;
+		CrystalRecoilCore::BeginShot(State, Settings, FCRRecoilVector(1.f, 3.f), 0.f);
+		FCRRecoilRotation Delta;
+		for (int32_t Frame = 0; Frame < Frames; ++Frame)
+		{
+			if (CrystalRecoilCore::SimulateUplift(State, Settings, DeltaTime, Delta))
+			{
+				CrystalRecoilCore::CommitUplift(State, Delta);
+			}
+		}
+		return State.RecoilToRecover;
+	};
+
+	const FCRRecoilRotation At30 = RunFor(1.f / 30.f, 3);
+	const FCRRecoilRotation At240 = RunFor(1.f / 240.f, 24);
+	EXPECT_NEAR(At30.Pitch, At240.Pitch, 1e-4);
+	EXPECT_NEAR(At30.Yaw, At240.Yaw, 1e-4);
+}
+
+TEST(CRRecoilMotion, EvaluateSpringStartsAtTheInitialConditions)
+{
+	const FCRRecoilMotionSettings Settings = MakeSpringSettings(0.7f);
+	double Offset = 0.0;
+	double Velocity = 0.0;
+	CrystalRecoilCore::EvaluateSpring(Settings, 1.5, -3.0, 0.f, Offset, Velocity);
+	EXPECT_NEAR(Offset, 1.5, 1e-9);
+	EXPECT_NEAR(Velocity, -3.0, 1e-9);
+}
+
+TEST(CRRecoilMotion, PlayerInputRemovesGeneratedInputAndWraps)
+{
+	// Crossing the +-180 yaw seam is a 2 degree turn, not 358
+	const FCRRecoilRotation Input = CrystalRecoilCore::GetPlayerInput(FCRRecoilRotation(0.0, -179.0), FCRRecoilRotation(0.0, 179.0), FCRRecoilRotation());
+	EXPECT_NEAR(Input.Yaw, 2.0, 1e-9);
+
+	const FCRRecoilRotation Generated = CrystalRecoilCore::GetGeneratedInput(FCRRecoilRotation(-1.0, 0.5), FCRRecoilRotation(0.25, -0.25));
+	EXPECT_DOUBLE_EQ(Generated.Pitch, 0.75);
+	EXPECT_DOUBLE_EQ(Generated.Yaw, 0.25);
+
+	// A frame where only the recoil moved the aim has no player input
+	const FCRRecoilRotation Control = CrystalRecoilCore::ApplyToControlRotation(FCRRecoilRotation(10.0, 20.0), FCRRecoilRotation(-1.0, 0.5));
+	const FCRRecoilRotation PlayerInput = CrystalRecoilCore::GetPlayerInput(Control, FCRRecoilRotation(10.0, 20.0), CrystalRecoilCore::GetGeneratedInput(FCRRecoilRotation(-1.0, 0.5), FCRRecoilRotation()));
+	EXPECT_TRUE(PlayerInput.IsNearlyZero());
+}
+
+TEST(CRRecoilMotion, ApplyToControlRotationClampsPitchAndNormalizesYaw)
+{
+	const FCRRecoilRotation Clamped = CrystalRecoilCore::ApplyToControlRotation(FCRRecoilRotation(85.0, 0.0), FCRRecoilRotation(-10.0, 0.0));
+	EXPECT_NEAR(Clamped.Pitch, 89.9, 1e-4);
+
+	const FCRRecoilRotation Wrapped = CrystalRecoilCore::ApplyToControlRotation(FCRRecoilRotation(0.0, 179.0), FCRRecoilRotation(0.0, 3.0));
+	EXPECT_NEAR(Wrapped.Yaw, -178.0, 1e-9);
+}
+
+TEST(CRRecoilCoreTypes, AngleHelpersMatchTheEngine)
+{
+	EXPECT_DOUBLE_EQ(CrystalRecoilCore::NormalizeAxis(190.0), -170.0);
+	EXPECT_DOUBLE_EQ(CrystalRecoilCore::NormalizeAxis(-190.0), 170.0);
+	EXPECT_DOUBLE_EQ(CrystalRecoilCore::ClampAxis(-90.0), 270.0);
+	EXPECT_DOUBLE_EQ(CrystalRecoilCore::ClampAngle(120.0, -90.0, 90.0), 90.0);
+	EXPECT_DOUBLE_EQ(CrystalRecoilCore::ClampAngle(-100.0, -90.0, 90.0), -90.0);
+	EXPECT_DOUBLE_EQ(CrystalRecoilCore::ClampAngle(45.0, -90.0, 90.0), 45.0);
+
+	// Full turns count as zero, like FRotator::IsNearlyZero
+	EXPECT_TRUE(FCRRecoilRotation(360.0, -720.0).IsNearlyZero());
+	EXPECT_FALSE(FCRRecoilRotation(0.01, 0.0).IsNearlyZero());
+}
@@ -0,0 +1,189 @@
+﻿// Copyright CrystalVapor 2026, All rights reserved.
+
+#include "CRRecoilShotSequence.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+	// Three shots kicking up 1, 2 and 3 degrees, with a little yaw on the last one
+	const std::vector<FCRRecoilVector> ShotDeltas = { FCRRecoilVector(0.f, 1.f), FCRRecoilVector(0.f, 2.f), FCRRecoilVector(1.f, 3.f) };
+
+	std::vector<FCRRecoilVector> MakeShotPositions()
+	{
+		std::vector<FCRRecoilVector> Positions(1);
+		for (const FCRRecoilVector& Delta : ShotDeltas)
+		{
+			Positions.push_back(Positions.back() + Delta);
+		}
+		return Positions;
+	}
+
+	FCRShotSequenceSettings MakeSettings(const ECRShotSequenceEndBehavior EndBehavior)
+	{
+		FCRShotSequenceSettings Settings;
+		Settings.EndBehavior = EndBehavior;
+		Settings.CustomRestartIndex = 1;
+		Settings.RandomXRange = FCRRecoilRange{ -1.f, 1.f };
+		Settings.RandomYRange = FCRRecoilRange{ 2.f, 4.f };
+		return Settings;
+	}
+
+	FCRRecoilVector Consume(int32_t& ShotIndex, const FCRShotSequenceSettings& Settings, FCRRecoilRandomStream& RandomStream)
+	{
+		return CrystalRecoilCore::ConsumeShot(ShotIndex, ShotDeltas.data(), static_cast<int32_t>(ShotDeltas.size()), Settings, RandomStream);
+	}
+}
+
+TEST(CRRecoilShotSequence, ConsumeShotWalksThePattern)
+{
+	const FCRShotSequenceSettings Settings = MakeSettings(ECRShotSequenceEndBehavior::RepeatLast);
+	FCRRecoilRandomStream RandomStream;
+	int32_t ShotIndex = 0;
+
+	EXPECT_EQ(Consume(ShotIndex, Settings, RandomStream), ShotDeltas[0]);
+	EXPECT_EQ(Consume(ShotIndex, Settings, RandomStream), ShotDeltas[1]);
+	EXPECT_EQ(ShotIndex, 2);
+}
+
+TEST(CRRecoilShotSequence, EndBehaviors)
+{
+	FCRRecoilRandomStream RandomStream;
+
+	// RepeatLast and Stop keep the index on the last shot
+	int32_t ShotIndex = 2;
+	EXPECT_EQ(Consume(ShotIndex, MakeSettings(ECRShotSequenceEndBehavior::RepeatLast), RandomStream), ShotDeltas[2]);
+	EXPECT_EQ(Consume(ShotIndex, MakeSettings(ECRShotSequenceEndBehavior::Stop), RandomStream), FCRRecoilVector());
+	EXPECT_EQ(ShotIndex, 2);
+
+	// RestartFromCustomIndex jumps back to the loop point and consumes it
+	EXPECT_EQ(Consume(ShotIndex, MakeSettings(ECRShotSequenceEndBehavior::RestartFromCustomIndex), RandomStream), ShotDeltas[1]);
+	EXPECT_EQ(ShotIndex, 2);
+
+	// Random stays within the configured ranges
+	for (int32_t Shot = 0; Shot < 100; ++Shot)
+	{
+		const FCRRecoilVector Delta = Consume(ShotIndex, MakeSettings(ECRShotSequenceEndBehavior::Random), RandomStream);
+		EXPECT_GE(Delta.X, -1.f);
+		EXPECT_LT(Delta.X, 1.f);
+		EXPECT_GE(Delta.Y, 2.f);
+		EXPECT_LT(Delta.Y, 4.f);
+	}
+	EXPECT_EQ(ShotIndex, 2);
+}
+
+TEST(CRRecoilShotSequence, RestartingAtTheLastShotKeepsTheIndexInRange)
+{
+	FCRShotSequenceSettings Settings = MakeSettings(ECRShotSequenceEndBehavior::RestartFromCustomIndex);
+	Settings.CustomRestartIndex = 2;
+	FCRRecoilRandomStream RandomStream;
+	int32_t ShotIndex = 2;
+
+	for (int32_t Shot = 0; Shot < 4; ++Shot)
+	{
+		EXPECT_EQ(Consume(ShotIndex, Settings, RandomStream), ShotDeltas[2]);
+		EXPECT_EQ(ShotIndex, 2);
+	}
+}
+
+TEST(CRRecoilShotSequence, RandomEndBehaviorReplaysFromTheSeed)
+{
+	const FCRShotSequenceSettings Settings = MakeSettings(ECRShotSequenceEndBehavior::Random);
+	FCRRecoilRandomStream First(1234u);
+	FCRRecoilRandomStream Second(1234u);
+	FCRRecoilRandomStream Other(4321u);
+
+	bool bDiffersFromOtherSeed = false;
+	for (int32_t Shot = 0; Shot < 16; ++Shot)
+	{
+		int32_t FirstIndex = 2;
+		int32_t SecondIndex = 2;
+		int32_t OtherIndex = 2;
+		const FCRRecoilVector Delta = Consume(FirstIndex, Settings, First);
+		EXPECT_EQ(Delta, Consume(SecondIndex, Settings, Second));
+		bDiffersFromOtherSeed |= Delta != Consume(OtherIndex, Settings, Other);
+	}
+	EXPECT_TRUE(bDiffersFromOtherSeed);
+}
+
+TEST(CRRecoilShotSequence, EmptyPatternsReturnZero)
+{
+	const FCRShotSequenceSettings Settings = MakeSettings(ECRShotSequenceEndBehavior::RepeatLast);
+	FCRRecoilRandomStream RandomStream;
+	int32_t ShotIndex = 0;
+	float ShotPosition = 0.f;
+	EXPECT_EQ(CrystalRecoilCore::ConsumeShot(ShotIndex, nullptr, 0, Settings, RandomStream), FCRRecoilVector());
+	EXPECT_EQ(CrystalRecoilCore::ConsumeShotAdvance(ShotPosition, 1.f, nullptr, 0, Settings, RandomStream), FCRRecoilVector());
+	EXPECT_EQ(ShotPosition, 0.f);
+}
+
+TEST(CRRecoilShotSequence, WholeShotAdvancesMatchConsumeShot)
+{
+	const std::vector<FCRRecoilVector> Positions = MakeShotPositions();
+	for (const ECRShotSequenceEndBehavior EndBehavior : { ECRShotSequenceEndBehavior::RepeatLast, ECRShotSequenceEndBehavior::Stop, ECRShotSequenceEndBehavior::RestartFromCustomIndex })
+	{
+		const FCRShotSequenceSettings Settings = MakeSettings(EndBehavior);
+		FCRRecoilRandomStream RandomStream;
+		int32_t ShotIndex = 0;
+		float ShotPosition = 0.f;
+
+		// ConsumeShot applies the end behavior from the last shot on, ConsumeShotAdvance only past the end of the pattern, so
+		// they only agree on the whole sequence for RepeatLast
+		const int32_t ComparedShots = EndBehavior == ECRShotSequenceEndBehavior::RepeatLast ? 8 : static_cast<int32_t>(ShotDeltas.size()) - 1;
+		for (int32_t Shot = 0; Shot < ComparedShots; ++Shot)
+		{
+			const FCRRecoilVector ByIndex = Consume(ShotIndex, Settings, RandomStream);
+			const FCRRecoilVector ByAdvance = CrystalRecoilCore::ConsumeShotAdvance(ShotPosition, 1.f, Positions.data(), static_cast<int32_t>(Positions.size()), Settings, RandomStream);
+			EXPECT_NEAR(ByIndex.X, ByAdvance.X, 1e-5f) << "Shot " << Shot;
+			EXPECT_NEAR(ByIndex.Y, ByAdvance.Y, 1e-5f) << "Shot " << Shot;
+		}
+	}
+}
+
+TEST(CRRecoilShotSequence, FractionalAdvancesInterpolateBetweenShots)
+{
+	const std::vector<FCRRecoilVector> Positions = MakeShotPositions();
+	const FCRShotSequenceSettings Settings = MakeSettings(ECRShotSequenceEndBehavior::Stop);
+	FCRRecoilRandomStream RandomStream;
+	float ShotPosition = 0.f;
+
+	const FCRRecoilVector FirstHalf = CrystalRecoilCore::ConsumeShotAdvance(ShotPosition, 0.5f, Positions.data(), static_cast<int32_t>(Positions.size()), Settings, RandomStream);
+	EXPECT_FLOAT_EQ(FirstHalf.Y, 0.5f);
+
+	const FCRRecoilVector AcrossUnits = CrystalRecoilCore::ConsumeShotAdvance(ShotPosition, 1.f, Positions.data(), static_cast<int32_t>(Positions.size()), Settings, RandomStream);
+	EXPECT_FLOAT_EQ(AcrossUnits.Y, 0.5f + 1.f);
+	EXPECT_FLOAT_EQ(ShotPosition, 1.5f);
+
+	// Stop clamps at the end of the pattern
+	CrystalRecoilCore::ConsumeShotAdvance(ShotPosition, 100.f, Positions.data(), static_cast<int32_t>(Positions.size()), Settings, RandomStream);
+	EXPECT_FLOAT_EQ(ShotPosition, 3.f);
+}
+
+TEST(CRRecoilShotSequence, HugeAdvancesLoopInConstantTime)
+{
+	const std::vector<FCRRecoilVector> Positions = MakeShotPositions();
+	const FCRShotSequenceSettings Settings = MakeSettings(ECRShotSequenceEndBehavior::RestartFromCustomIndex);
+	FCRRecoilRandomStream RandomStream;
+	float ShotPosition = 3.f;
+
+	// The loop covers shots 1 and 2, 5 degrees of pitch per loop
+	const FCRRecoilVector Delta = CrystalRecoilCore::ConsumeShotAdvance(ShotPosition, 2000.f, Positions.data(), static_cast<int32_t>(Positions.size()), Settings, RandomStream);
+	EXPECT_FLOAT_EQ(Delta.Y, 1000.f * 5.f);
+	EXPECT_FLOAT_EQ(ShotPosition, 3.f);
+}
+
+TEST(CRRecoilShotSequence, TimeIndexedShotAdvance)
+{
+	FCRShotSequenceSettings Settings;
+	Settings.ReferenceFireInterval = 0.1f;
+
+	// The first shot of a burst always advances a whole shot
+	EXPECT_FLOAT_EQ(CrystalRecoilCore::GetTimeIndexedShotAdvance(Settings, 0.f, 5.f, 5.f), 1.f);
+
+	EXPECT_FLOAT_EQ(CrystalRecoilCore::GetTimeIndexedShotAdvance(Settings, 1.f, 1.f, 1.05), 0.5f);
+	EXPECT_FLOAT_EQ(CrystalRecoilCore::GetTimeIndexedShotAdvance(Settings, 1.f, 1.f, 3.0), 1.f);
+	EXPECT_FLOAT_EQ(CrystalRecoilCore::GetTimeIndexedShotAdvance(Settings, 1.f, 1.f, 1.0), 0.f);
+	EXPECT_FLOAT_EQ(CrystalRecoilCore::GetTimeIndexedShotAdvance(Settings, 1.f, 2.f, 1.0), 0.f);
+}